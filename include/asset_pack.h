@@ -0,0 +1,121 @@
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include "raylib.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Asset Pack - Single-file archive for game assets
+ *
+ * Layout (little-endian):
+ *   AssetPackHeader
+ *   AssetPackEntry[entryCount]   (sorted by path for binary search)
+ *   entry data, each aligned to ASSET_PACK_ALIGNMENT bytes
+ *
+ * Once mounted, raylib's LoadFileData/LoadFileText (and everything built on
+ * them: LoadImage, LoadTexture, LoadWave...) are served from the memory-mapped
+ * archive. Paths missing from the pack fall back to loose files, so a
+ * development checkout works with or without a pack.
+ */
+
+#define ASSET_PACK_MAGIC "CPAK"
+#define ASSET_PACK_VERSION 1
+#define ASSET_PACK_ALIGNMENT 16
+#define ASSET_PACK_PATH_MAX 112
+#define ASSET_PACK_DEFAULT "assets.pak"
+
+typedef struct AssetPackHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t alignment;
+    uint64_t indexOffset;         // Offset of the entry table
+    uint64_t dataOffset;          // Offset of the first entry's data
+} AssetPackHeader;
+
+typedef struct AssetPackEntry {
+    char path[ASSET_PACK_PATH_MAX];   // Normalized relative path, NUL-terminated
+    uint64_t offset;                  // Absolute offset of the data in the pack
+    uint64_t size;                    // Data size in bytes
+    uint64_t hash;                    // FNV-1a 64 of the data
+} AssetPackEntry;
+
+/**
+ * Map a pack file and route raylib file loading through it
+ *
+ * @param packPath Path of the archive
+ * @param verify Check every entry's hash before mounting
+ * @return true if the pack was mounted
+ */
+bool AssetPack_Mount(const char* packPath, bool verify);
+
+/**
+ * Unmap the pack and restore raylib's default file loading
+ */
+void AssetPack_Unmount(void);
+
+/**
+ * Whether a pack is currently mounted
+ *
+ * @return true if mounted
+ */
+bool AssetPack_IsMounted(void);
+
+/**
+ * Find a file inside the mounted pack
+ *
+ * @param path File path (same form used for loose files)
+ * @param size Output data size (may be NULL)
+ * @return Read-only pointer into the pack, NULL if not packed
+ */
+const unsigned char* AssetPack_Find(const char* path, int* size);
+
+/**
+ * Number of entries in the mounted pack
+ *
+ * @return Entry count (0 if nothing is mounted)
+ */
+int AssetPack_GetEntryCount(void);
+
+/**
+ * Entry of the mounted pack by index (sorted by path)
+ *
+ * @param index Entry index
+ * @return Entry, NULL if out of range
+ */
+const AssetPackEntry* AssetPack_GetEntry(int index);
+
+/**
+ * Whether a file can be loaded, from the pack or from disk
+ *
+ * @param path File path
+ * @return true if packed or present as a loose file
+ */
+bool AssetPack_FileExists(const char* path);
+
+/**
+ * Load a music stream from the pack (zero-copy) or from disk
+ *
+ * @param path Music file path
+ * @return Music stream (ctxType is 0 on failure, as with LoadMusicStream)
+ */
+Music AssetPack_LoadMusicStream(const char* path);
+
+/**
+ * Hash data the same way pack entries are hashed
+ *
+ * @param data Data to hash
+ * @param size Data size in bytes
+ * @return FNV-1a 64-bit hash
+ */
+uint64_t AssetPack_Hash(const unsigned char* data, uint64_t size);
+
+/**
+ * Verify the hash of every entry in the mounted pack
+ *
+ * @return Number of corrupt entries (0 = pack is intact)
+ */
+int AssetPack_Verify(void);
+
+#endif // ASSET_PACK_H
@@ -1,6 +1,8 @@
 #ifndef AUDIO_ANALYSIS_H
 #define AUDIO_ANALYSIS_H
 
+#include "audio_fft.h"
+#include "bass_envelope.h"   // BassLevel
 #include <complex.h>
 #include <stdio.h>
 
@@ -30,15 +32,10 @@ typedef struct {
     int peakEnabled;      // Enable/disable peak detection (0=disabled, 1=enabled)
 } BassConfig;
 
-// Bass level enumeration
-typedef enum {
-    BASS_NONE = 0,
-    BASS_LOW,
-    BASS_MEDIUM,
-    BASS_HIGH
-} BassLevel;
 
 // Core FFT and windowing functions
+// audio_fft is the original in-place complex radix-2 transform, kept as a
+// reference; the analyzers use a real-input AudioFFTPlan (audio_fft.h)
 void audio_fft(float complex *x, int n);
 void audio_applyWindow(float *samples, int size);
 
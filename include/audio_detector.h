@@ -0,0 +1,100 @@
+#ifndef AUDIO_DETECTOR_H
+#define AUDIO_DETECTOR_H
+
+#include "audio_analysis.h"
+#include "audio_onset.h"
+#include "audio_stft.h"
+#include "bass_envelope.h"
+#include <stdbool.h>
+#include <stdio.h>
+
+/**
+ * Bass Detector - Turns STFT frames into bass events and peaks
+ *
+ * This is the analysis behind the CLI bass logs, shared by the CLI and the
+ * batch analyzer so both write identical logs. One detector per track; it
+ * keeps no global state, so workers can run one each in parallel.
+ */
+
+typedef struct {
+    BassConfig config;
+    FILE *logFile;              // Event log (NULL = none)
+    bool echo;                  // Also print events and progress to stdout
+    bool verbose;               // Print every energy reading (every 0.5s, needs echo)
+    BassEnvelopeBuilder *envelope;  // Records every frame for the level's .benv (NULL = none)
+    AudioOnsetDetector *onsets;     // Onset/beat engine (NULL = no beat grid)
+    FILE *beatsFile;                // Beat grid output (needs onsets)
+
+    float magnitude[FFT_SIZE/2];    // Smoothed, normalized spectrum
+    float bassEnergy;
+    BassLevel currentBassLevel;
+    BassLevel previousBassLevel;
+    double bassStartTime;
+    int bassEventCount;
+    double lastLogTime;
+
+    // Peak detection
+    float previousBassEnergy;
+    double lastPeakTime;
+    int peakCount;
+
+    // Beat grid
+    int onsetCount;
+    int beatCount;
+    int barCount;
+} BassDetector;
+
+/**
+ * Reset a detector
+ *
+ * @param detector Detector
+ * @param config Thresholds
+ * @param logFile Event log (NULL = none)
+ * @param echo Print events to stdout
+ */
+void audio_detectorInit(BassDetector *detector, const BassConfig *config, FILE *logFile, bool echo);
+
+/**
+ * Process one STFT frame
+ *
+ * @param detector Detector
+ * @param spectrum FFT_SIZE/2 unnormalized magnitudes (audio_stftNextFrame output)
+ * @param time Stream time of the frame
+ */
+void audio_detectorProcessFrame(BassDetector *detector, const float *spectrum, double time);
+
+/**
+ * Analyze decoded stereo float PCM as fast as possible
+ *
+ * @param detector Detector
+ * @param stft STFT engine (fresh or reset to 0)
+ * @param samples Interleaved stereo float samples at SAMPLE_RATE
+ * @param frameCount Number of stereo frames
+ * @param maxTime Stop after this many seconds
+ * @return Stream time of the last analyzed frame
+ */
+float audio_detectorAnalyzePCM(BassDetector *detector, AudioSTFT *stft,
+                               const float *samples, unsigned int frameCount, float maxTime);
+
+/**
+ * Bass log header and summary (the format the level tools read)
+ */
+void audio_writeLogHeader(FILE *file, const char *audioFile, float duration, const BassConfig *config);
+void audio_writeLogSummary(FILE *file, const BassDetector *detector, float analysisTime);
+
+/**
+ * Beat grid file next to an audio file (extension replaced by .beats)
+ *
+ * @param audioPath Audio file path
+ * @param beatsPath Output path
+ * @param size Output buffer size
+ */
+void audio_getBeatsFilePath(const char *audioPath, char *beatsPath, size_t size);
+
+/**
+ * Beat grid header and summary
+ */
+void audio_writeBeatsHeader(FILE *file, const char *audioFile, float duration);
+void audio_writeBeatsSummary(FILE *file, const BassDetector *detector);
+
+#endif // AUDIO_DETECTOR_H
@@ -0,0 +1,71 @@
+#ifndef AUDIO_FFT_H
+#define AUDIO_FFT_H
+
+#include <complex.h>
+
+/**
+ * Audio FFT - Real-input FFT plans for the audio analysis tools
+ *
+ * A plan is built once per transform size and caches everything that does
+ * not depend on the input: the bit-reverse permutation, per-stage radix-4
+ * twiddles and the twiddles that turn an n/2-point complex transform into
+ * an n-point real one. Twiddles are computed in double precision, so the
+ * error no longer grows with every butterfly like the old w *= wlen.
+ *
+ * The butterflies use AVX or SSE when the compiler targets them (see
+ * audio_fftKernelName) and plain C otherwise.
+ *
+ * A plan owns its scratch buffers: use one plan per thread.
+ */
+
+typedef struct AudioFFTPlan AudioFFTPlan;
+
+/**
+ * Create a plan for real input of the given size
+ *
+ * @param size Transform size (power of two, at least 4)
+ * @return Plan, or NULL if the size is invalid or memory ran out
+ */
+AudioFFTPlan* audio_fftPlanCreate(int size);
+
+/**
+ * Free a plan (NULL is ignored)
+ *
+ * @param plan Plan to free
+ */
+void audio_fftPlanDestroy(AudioFFTPlan *plan);
+
+/**
+ * Transform size the plan was created for
+ *
+ * @param plan Plan
+ * @return Size in samples
+ */
+int audio_fftPlanSize(const AudioFFTPlan *plan);
+
+/**
+ * Forward transform of real samples
+ *
+ * @param plan Plan
+ * @param input size real samples
+ * @param output size/2 + 1 bins (DC through Nyquist, unnormalized)
+ */
+void audio_fftForward(AudioFFTPlan *plan, const float *input, float complex *output);
+
+/**
+ * Magnitude spectrum of real samples (|X[k]|, unnormalized)
+ *
+ * @param plan Plan
+ * @param input size real samples
+ * @param magnitude size/2 bins (DC up to, not including, Nyquist)
+ */
+void audio_fftMagnitude(AudioFFTPlan *plan, const float *input, float *magnitude);
+
+/**
+ * Butterfly kernel compiled into this build
+ *
+ * @return "avx", "sse" or "scalar"
+ */
+const char* audio_fftKernelName(void);
+
+#endif // AUDIO_FFT_H
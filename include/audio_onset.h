@@ -0,0 +1,96 @@
+#ifndef AUDIO_ONSET_H
+#define AUDIO_ONSET_H
+
+#include "audio_stft.h"
+#include <stdbool.h>
+
+/**
+ * Audio Onset - Onset, tempo and beat-grid detection over STFT frames
+ *
+ * Each frame's log-compressed spectrum is compared with the previous one in
+ * AUDIO_ONSET_BANDS frequency bands; the rectified increases (spectral flux)
+ * averaged over the bands form the onset strength. Onsets are local maxima
+ * of the strength above an adaptive threshold (median of the last
+ * AUDIO_ONSET_MEDIAN_SECONDS plus a fraction of the running mean).
+ *
+ * Tempo comes from the autocorrelation of the last AUDIO_ONSET_HISTORY_SECONDS
+ * of onset strength, weighted towards AUDIO_ONSET_PREFERRED_BPM, re-estimated
+ * every second. Beats are predicted one period ahead and pulled towards the
+ * strongest onset near the prediction; the bar position (4/4) follows the
+ * beat with the most low-band flux.
+ *
+ * Processing is incremental and causal, so it runs the same way in realtime
+ * and offline analysis. Onsets are reported one frame late and beats about
+ * a fifth of a period late; event times are always the detected positions.
+ */
+
+#define AUDIO_ONSET_BANDS 6
+#define AUDIO_ONSET_MEDIAN_SECONDS 0.5f
+#define AUDIO_ONSET_HISTORY_SECONDS 6.0f
+#define AUDIO_ONSET_MIN_BPM 60.0f
+#define AUDIO_ONSET_MAX_BPM 200.0f
+#define AUDIO_ONSET_PREFERRED_BPM 120.0f
+#define AUDIO_ONSET_BEATS_PER_BAR 4
+#define AUDIO_ONSET_MAX_EVENTS 8        // Events one frame can produce
+
+typedef enum {
+    AUDIO_ONSET_EVENT_ONSET = 0,
+    AUDIO_ONSET_EVENT_BEAT
+} AudioOnsetEventType;
+
+typedef struct {
+    AudioOnsetEventType type;
+    double time;                    // Stream time of the onset / beat
+    float strength;                 // Onset strength at that time
+    float bpm;                      // Tempo estimate (beats only)
+    bool downbeat;                  // First beat of a bar (beats only)
+    int bar;                        // Bar number from 1 (beats only)
+    int beat;                       // Beat within the bar from 1 (beats only)
+} AudioOnsetEvent;
+
+typedef struct AudioOnsetDetector AudioOnsetDetector;
+
+/**
+ * Create a detector for frames produced with an STFT configuration
+ *
+ * @param config STFT configuration (frame size, hop, sample rate)
+ * @return Detector, or NULL if memory ran out
+ */
+AudioOnsetDetector* audio_onsetCreate(const AudioSTFTConfig *config);
+
+/**
+ * Free a detector (NULL is ignored)
+ *
+ * @param detector Detector
+ */
+void audio_onsetDestroy(AudioOnsetDetector *detector);
+
+/**
+ * Forget all history (after a seek or restart)
+ *
+ * @param detector Detector
+ */
+void audio_onsetReset(AudioOnsetDetector *detector);
+
+/**
+ * Process one STFT frame
+ *
+ * @param detector Detector
+ * @param spectrum frameSize/2 unnormalized magnitudes (audio_stftNextFrame output)
+ * @param time Stream time of the frame
+ * @param events Output events, in time order
+ * @param maxEvents Capacity of events (AUDIO_ONSET_MAX_EVENTS is always enough)
+ * @return Number of events written
+ */
+int audio_onsetProcess(AudioOnsetDetector *detector, const float *spectrum, double time,
+                       AudioOnsetEvent *events, int maxEvents);
+
+/**
+ * Current tempo estimate
+ *
+ * @param detector Detector
+ * @return Beats per minute, 0 until enough audio has been analyzed
+ */
+float audio_onsetGetTempo(const AudioOnsetDetector *detector);
+
+#endif // AUDIO_ONSET_H
@@ -0,0 +1,128 @@
+#ifndef AUDIO_STFT_H
+#define AUDIO_STFT_H
+
+#include <stdbool.h>
+
+/**
+ * Audio STFT - Streaming short-time Fourier transform for the analyzers
+ *
+ * The audio callback pushes interleaved PCM into a lock-free single-producer
+ * / single-consumer ring; the analysis loop pulls magnitude spectra out of
+ * it one frame at a time. Frames are windowed in time order with a cached
+ * window table, overlap by frameSize - hopSize samples, and are stamped with
+ * the stream time of their newest sample.
+ *
+ * Threading: audio_stftPush may run on the audio thread while every other
+ * function runs on the analysis thread. Create/destroy with the producer
+ * detached.
+ */
+
+#define AUDIO_STFT_RING_SIZE 16384    // Default ring capacity in samples (power of two)
+
+typedef enum {
+    AUDIO_WINDOW_HANN = 0,
+    AUDIO_WINDOW_HAMMING,
+    AUDIO_WINDOW_BLACKMAN
+} AudioWindowType;
+
+typedef enum {
+    AUDIO_CHANNEL_LEFT = 0,
+    AUDIO_CHANNEL_RIGHT,
+    AUDIO_CHANNEL_MID               // (left + right) / 2
+} AudioChannelMode;
+
+typedef struct {
+    int frameSize;                  // FFT size (power of two)
+    int hopSize;                    // Samples between frames (1..frameSize)
+    AudioWindowType window;
+    AudioChannelMode channel;
+    float sampleRate;               // Used for timestamps
+    int ringSize;                   // Ring capacity (power of two, at least 2 * frameSize)
+} AudioSTFTConfig;
+
+typedef struct AudioSTFT AudioSTFT;
+
+/**
+ * Default configuration: FFT_SIZE frames without overlap, Hamming window,
+ * left channel, SAMPLE_RATE (matches the original analyzers)
+ *
+ * @return Configuration
+ */
+AudioSTFTConfig audio_stftDefaultConfig(void);
+
+/**
+ * Create an STFT engine
+ *
+ * @param config Configuration (NULL = defaults)
+ * @return Engine, or NULL if the configuration is invalid or memory ran out
+ */
+AudioSTFT* audio_stftCreate(const AudioSTFTConfig *config);
+
+/**
+ * Free an engine (NULL is ignored)
+ *
+ * @param stft Engine
+ */
+void audio_stftDestroy(AudioSTFT *stft);
+
+/**
+ * Configuration the engine was created with
+ *
+ * @param stft Engine
+ * @return Configuration
+ */
+AudioSTFTConfig audio_stftGetConfig(const AudioSTFT *stft);
+
+/**
+ * Producer side: append interleaved frames (samples that do not fit are
+ * dropped and counted)
+ *
+ * @param stft Engine
+ * @param samples Interleaved float samples
+ * @param frames Number of frames
+ * @param channels Channels per frame
+ */
+void audio_stftPush(AudioSTFT *stft, const float *samples, unsigned int frames, int channels);
+
+/**
+ * Consumer side: compute the next frame if enough samples have arrived
+ *
+ * @param stft Engine
+ * @param magnitude Output, frameSize/2 bins (unnormalized |X|)
+ * @param time Output, stream time of the frame's newest sample (may be NULL)
+ * @return true if a frame was produced
+ */
+bool audio_stftNextFrame(AudioSTFT *stft, float *magnitude, double *time);
+
+/**
+ * Consumer side: discard buffered samples and restart the clock (after a seek)
+ *
+ * @param stft Engine
+ * @param time Stream time of the next pushed sample
+ */
+void audio_stftReset(AudioSTFT *stft, double time);
+
+/**
+ * Samples dropped because the ring was full (the consumer fell behind)
+ *
+ * @param stft Engine
+ * @return Total dropped samples
+ */
+unsigned int audio_stftDroppedSamples(const AudioSTFT *stft);
+
+/**
+ * Parse window and channel names ("hann", "hamming", "blackman";
+ * "left", "right", "mid")
+ *
+ * @return true if the name is known
+ */
+bool audio_stftParseWindow(const char *name, AudioWindowType *window);
+bool audio_stftParseChannel(const char *name, AudioChannelMode *channel);
+
+/**
+ * Names for logs and usage text
+ */
+const char* audio_stftWindowName(AudioWindowType window);
+const char* audio_stftChannelName(AudioChannelMode channel);
+
+#endif // AUDIO_STFT_H
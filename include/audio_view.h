@@ -0,0 +1,108 @@
+#ifndef AUDIO_VIEW_H
+#define AUDIO_VIEW_H
+
+#include "raylib.h"
+#include <stdbool.h>
+
+/**
+ * Audio View - Cached spectrum and spectrogram drawing for the analyzer GUIs
+ *
+ * The spectrogram is a ring of columns in a texture: each analysis frame
+ * writes one column of pixels with UpdateTextureRec, and drawing is two
+ * textured quads (oldest part, then newest part) instead of one rectangle
+ * per bin per history frame. Row-to-bin mapping, frequency bands and colors
+ * are computed once into tables; magnitudes index a color lookup table.
+ *
+ * Textures require an OpenGL context: create views after InitWindow and
+ * push/draw from the thread that owns the window.
+ */
+
+#define AUDIO_VIEW_BANDS 3              // Bass, mid, high
+#define AUDIO_VIEW_LUT_SIZE 256         // Color steps per band
+
+typedef struct {
+    Texture2D texture;                  // columns x rows, one column per analysis frame
+    int columns;
+    int rows;
+    int nextColumn;                     // Column the next frame is written to (= oldest column)
+    int *rowBin;                        // Spectrum bin shown by each texture row (row 0 = top)
+    unsigned char *rowBand;
+    Color *pixels;                      // One column of staging pixels
+    Color lut[AUDIO_VIEW_BANDS][AUDIO_VIEW_LUT_SIZE];
+} AudioSpectrogramView;
+
+typedef struct {
+    int barCount;
+    int *barBin;                        // Spectrum bin shown by each bar
+    unsigned char *barBand;
+    Color lut[AUDIO_VIEW_BANDS][AUDIO_VIEW_LUT_SIZE];
+} AudioSpectrumView;
+
+/**
+ * Create a spectrogram view
+ *
+ * @param view View
+ * @param columns History length in analysis frames
+ * @param rows Texture height in pixels (one row per displayed frequency)
+ * @param maxBin Highest spectrum bin shown (exclusive)
+ * @return true on success
+ */
+bool audio_spectrogramViewInit(AudioSpectrogramView *view, int columns, int rows, int maxBin);
+
+/**
+ * Write one analysis frame as the newest column
+ *
+ * @param view View
+ * @param magnitude Normalized spectrum (at least maxBin bins)
+ */
+void audio_spectrogramViewPush(AudioSpectrogramView *view, const float *magnitude);
+
+/**
+ * Clear the history (after a restart)
+ *
+ * @param view View
+ */
+void audio_spectrogramViewClear(AudioSpectrogramView *view);
+
+/**
+ * Draw the history, oldest column on the left
+ *
+ * @param view View
+ * @param bounds Screen rectangle
+ */
+void audio_spectrogramViewDraw(const AudioSpectrogramView *view, Rectangle bounds);
+
+/**
+ * Free the texture and tables
+ *
+ * @param view View
+ */
+void audio_spectrogramViewUnload(AudioSpectrogramView *view);
+
+/**
+ * Create a spectrum bar view
+ *
+ * @param view View
+ * @param barCount Number of bars
+ * @param maxBin Highest spectrum bin shown (exclusive)
+ * @return true on success
+ */
+bool audio_spectrumViewInit(AudioSpectrumView *view, int barCount, int maxBin);
+
+/**
+ * Draw the bars for a spectrum
+ *
+ * @param view View
+ * @param magnitude Normalized spectrum
+ * @param bounds Screen rectangle (bars are bounds.width / barCount wide)
+ */
+void audio_spectrumViewDraw(const AudioSpectrumView *view, const float *magnitude, Rectangle bounds);
+
+/**
+ * Free the tables
+ *
+ * @param view View
+ */
+void audio_spectrumViewUnload(AudioSpectrumView *view);
+
+#endif // AUDIO_VIEW_H
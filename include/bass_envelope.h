@@ -0,0 +1,151 @@
+#ifndef BASS_ENVELOPE_H
+#define BASS_ENVELOPE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Bass Envelope - Precomputed bass analysis shipped with each level
+ *
+ * The audio analyzers write one envelope per track next to its bass log;
+ * the game loads it with the level and looks up bass energy, level and
+ * peaks by music time in O(1), with no DSP at runtime.
+ *
+ * File layout (little-endian):
+ *   magic "BENV", uint16 version, uint16 frameRate, uint32 frameCount,
+ *   float32 energyScale, then frameCount uint16 frames:
+ *     bits 0-11  energy, quantized to 0..4095 of energyScale
+ *     bits 12-13 BassLevel
+ *     bit  14    peak detected in this frame
+ */
+
+#define BASS_ENVELOPE_MAGIC "BENV"
+#define BASS_ENVELOPE_VERSION 1
+#define BASS_ENVELOPE_FRAME_RATE 50       // Frames per second written by the analyzers
+#define BASS_ENVELOPE_EXTENSION ".benv"
+#define BASS_ENVELOPE_HEADER_SIZE 16
+
+// Bass level enumeration
+typedef enum {
+    BASS_NONE = 0,
+    BASS_LOW,
+    BASS_MEDIUM,
+    BASS_HIGH
+} BassLevel;
+
+// One looked-up frame
+typedef struct BassSample {
+    float energy;                 // Bass energy (same scale as the analyzer thresholds)
+    BassLevel level;
+    bool peak;
+} BassSample;
+
+// Loaded envelope (read-only at runtime)
+typedef struct BassEnvelope {
+    int frameRate;
+    int frameCount;
+    float energyScale;            // Energy of a frame with quantized value 4095
+    uint16_t* frames;
+} BassEnvelope;
+
+// Envelope being recorded by an analyzer (full precision until saved)
+typedef struct BassEnvelopeBuilder {
+    int frameRate;
+    int frameCount;
+    int capacity;
+    float* energy;
+    uint8_t* flags;               // BassLevel | peak bit
+} BassEnvelopeBuilder;
+
+/**
+ * Envelope path for an audio file (extension replaced by .benv)
+ *
+ * @param audioPath Audio file path
+ * @param envelopePath Output path
+ * @param size Output buffer size
+ */
+void BassEnvelope_GetPath(const char* audioPath, char* envelopePath, size_t size);
+
+/**
+ * Load an envelope (from the asset pack if one is mounted)
+ *
+ * @param path Envelope file path
+ * @return Envelope, or NULL if the file is missing or invalid
+ */
+BassEnvelope* BassEnvelope_Load(const char* path);
+
+/**
+ * Free an envelope (NULL is ignored)
+ *
+ * @param envelope Envelope
+ */
+void BassEnvelope_Unload(BassEnvelope* envelope);
+
+/**
+ * Look up the frame covering a music time
+ *
+ * @param envelope Envelope (NULL gives a silent sample)
+ * @param time Music time in seconds
+ * @return Sample (silent outside the track)
+ */
+BassSample BassEnvelope_Sample(const BassEnvelope* envelope, float time);
+
+/**
+ * Whether a peak falls in the frames covering (from, to]
+ *
+ * Call with the previous and current music time each game frame so every
+ * peak fires exactly once regardless of frame rate.
+ *
+ * @param envelope Envelope (NULL = no peaks)
+ * @param from Previous music time
+ * @param to Current music time
+ * @return true if a peak frame was crossed
+ */
+bool BassEnvelope_PeakBetween(const BassEnvelope* envelope, float from, float to);
+
+/**
+ * Length of the envelope
+ *
+ * @param envelope Envelope
+ * @return Duration in seconds (0 for NULL)
+ */
+float BassEnvelope_GetDuration(const BassEnvelope* envelope);
+
+/**
+ * Start recording an envelope
+ *
+ * @param builder Builder
+ * @param frameRate Frames per second
+ * @return true on success
+ */
+bool BassEnvelope_BuilderInit(BassEnvelopeBuilder* builder, int frameRate);
+
+/**
+ * Record one analysis frame; envelope frames up to time hold these values
+ *
+ * @param builder Builder
+ * @param time Time of the analysis frame (newest sample)
+ * @param energy Bass energy
+ * @param level Bass level
+ * @param peak Peak detected in this analysis frame
+ */
+void BassEnvelope_BuilderAdd(BassEnvelopeBuilder* builder, double time, float energy, BassLevel level, bool peak);
+
+/**
+ * Quantize and write the recorded envelope
+ *
+ * @param builder Builder
+ * @param path Output path
+ * @return true on success
+ */
+bool BassEnvelope_Save(const BassEnvelopeBuilder* builder, const char* path);
+
+/**
+ * Free a builder's frames
+ *
+ * @param builder Builder
+ */
+void BassEnvelope_BuilderFree(BassEnvelopeBuilder* builder);
+
+#endif // BASS_ENVELOPE_H
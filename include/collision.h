@@ -5,14 +5,57 @@
 #include "enemy_types.h"
 #include "explosion.h"
 
-// Check all collisions in the game
-void CheckCollisions(Game* game);
+/**
+ * Collision events
+ *
+ * Collision checks run in two passes. Detection scans the entity arrays without
+ * changing anything and appends one compact event per contact, in scan order.
+ * Resolution then walks the events in that order and applies damage,
+ * explosions, powerup drops, score, telemetry and logging. An event whose
+ * entity was already used up by an earlier event (enemy destroyed, non-piercing
+ * projectile spent) is skipped, which gives the same result as resolving each
+ * contact the moment it is found.
+ *
+ * Bullets, projectiles, enemies and the player are also tested along the path
+ * they moved during the tick (from previousPosition, recorded by
+ * Collision_BeginTick, to position), so fast objects can not pass through each
+ * other between two ticks. Contacts at the end of the tick are recorded as
+ * before; only when there are none does the sweep add the first contact on the
+ * way (every one of them for piercing projectiles).
+ *
+ * Every test against an enemy has two stages: the bounding boxes first, then
+ * the enemy's shape, which is the circle it is drawn as. Along a swept path the
+ * shape is tested at points at most SWEEP_SAMPLE_SPACING apart.
+ */
+typedef enum {
+    COLLISION_BULLET_ENEMY = 0,     // a = bullet, b = enemy
+    COLLISION_PROJECTILE_ENEMY,     // a = player projectile, b = enemy
+    COLLISION_PROJECTILE_PLAYER,    // a = enemy projectile
+    COLLISION_PLAYER_ENEMY,         // b = enemy
+    COLLISION_PLAYER_POWERUP        // a = powerup
+} CollisionEventType;
+
+typedef struct {
+    unsigned short type;            // CollisionEventType
+    unsigned short a;               // Bullet, projectile or powerup index
+    unsigned short b;               // Enemy index
+} CollisionEvent;
+
+// Per-tick event list (grows as needed, reused from tick to tick)
+typedef struct CollisionEventQueue {
+    CollisionEvent* events;
+    int count;
+    int capacity;
+} CollisionEventQueue;
 
-// Check bullet-enemy collisions
-void CheckBulletEnemyCollisions(Game* game);
+void Collision_InitEventQueue(CollisionEventQueue* queue);
+void Collision_CleanupEventQueue(CollisionEventQueue* queue);
 
-// Check player-enemy collisions
-void CheckPlayerEnemyCollisions(Game* game);
+// Record where bullets, enemies, projectiles and the player start the tick (call before anything moves)
+void Collision_BeginTick(Game* game);
+
+// Check all collisions in the game (detects into game->collisionEvents, then resolves)
+void CheckCollisions(Game* game);
 
 /**
  * Generic Bullet-Enemy Collision System
@@ -31,6 +74,8 @@ typedef struct {
     int* score;                        // For adding score (game only)
     int* enemiesKilled;                // For tracking kills (showcase only)
     void* logContext;                  // For logging (game only)
+    CollisionEventQueue* events;       // Reused event storage (NULL = temporary per call)
+    bool swept;                        // Also test the path since previousPosition (kept up to date by the caller)
     
     // Callbacks (optional)
     void (*onEnemyHit)(void* context, EnemyEx* enemy, int damage);
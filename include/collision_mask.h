@@ -0,0 +1,96 @@
+#ifndef COLLISION_MASK_H
+#define COLLISION_MASK_H
+
+#include "raylib.h"
+#include "enemy_types.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Collision Masks - 1-bit shapes for pixel-precise hit tests
+ *
+ * A mask is built once from a sprite's alpha channel: bit x of rows[y] is set
+ * when pixel (x, y) is solid. Sprites are at most 64 pixels wide, so a test
+ * against one mask row is a single 64-bit AND of the row with the span the
+ * other shape covers on that row.
+ *
+ * Masks are placed in the world by the entity's position (the sprite's center)
+ * and scaled so that the shape's radius in the sprite matches the entity's
+ * radius. They are the second stage of a test: callers reject by bounding box
+ * first.
+ *
+ * Enemy masks come from the generated enemy sprite sheet. The game draws its
+ * enemies as circles rather than from the sheet, so it does not load them and
+ * hits enemies as circles (collision.c); the masks are for code that shows the
+ * sprites.
+ */
+
+#define COLLISION_MASK_MAX_SIZE 64          // Pixels per row and rows per mask
+#define COLLISION_MASK_ALPHA_THRESHOLD 128  // Pixels at least this opaque are solid
+
+typedef struct CollisionMask {
+    uint64_t rows[COLLISION_MASK_MAX_SIZE];
+    int width;
+    int height;
+    int firstRow;                   // Rows with solid pixels (firstRow > lastRow when empty)
+    int lastRow;
+    float radius;                   // Shape radius in pixels (scaled to the entity's radius)
+} CollisionMask;
+
+/**
+ * Build a mask from a region of an image
+ *
+ * @param mask Mask to fill
+ * @param image Source image
+ * @param region Pixels to use (at most COLLISION_MASK_MAX_SIZE square), centered on the shape
+ * @param radius Shape radius in pixels
+ * @return false if the region does not fit the image or the mask
+ */
+bool CollisionMask_FromImage(CollisionMask* mask, Image image, Rectangle region, float radius);
+
+/**
+ * Test a mask placed in the world against a rectangle
+ *
+ * @param mask Mask
+ * @param position Entity position (center of the mask)
+ * @param entityRadius Entity radius (scales the mask)
+ * @param rect World rectangle
+ * @return true if any solid pixel overlaps the rectangle
+ */
+bool CollisionMask_OverlapsRect(const CollisionMask* mask, Vector2 position, float entityRadius, Rectangle rect);
+
+/**
+ * Test a mask placed in the world against a circle
+ *
+ * @param mask Mask
+ * @param position Entity position (center of the mask)
+ * @param entityRadius Entity radius (scales the mask)
+ * @param center Circle center
+ * @param radius Circle radius
+ * @return true if any solid pixel overlaps the circle
+ */
+bool CollisionMask_OverlapsCircle(const CollisionMask* mask, Vector2 position, float entityRadius,
+                                  Vector2 center, float radius);
+
+/**
+ * Build the enemy masks from the enemy sprite sheet
+ *
+ * @param spriteSheetPath Sheet written by generate_enemy_sprites (ENEMY_SPRITESHEET_PATH)
+ * @return true if the masks were built
+ */
+bool CollisionMasks_LoadEnemies(const char* spriteSheetPath);
+
+/**
+ * Drop the enemy masks (enemies go back to circle tests)
+ */
+void CollisionMasks_UnloadEnemies(void);
+
+/**
+ * Mask of an enemy type
+ *
+ * @param type Enemy type
+ * @return Mask, NULL if the masks are not loaded
+ */
+const CollisionMask* CollisionMasks_GetEnemy(EnemyType type);
+
+#endif // COLLISION_MASK_H
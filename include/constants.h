@@ -12,10 +12,16 @@
 #define PLAY_ZONE_BOTTOM (SCREEN_HEIGHT - BOTTOM_HUD_HEIGHT)  // Bottom of play zone (500)
 #define PLAY_ZONE_HEIGHT (PLAY_ZONE_BOTTOM - PLAY_ZONE_TOP)  // Effective play zone height (470)
 
-// Game object limits
+// Game object limits (default pool sizes; a level's "capacity" block can raise them)
 #define MAX_BULLETS 50
 #define MAX_ENEMIES 30  // Increased for wave system
 #define MAX_PROJECTILES 200  // For enemy and player projectiles
+#define MAX_POOL_CAPACITY 65535  // Upper bound for any pool (collision events store 16-bit indices)
+
+// Simulation tick: gameplay advances in fixed steps so a run can be replayed from its input
+#define SIM_TICK_RATE 60
+#define SIM_TICK_TIME (1.0f / SIM_TICK_RATE)
+#define SIM_MAX_TICKS_PER_FRAME 5    // Longer stalls slow the game down instead of catching up
 
 // Movement and speed constants
 #define PLAYER_SPEED 5.0f
@@ -41,5 +47,14 @@
 #define DEBUG_START_PHASE 0          // Phase to start at (0 = normal start)
                                       // Tank Testing: Phase 3 (35s), 5 (85s), 11 (300s)
                                       // Boss Testing: Phase 12+ (345s+)
+#define DEBUG_SEEK_KEYS false        // Set to true to jump through the level with PAGE_UP/PAGE_DOWN
+#define DEBUG_SEEK_STEP 30.0f        // Seconds jumped per seek key press
+
+// Music clock sync
+#define MUSIC_CLOCK_SYNC true        // Pull the level clock toward the music playback position
+#define MUSIC_SYNC_MAX_DRIFT 0.5f    // Larger differences are discontinuities, not drift (seconds)
+#define MUSIC_SYNC_RATE 0.1f         // Fraction of the drift corrected per frame
+#define MUSIC_SYNC_MAX_SLEW 0.05f    // Max correction as a fraction of the frame time
+                                      // (changes how many ticks run, never the tick length)
 
 #endif // CONSTANTS_H
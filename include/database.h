@@ -28,6 +28,9 @@ typedef struct {
     bool fullscreen;  // Maps to fullscreenMode != 0
 } UserSettings;
 
+// Scores per difficulty kept in memory and shown on the high score table (every score is stored)
+#define DB_HIGH_SCORES_PER_DIFFICULTY 10
+
 // High score entry structure
 typedef struct {
     int id;
@@ -37,20 +40,178 @@ typedef struct {
     long timestamp;
 } HighScoreEntry;
 
+// Replay of a high score run: the encoded per-tick input (see replay.h) and what is needed to
+// start the simulation the same way. The input data itself is read with DB_ReadReplayData.
+typedef struct {
+    int id;                     // Assigned when stored
+    int highScoreId;            // Set by the database when the score is stored
+    int formatVersion;
+    unsigned int seed;          // Random seed the run was started with
+    int startLevel;             // Level numbers the run started and ended in
+    int finalLevel;
+    int tickRate;               // Simulation ticks per second
+    int tickCount;
+    int score;                  // Final score, to verify a playback against
+    int dataSize;               // Bytes of encoded input
+} DBReplayInfo;
+
+// Run telemetry: one row per finished run plus per-phase, per-enemy-type and
+// per-powerup-type detail rows (only types that occurred are stored)
+#define DB_RUN_MAX_PHASES 16
+#define DB_RUN_MAX_ENEMY_TYPES 16
+#define DB_RUN_MAX_POWERUP_TYPES 8
+#define DB_RUN_NAME_LENGTH 32
+
+typedef enum {
+    DB_RUN_DEATH = 0,           // Player destroyed (includes the boss escape)
+    DB_RUN_VICTORY = 1,         // All levels survived
+    DB_RUN_ABANDONED = 2        // Left or restarted before the game was over
+} DBRunOutcome;
+
+typedef struct {
+    int level;
+    float startTime;            // Game time the phase started
+    float duration;             // Seconds spent in the phase
+    int score;                  // Score gained during the phase
+    int kills;                  // Enemies destroyed during the phase
+} DBRunPhase;
+
+typedef struct {
+    char name[DB_RUN_NAME_LENGTH];  // Enemy type name (GetEnemyTypeName)
+    int kills;
+    int damage;                 // Damage dealt to enemies of this type
+} DBRunEnemyStats;
+
+typedef struct {
+    char name[DB_RUN_NAME_LENGTH];  // Powerup name (GetPowerupName)
+    int collected;
+} DBRunPowerupStats;
+
+typedef struct {
+    int id;                     // Assigned when stored
+    long timestamp;             // Set by DB_RecordRun
+    DifficultyLevel difficulty;
+    int score;
+    float duration;             // Game time in seconds
+    int levelReached;
+    DBRunOutcome outcome;
+    char deathCause[256];
+    int frameCount;             // Gameplay frames measured
+    float frameTimeP50;         // Frame time percentiles in milliseconds
+    float frameTimeP90;
+    float frameTimeP99;
+    float frameTimeMax;
+    DBRunPhase phases[DB_RUN_MAX_PHASES];
+    int phaseCount;
+    DBRunEnemyStats enemies[DB_RUN_MAX_ENEMY_TYPES];
+    int enemyTypeCount;
+    DBRunPowerupStats powerups[DB_RUN_MAX_POWERUP_TYPES];
+    int powerupTypeCount;
+} DBRunRecord;
+
+// Aggregates over every stored run (stats screen)
+typedef struct {
+    int runCount;
+    int victories;
+    int deaths;
+    int abandoned;
+    int bestScore;
+    float averageScore;
+    float totalPlayTime;        // Seconds
+    float longestRun;           // Seconds
+    float averageFrameTimeP99;  // Milliseconds
+} DBRunTotals;
+
+typedef struct {
+    int level;
+    int runs;                   // Runs that reached the level
+    float averageDuration;
+    float averageScore;
+    float averageKills;
+} DBRunPhaseStats;
+
+// Finished background write, delivered by DB_Update
+typedef enum {
+    DB_WRITE_SETTINGS = 0,
+    DB_WRITE_HIGH_SCORE,
+    DB_WRITE_RUN
+} DBWriteType;
+
+typedef struct {
+    DBWriteType type;
+    bool success;
+    int coalesced;              // DB_SaveSettings calls merged into this write (1 otherwise)
+    double durationMs;          // Transaction time on the writer thread
+    HighScoreEntry highScore;   // Stored entry with its id (DB_WRITE_HIGH_SCORE only)
+    int replayId;               // Stored replay id, 0 if none (DB_WRITE_HIGH_SCORE only)
+    int runId;                  // Stored run id (DB_WRITE_RUN only)
+} DBWriteResult;
+
+typedef void (*DBWriteCallback)(const DBWriteResult* result, void* userData);
+
 // Database initialization and cleanup
+// DB_Cleanup writes everything still queued before closing and reports it to the write callback.
+// Call the DB_* functions from one thread (the game loop); writes run on a background thread.
 bool DB_Init(void);
 void DB_Cleanup(void);
 
+// Background writes: DB_SaveSettings, DB_AddHighScore and DB_RecordRun only queue the write and
+// return immediately. DB_Update (once per frame) calls the callback for finished writes.
+void DB_SetWriteCallback(DBWriteCallback callback, void* userData);
+void DB_Update(void);
+
 // Settings functions
 bool DB_LoadSettings(UserSettings* settings);
 bool DB_SaveSettings(const UserSettings* settings);
 
 // High score functions
+// Each difficulty's leaderboard is read from SQLite once and then kept in memory:
+// DB_GetHighScores and DB_IsHighScore never query the database after the first call,
+// and DB_AddHighScore updates the cached leaderboard in place
 bool DB_AddHighScore(const char* playerName, int score, DifficultyLevel difficulty);
 bool DB_GetHighScores(DifficultyLevel difficulty, HighScoreEntry* entries, int maxEntries, int* outCount);
 bool DB_IsHighScore(int score, DifficultyLevel difficulty);
 
-// Utility function to get the database file path
+// Leaderboard queries over every stored score (ties rank by age, oldest first)
+// These read SQLite directly: counts come from per-bucket score totals, so a rank or page
+// costs a bucket walk plus one bucket's scores however long the history is. A score queued
+// by DB_AddHighScore is seen once its write has completed.
+int DB_GetHighScoreCount(DifficultyLevel difficulty);
+int DB_GetScoreRank(int score, DifficultyLevel difficulty);     // 1 + higher scores, 0 on error
+bool DB_GetHighScorePage(DifficultyLevel difficulty, int page, int pageSize,
+                         HighScoreEntry* entries, int* outCount, int* outTotal);   // entries holds pageSize
+bool DB_GetHighScoreNeighbors(int score, DifficultyLevel difficulty, int radius,
+                              HighScoreEntry* entries, int maxEntries, int* outCount, int* outFirstPosition);
+
+// Bulk changes (synchronous, one transaction; the cached leaderboards are reloaded)
+// DB_ImportHighScores stamps entries whose timestamp is 0 with the current time.
+bool DB_ImportHighScores(const HighScoreEntry* entries, int count);
+bool DB_ClearHighScores(void);
+
+// Replays
+// DB_AddHighScoreWithReplay queues the score and its replay; the writer stores both in the same
+// transaction, streaming replayData (malloc'd, always freed by the database) into the blob in
+// chunks. DB_ReadReplayData reads a byte range of the blob the same way, so a playback never
+// needs the whole replay in memory.
+bool DB_AddHighScoreWithReplay(const char* playerName, int score, DifficultyLevel difficulty,
+                               const DBReplayInfo* replay, unsigned char* replayData);
+bool DB_GetReplayInfo(int replayId, DBReplayInfo* info);
+bool DB_GetHighScoreReplay(int highScoreId, DBReplayInfo* info);
+bool DB_ReadReplayData(int replayId, int offset, void* buffer, int size, int* outRead);  // outRead 0 = end
+
+// Run telemetry functions
+// DB_RecordRun queues the run; the writer stores it and its detail rows in one transaction.
+// The aggregate queries read SQLite directly (call them when a stats screen opens, not every
+// frame) and see a just-recorded run only once its write has completed.
+bool DB_RecordRun(const DBRunRecord* run);
+bool DB_GetRunTotals(DBRunTotals* totals);
+bool DB_GetEnemyTypeStats(DBRunEnemyStats* entries, int maxEntries, int* outCount);     // Most kills first
+bool DB_GetPowerupStats(DBRunPowerupStats* entries, int maxEntries, int* outCount);     // Most collected first
+bool DB_GetPhaseStats(DBRunPhaseStats* entries, int maxEntries, int* outCount);         // By level
+bool DB_GetRecentRuns(DBRunRecord* runs, int maxRuns, int* outCount);                   // Newest first, no detail rows
+
+// Utility functions for the database file path (DB_SetDatabasePath must come before DB_Init)
+bool DB_SetDatabasePath(const char* path);
 const char* DB_GetDatabasePath(void);
 
 #endif // DATABASE_H
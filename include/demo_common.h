@@ -29,12 +29,6 @@ Camera2D DemoCommon_InitCamera(float width, float height);
 // Game System Initialization
 // ============================================================================
 
-/**
- * Initialize game type systems (enemy types, projectile types)
- * Call this once at the start of any demo that uses enemies or projectiles
- */
-void DemoCommon_InitGameTypes(void);
-
 /**
  * Initialize a bullets array for player weapons
  * @param bullets Pointer to bullets array
@@ -57,7 +51,8 @@ void DemoCommon_InitEnemiesArray(EnemyEx* enemies, int count);
 void DemoCommon_InitProjectilesArray(Projectile* projectiles, int count);
 
 /**
- * Allocate and initialize an explosion system
+ * Allocate and initialize an explosion system with MAX_EXPLOSIONS slots
+ * Release with CleanupExplosionSystem, then free
  * @return Pointer to allocated and initialized ExplosionSystem
  */
 ExplosionSystem* DemoCommon_CreateExplosionSystem(void);
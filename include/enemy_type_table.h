@@ -0,0 +1,51 @@
+#ifndef ENEMY_TYPE_TABLE_H
+#define ENEMY_TYPE_TABLE_H
+
+/**
+ * Enemy Type Table - Single source of truth for enemy types
+ *
+ * The EnemyType enum and the read-only enemyTypes[] definitions are both
+ * generated from this list, so adding a row here is all a new type needs.
+ *
+ * X(id, name, size, health, speed, power, primaryColor, secondaryColor, glowColor, resistance, symbol)
+ */
+
+// Brace initializer usable inside macro arguments and static const data
+#define TABLE_COLOR(r, g, b, a) { r, g, b, a }
+
+// Compile-time check (C99 has no _Static_assert): fails with a negative array size
+#define TABLE_STATIC_ASSERT(condition, name) typedef char name[(condition) ? 1 : -1]
+
+#define ENEMY_TYPE_TABLE(X) \
+    /* GRUNT - Basic enemy, small and weak but fast */ \
+    X(ENEMY_GRUNT,   "Grunt",   0.8f,    1, 1.2f, 10, \
+      TABLE_COLOR(200, 50, 50, 255),   TABLE_COLOR(150, 30, 30, 255),   TABLE_COLOR(255, 100, 100, 128), 0.0f, "▲") \
+    /* TANK - Large, slow, very high health (20 hits - heavy assault platform) */ \
+    X(ENEMY_TANK,    "Tank",    2.0f,   20, 0.5f, 30, \
+      TABLE_COLOR(80, 80, 100, 255),   TABLE_COLOR(60, 60, 80, 255),    TABLE_COLOR(120, 120, 150, 128), 0.2f, "■") \
+    /* SPEEDER - Very fast, low health */ \
+    X(ENEMY_SPEEDER, "Speeder", 0.6f,    1, 2.5f, 15, \
+      TABLE_COLOR(255, 200, 0, 255),   TABLE_COLOR(255, 150, 0, 255),   TABLE_COLOR(255, 255, 100, 128), 0.0f, "»") \
+    /* ZIGZAG - Medium stats, erratic movement */ \
+    X(ENEMY_ZIGZAG,  "Zigzag",  1.0f,    2, 1.0f, 20, \
+      TABLE_COLOR(0, 200, 100, 255),   TABLE_COLOR(0, 150, 75, 255),    TABLE_COLOR(100, 255, 150, 128), 0.1f, "◊") \
+    /* BOMBER - Large, dangerous (6 hits per flight plan) */ \
+    X(ENEMY_BOMBER,  "Bomber",  1.5f,    6, 0.8f, 40, \
+      TABLE_COLOR(150, 50, 200, 255),  TABLE_COLOR(100, 30, 150, 255),  TABLE_COLOR(200, 100, 255, 128), 0.1f, "◉") \
+    /* SHIELD - Protective shield (7 hits total: 3 for shield + 4 for enemy) */ \
+    X(ENEMY_SHIELD,  "Shield",  1.2f,    7, 0.9f, 25, \
+      TABLE_COLOR(0, 150, 200, 255),   TABLE_COLOR(0, 100, 150, 255),   TABLE_COLOR(100, 200, 255, 128), 0.3f, "◎") \
+    /* SWARM - Small, appears in groups */ \
+    X(ENEMY_SWARM,   "Swarm",   0.5f,    1, 1.5f,  8, \
+      TABLE_COLOR(255, 100, 0, 255),   TABLE_COLOR(200, 80, 0, 255),    TABLE_COLOR(255, 150, 50, 128),  0.0f, "•") \
+    /* ELITE - Strong all-around (5 hits - balanced challenge) */ \
+    X(ENEMY_ELITE,   "Elite",   1.3f,    5, 1.3f, 35, \
+      TABLE_COLOR(200, 200, 0, 255),   TABLE_COLOR(150, 150, 0, 255),   TABLE_COLOR(255, 255, 200, 128), 0.2f, "★") \
+    /* GHOST - Phases in and out of visibility */ \
+    X(ENEMY_GHOST,   "Ghost",   1.1f,    2, 1.1f, 22, \
+      TABLE_COLOR(150, 150, 255, 180), TABLE_COLOR(100, 100, 200, 180), TABLE_COLOR(200, 200, 255, 100), 0.4f, "◈") \
+    /* BOSS - Very large and powerful (no shield, massive health pool) */ \
+    X(ENEMY_BOSS,    "Boss",    3.0f, 1000, 0.6f, 50, \
+      TABLE_COLOR(150, 0, 0, 255),     TABLE_COLOR(100, 0, 0, 255),     TABLE_COLOR(255, 50, 50, 128),   0.3f, "✦")
+
+#endif // ENEMY_TYPE_TABLE_H
@@ -2,19 +2,13 @@
 #define ENEMY_TYPES_H
 
 #include "types.h"
+#include "enemy_type_table.h"
 
-// Enemy type enumeration
+// Enemy type enumeration (generated from ENEMY_TYPE_TABLE)
 typedef enum {
-    ENEMY_GRUNT,        // Basic enemy - small, weak, fast
-    ENEMY_TANK,         // Large, slow, high health
-    ENEMY_SPEEDER,      // Very fast, low health
-    ENEMY_ZIGZAG,       // Medium stats, zigzag movement
-    ENEMY_BOMBER,       // Large, drops bombs
-    ENEMY_SHIELD,       // Has a protective shield
-    ENEMY_SWARM,        // Small, appears in groups
-    ENEMY_ELITE,        // Strong all-around enemy
-    ENEMY_GHOST,        // Phases in and out of visibility
-    ENEMY_BOSS,         // Boss enemy - very large and powerful
+#define X(id, ...) id,
+    ENEMY_TYPE_TABLE(X)
+#undef X
     ENEMY_TYPE_COUNT
 } EnemyType;
 
@@ -23,6 +17,11 @@ typedef enum {
 #define BOSS_SHIELD_REGEN_TIME 5.0f  // Time in seconds before shield regenerates
 #define BOSS_BASE_HEALTH 500         // Boss base health without shield
 
+// Enemy sprite sheet (written by generate_enemy_sprites): one cell per type, in enum order
+#define ENEMY_SPRITESHEET_PATH "assets/sprites/enemy_spritesheet.png"
+#define ENEMY_SPRITE_SIZE 64
+#define ENEMY_SPRITES_PER_ROW 5
+
 // Enemy type definition structure
 typedef struct {
     EnemyType type;
@@ -41,6 +40,7 @@ typedef struct {
 // Extended enemy structure with type information
 typedef struct EnemyEx {
     Vector2 position;
+    Vector2 previousPosition;   // Position at the start of the tick (swept collisions)
     Rectangle bounds;
     Color color;
     bool active;
@@ -81,15 +81,41 @@ typedef struct EnemyEx {
     bool isEscaping;      // Boss is escaping off screen
 } EnemyEx;
 
+// Enemy type definitions (generated from ENEMY_TYPE_TABLE, read-only)
+// Visible in every translation unit so per-type stats can be constant-folded
+static const EnemyTypeDefinition enemyTypes[ENEMY_TYPE_COUNT] = {
+#define X(id, typeName, sizeMul, hp, speedMul, pwr, primary, secondary, glow, resist, sym) \
+    [id] = { .type = id, .name = typeName, .size = sizeMul, .health = hp, .speed = speedMul, \
+             .power = pwr, .primaryColor = primary, .secondaryColor = secondary, \
+             .glowColor = glow, .resistance = resist, .symbol = sym },
+    ENEMY_TYPE_TABLE(X)
+#undef X
+};
+
+// Accessors
+static inline const EnemyTypeDefinition* GetEnemyTypeDefinition(EnemyType type) {
+    if ((unsigned int)type >= ENEMY_TYPE_COUNT) {
+        return &enemyTypes[ENEMY_GRUNT];  // Default to grunt
+    }
+    return &enemyTypes[type];
+}
+
+static inline const char* GetEnemyTypeName(EnemyType type) {
+    return GetEnemyTypeDefinition(type)->name;
+}
+
+static inline Color GetEnemyTypeColor(EnemyType type) {
+    return GetEnemyTypeDefinition(type)->primaryColor;
+}
+
+// Radius a type is drawn with in its sprite cell (the sprite's counterpart of enemy->radius)
+static inline float GetEnemySpriteRadius(EnemyType type) {
+    float radius = ENEMY_SPRITE_SIZE * 0.35f * GetEnemyTypeDefinition(type)->size;
+    return radius < ENEMY_SPRITE_SIZE * 0.45f ? radius : ENEMY_SPRITE_SIZE * 0.45f;
+}
+
 // Function declarations
-void InitEnemyTypes(void);
-const EnemyTypeDefinition* GetEnemyTypeDefinition(EnemyType type);
 void InitializeEnemyFromType(EnemyEx* enemy, EnemyType type, float x, float y);
 void DrawEnemyEx(const EnemyEx* enemy);
-const char* GetEnemyTypeName(EnemyType type);
-Color GetEnemyTypeColor(EnemyType type);
-
-// Global enemy type definitions
-extern EnemyTypeDefinition enemyTypes[ENEMY_TYPE_COUNT];
 
 #endif // ENEMY_TYPES_H
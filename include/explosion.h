@@ -4,7 +4,7 @@
 #include "raylib.h"
 #include <stdbool.h>
 
-// Maximum number of explosions and particles
+// Default number of explosions, and particles per explosion
 #define MAX_EXPLOSIONS 50
 #define MAX_PARTICLES_PER_EXPLOSION 30
 #define MAX_DEBRIS_PIECES 20
@@ -78,8 +78,10 @@ typedef struct {
 
 // Explosion system structure
 typedef struct ExplosionSystem {
-    Explosion explosions[MAX_EXPLOSIONS];
+    Explosion* explosions;
+    int capacity;
     int activeCount;
+    float cleanupTimer;   // Time since activeCount was last recounted
     
     // Screen shake for big explosions
     float screenShakeIntensity;
@@ -88,8 +90,16 @@ typedef struct ExplosionSystem {
 } ExplosionSystem;
 
 // Function declarations
-void InitExplosionSystem(ExplosionSystem* system);
+bool InitExplosionSystem(ExplosionSystem* system, int capacity);  // false if the pool can't be allocated
+void CleanupExplosionSystem(ExplosionSystem* system);
 void UpdateExplosionSystem(ExplosionSystem* system, float deltaTime);
+
+// UpdateExplosionSystem in parts, for running the explosions in parallel chunks:
+// the shake draws random numbers, each range touches only its own explosions and
+// returns how many ended, and the finish step settles activeCount afterwards
+void UpdateExplosionShake(ExplosionSystem* system, float deltaTime);
+int UpdateExplosionRange(ExplosionSystem* system, int begin, int end, float deltaTime);
+void FinishExplosionUpdate(ExplosionSystem* system, int ended, float deltaTime);
 void DrawExplosions(const ExplosionSystem* system);
 
 // Create different types of explosions
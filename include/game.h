@@ -2,10 +2,34 @@
 #define GAME_H
 
 #include "types.h"
+#include "database.h"
 
 // Initialize game state
 void InitGame(Game* game);
 
+// Level time to start at on the next InitGame (command line --seek)
+void SetGameStartTime(float levelTime);
+
+// Replay to play back on the next InitGame instead of reading the devices (command line --replay)
+void SetGameReplay(int replayId);
+
+// Run every game as a stress test (command line --stress; 0 = default enemy / projectile targets)
+void SetGameStressTest(int enemies, int projectiles);
+
+// Play every game in practice mode: rewind with BACKSPACE, retry the level from its start (command line --practice)
+void SetGamePractice(bool enabled);
+
+// Finish the run's input recording for storing with its high score.
+// Returns false if the run was not recorded (playback, debug seek, out of memory);
+// otherwise *outData is malloc'd and owned by the caller.
+bool TakeGameReplay(Game* game, DBReplayInfo* info, unsigned char** outData);
+
+// Jump the current level to a time, restoring the enemies that should be on screen
+bool SeekGameToTime(Game* game, float levelTime);
+
+// Put the game back into a snapshot's state (the run is no longer recorded)
+bool RestoreGameSnapshot(Game* game, const GameSnapshot* snapshot);
+
 // Update game logic
 void UpdateGame(Game* game);
 
@@ -16,14 +40,10 @@ void CleanupGame(Game* game);
 void UpdateGameSpeed(Game* game);
 
 // Enemy management functions
-void UpdateEnemies(Game* game);
 void DrawEnemies(const Game* game, bool showHitbox);
 int CountActiveEnemies(const Game* game);
 void FireEnemyProjectile(Game* game, struct EnemyEx* enemy);
 
-// Projectile management functions  
-void UpdateProjectiles(Game* game);
-
 // Audio management functions
 void SetGameMusicVolume(Game* game, float volume);
 
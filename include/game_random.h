@@ -0,0 +1,52 @@
+#ifndef GAME_RANDOM_H
+#define GAME_RANDOM_H
+
+#include <stdint.h>
+
+/**
+ * Game Random - The simulation's random number generator
+ *
+ * Everything that can change the outcome of a run (spawn variation, boss
+ * movement, explosions, powerup drops, the starfield) draws from this one
+ * generator, seeded by InitGame. Its state is a single 64-bit value (PCG32),
+ * so game snapshots can save and restore it exactly, which the raylib and C
+ * library generators do not allow.
+ *
+ * There is one generator for the whole process and no locking: jobs that draw
+ * from it must be ordered in the job graph (see job_system.h).
+ */
+
+/**
+ * Restart the generator from a seed
+ *
+ * @param seed Seed (the run's seed)
+ */
+void GameRandom_Seed(unsigned int seed);
+
+/**
+ * Random integer in [min, max] (same range rules as raylib's GetRandomValue)
+ *
+ * @param min Lowest value
+ * @param max Highest value (swapped with min if smaller)
+ * @return Random value
+ */
+int GameRandom_Int(int min, int max);
+
+/**
+ * @return Random float in [0, 1)
+ */
+float GameRandom_Float(void);
+
+/**
+ * @return Generator state (for snapshots)
+ */
+uint64_t GameRandom_GetState(void);
+
+/**
+ * Continue from a saved state
+ *
+ * @param state State from GameRandom_GetState
+ */
+void GameRandom_SetState(uint64_t state);
+
+#endif // GAME_RANDOM_H
@@ -0,0 +1,163 @@
+#ifndef GAME_SNAPSHOT_H
+#define GAME_SNAPSHOT_H
+
+#include "types.h"
+#include "constants.h"
+#include <stdbool.h>
+
+/**
+ * Game Snapshot - Full simulation state in one buffer
+ *
+ * A snapshot holds everything StepGame reads and writes: the game's run state
+ * (score, clocks, scroll speed, boss escape sequence, level transition), the
+ * player ship, the wave system's cursor and timers, the explosion and powerup
+ * systems, the random generator and the bullet, enemy, projectile, star,
+ * explosion and powerup pools. Capturing is a handful of memcpy calls into a
+ * buffer that is reused from one capture to the next; restoring copies the
+ * same bytes back, so the game continues exactly as it would have from the
+ * moment of the capture.
+ *
+ * Not included: the input devices, music, telemetry, replay recording and
+ * the stress test. A snapshot only restores into a game with the same pool
+ * sizes; if it was taken in another level, that level's wave plan is loaded
+ * first.
+ *
+ * Deltas: two snapshots of the same game differ in a few percent of their
+ * bytes from one tick to the next. A delta stores the XOR of the two buffers
+ * as runs: a varint count of unchanged bytes, a varint count of changed bytes
+ * and the changed bytes. XOR works both ways, so one delta turns either
+ * snapshot into the other.
+ *
+ * A history keeps the newest snapshot in full and one delta per older tick,
+ * which is what rewinding steps back through.
+ */
+
+#define GAME_REWIND_SECONDS 10                              // Practice mode rewind window
+#define GAME_REWIND_TICKS (GAME_REWIND_SECONDS * SIM_TICK_RATE)
+
+struct GameSnapshot {
+    unsigned char* data;            // Grown as needed, reused by later captures
+    int size;                       // 0 until the first capture
+    int capacity;
+};
+
+typedef struct GameSnapshotDelta {
+    unsigned char* data;
+    int size;
+    int capacity;
+} GameSnapshotDelta;
+
+struct GameSnapshotHistory {
+    GameSnapshot latest;            // Newest state in full
+    GameSnapshotDelta* deltas;      // Ring: each one turns a state into the state one tick older
+    int first;                      // Oldest delta
+    int count;                      // Deltas held (ticks the history can step back)
+    int capacity;
+    GameSnapshot next;              // Capture buffer for the state being pushed
+    GameSnapshotDelta encoded;      // Encoding buffer (worst-case size)
+};
+
+/**
+ * Copy the game's simulation state into a snapshot
+ *
+ * @param snapshot Snapshot to overwrite (zeroed or from an earlier capture)
+ * @param game Game to capture
+ * @return false if the buffer could not be allocated
+ */
+bool GameSnapshot_Capture(GameSnapshot* snapshot, const Game* game);
+
+/**
+ * Put the game back into a captured state
+ *
+ * @param snapshot Captured state
+ * @param game Game with the same pool sizes as when it was captured
+ * @return false if the snapshot does not fit the game (it is left unchanged)
+ */
+bool GameSnapshot_Restore(const GameSnapshot* snapshot, Game* game);
+
+/**
+ * Free a snapshot's buffer (it can be captured into again)
+ *
+ * @param snapshot Snapshot
+ */
+void GameSnapshot_Free(GameSnapshot* snapshot);
+
+/**
+ * Find where two snapshots first differ (desync hunting)
+ *
+ * @param a First snapshot
+ * @param b Second snapshot of the same game
+ * @param where Filled with the part that differs, e.g. "enemies[12] byte 40" (may be NULL)
+ * @param whereSize Size of where
+ * @return Byte offset of the first difference, -1 if the snapshots are equal
+ */
+int GameSnapshot_FindDifference(const GameSnapshot* a, const GameSnapshot* b, char* where, int whereSize);
+
+/**
+ * Encode the difference between two snapshots of the same game
+ *
+ * @param delta Delta to overwrite
+ * @param from One snapshot
+ * @param to The other snapshot (same size)
+ * @return false if the sizes differ or the buffer could not be allocated
+ */
+bool GameSnapshot_EncodeDelta(GameSnapshotDelta* delta, const GameSnapshot* from, const GameSnapshot* to);
+
+/**
+ * Turn a snapshot into the other snapshot of a delta
+ *
+ * @param snapshot Either snapshot the delta was encoded from (changed in place)
+ * @param delta Delta between the two
+ * @return false if the delta does not fit the snapshot
+ */
+bool GameSnapshot_ApplyDelta(GameSnapshot* snapshot, const GameSnapshotDelta* delta);
+
+/**
+ * Free a delta's buffer
+ *
+ * @param delta Delta
+ */
+void GameSnapshot_FreeDelta(GameSnapshotDelta* delta);
+
+/**
+ * Start an empty history
+ *
+ * @param history History to set up
+ * @param ticks Ticks it can step back
+ * @return false if it could not be allocated
+ */
+bool GameSnapshotHistory_Init(GameSnapshotHistory* history, int ticks);
+
+/**
+ * Add the game's current state (the oldest tick is dropped when full)
+ *
+ * @param history History
+ * @param game Game after a tick
+ * @return false if the state could not be stored (the history then starts over)
+ */
+bool GameSnapshotHistory_Push(GameSnapshotHistory* history, const Game* game);
+
+/**
+ * Go back in the history, dropping the newer states
+ *
+ * @param history History
+ * @param ticks Ticks to step back (fewer if the history is shorter)
+ * @return State to restore, NULL if nothing was pushed yet
+ */
+const GameSnapshot* GameSnapshotHistory_StepBack(GameSnapshotHistory* history, int ticks);
+
+/**
+ * Drop every state but keep the buffers
+ *
+ * @param history History
+ */
+void GameSnapshotHistory_Clear(GameSnapshotHistory* history);
+
+/**
+ * Free the history
+ *
+ * @param history History
+ */
+void GameSnapshotHistory_Free(GameSnapshotHistory* history);
+
+#endif // GAME_SNAPSHOT_H
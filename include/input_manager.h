@@ -11,12 +11,25 @@ typedef enum {
     INPUT_METHOD_GAMEPAD
 } ActiveInputMethod;
 
+// Input for one simulation tick: a bit per GameAction held down, and above them
+// the weapon hotkey pressed (1-6 for KEY_ONE..KEY_SIX, 0 = none).
+// Gameplay reads only this state while a tick runs, so replaying recorded
+// states reproduces a run exactly; pressed/released come from the previous tick.
+typedef unsigned int InputTickState;
+
+#define INPUT_TICK_ACTION_MASK ((1u << ACTION_COUNT) - 1u)
+#define INPUT_TICK_HOTKEY_SHIFT ACTION_COUNT
+#define INPUT_TICK_HOTKEY_MASK (7u << INPUT_TICK_HOTKEY_SHIFT)
+
 // Input manager state
 typedef struct InputManager {
     InputConfig* config;
     int gamepadId;  // Which gamepad to use (0 by default)
     bool gamepadAvailable;
     ActiveInputMethod activeInputMethod;  // Last used input method
+    bool tickActive;                      // Actions are answered from tickState
+    InputTickState tickState;
+    InputTickState previousTickState;
 } InputManager;
 
 // Initialize input manager with a configuration
@@ -34,6 +47,17 @@ bool InputManager_IsActionDown(const InputManager* manager, GameAction action);
 // Check if an action was just released this frame
 bool InputManager_IsActionReleased(const InputManager* manager, GameAction action);
 
+// Read the devices into a tick state: actions held and the weapon hotkey pressed this frame
+// (call outside a tick)
+InputTickState InputManager_SampleTick(const InputManager* manager);
+
+// Answer the IsAction* queries from a tick state until InputManager_EndTick
+void InputManager_BeginTick(InputManager* manager, InputTickState state, InputTickState previous);
+void InputManager_EndTick(InputManager* manager);
+
+// Weapon hotkey pressed (1-6), 0 if none
+int InputManager_GetWeaponHotkey(const InputManager* manager);
+
 // Detect any input and return the binding (for rebinding controls)
 // Returns true if an input was detected, false otherwise
 bool InputManager_DetectInput(InputBinding* outBinding);
@@ -0,0 +1,134 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <stdbool.h>
+
+/**
+ * Job System - Runs a graph of jobs on a pool of worker threads
+ *
+ * A JobGraph is built for one piece of work (the simulation stages of a tick),
+ * run once with JobGraph_Run and then thrown away. Jobs are plain functions
+ * over a range; JobGraph_AddRange splits a long loop into chunks that run in
+ * parallel. A job starts only after every job it depends on has finished, so
+ * two jobs that touch the same data (or draw from the random generator) must
+ * be ordered with JobGraph_Depend; jobs with no path between them may run at
+ * the same time, in any order.
+ *
+ * Scheduling: every thread, the caller of JobGraph_Run included, has its own
+ * queue. A thread runs the newest job in its own queue (the successors it just
+ * released, while their data is still in cache) and steals the oldest job from
+ * another queue when its own is empty. Ticks have a few dozen jobs, so one lock
+ * guards all queues instead of lock-free deques.
+ *
+ * Without JobSystem_Init, or with 0 workers, JobGraph_Run does everything on
+ * the calling thread.
+ */
+
+#define JOB_MAX_WORKERS 15          // Worker threads (the calling thread is one more)
+#define JOB_MAX_NODES 512           // Jobs per graph, chunks and range bookends included
+#define JOB_MAX_EDGES 1024          // Dependencies per graph
+#define JOB_MAX_CHUNKS 64           // Chunks per range (larger chunks beyond that)
+
+// Job body: processes items [begin, end) of its range (0, 0 for a single job)
+typedef void (*JobFunc)(void* data, int begin, int end);
+
+typedef struct {
+    JobFunc func;                   // NULL for range bookends
+    void* data;
+    int begin;
+    int end;
+    int join;                       // Node that finishes this job (end node of a range)
+    int firstEdge;                  // Successors (linked through edges)
+    int pending;                    // Unfinished dependencies
+    double milliseconds;            // Time spent in func (timed graphs only)
+} JobNode;
+
+typedef struct {
+    int to;
+    int next;
+} JobEdge;
+
+typedef struct JobGraph {
+    JobNode nodes[JOB_MAX_NODES];
+    int nodeCount;
+    JobEdge edges[JOB_MAX_EDGES];
+    int edgeCount;
+    int remaining;                  // Nodes not yet finished while running
+    bool timed;                     // Measure every job (set after JobGraph_Init)
+} JobGraph;
+
+/**
+ * Start the worker threads
+ *
+ * @param workerCount Threads besides the caller (negative = one per extra core, capped at JOB_MAX_WORKERS)
+ * @return false if no thread could be started (graphs then run on the caller)
+ */
+bool JobSystem_Init(int workerCount);
+
+/**
+ * Stop and join the worker threads
+ */
+void JobSystem_Shutdown(void);
+
+/**
+ * @return Worker threads running (0 = single-threaded)
+ */
+int JobSystem_GetWorkerCount(void);
+
+/**
+ * Start an empty graph
+ *
+ * @param graph Graph to reset
+ */
+void JobGraph_Init(JobGraph* graph);
+
+/**
+ * Add a single job
+ *
+ * @param graph Graph
+ * @param func Job body, called as func(data, 0, 0)
+ * @param data Passed to func
+ * @return Job handle, -1 if the graph is full
+ */
+int JobGraph_Add(JobGraph* graph, JobFunc func, void* data);
+
+/**
+ * Add a loop split into chunks of chunkSize items
+ *
+ * @param graph Graph
+ * @param func Chunk body, called as func(data, begin, end)
+ * @param data Passed to func
+ * @param count Items in the loop
+ * @param chunkSize Items per chunk (raised if the loop would need more than JOB_MAX_CHUNKS)
+ * @return Handle for the whole range, -1 if the graph is full
+ */
+int JobGraph_AddRange(JobGraph* graph, JobFunc func, void* data, int count, int chunkSize);
+
+/**
+ * Make a job wait for another one (for a range: all of its chunks)
+ *
+ * @param graph Graph
+ * @param job Job that has to wait
+ * @param dependency Job that has to finish first
+ */
+void JobGraph_Depend(JobGraph* graph, int job, int dependency);
+
+/**
+ * Run every job of the graph and return once all have finished
+ * The calling thread works on the graph too. A graph runs once.
+ *
+ * @param graph Graph
+ */
+void JobGraph_Run(JobGraph* graph);
+
+/**
+ * Time a job spent running, after JobGraph_Run of a timed graph
+ * For a range this is the sum over its chunks (CPU time, not wall time).
+ *
+ * @param graph Graph that ran with timed set
+ * @param job Job handle
+ * @return Milliseconds, 0 if the graph was not timed
+ */
+double JobGraph_GetMilliseconds(const JobGraph* graph, int job);
+
+#endif // JOB_SYSTEM_H
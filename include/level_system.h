@@ -3,17 +3,20 @@
 
 #include "types.h"
 #include "wave_system.h"
+#include "bass_envelope.h"
 
 // Level configuration structure
 typedef struct LevelConfig {
     int levelNumber;
     const char* name;
     const char* audioPath;
-    const char* bassLogPath;     // Legacy field, may be NULL
+    const char* bassEnvelopePath;  // Precomputed bass track (.benv next to the audio by default)
+    BassEnvelope* bassEnvelope;    // Loaded envelope, NULL if the level has none
     float duration;              // Duration in seconds
     int targetScore;             // Score needed to unlock next level
     const char* description;
     const char* jsonFilePath;    // Path to the level's JSON file
+    PoolCapacity capacity;       // Entity pools the level needs (0 = default size)
 } LevelConfig;
 
 // Level manager structure
@@ -34,6 +37,13 @@ bool AdvanceToNextLevel(LevelManager* manager);
 void ResetToLevel(LevelManager* manager, int levelNumber);
 int GetTotalLevels(const LevelManager* manager);
 
+// Pool sizes for a run: the defaults, raised to what any level asks for
+// (pools are sized once per run so slot indices stay stable across levels)
+PoolCapacity GetRunPoolCapacity(const LevelManager* manager);
+
+// Bass at a music time for a level (silent sample if it has no envelope), O(1)
+BassSample GetLevelBassSample(const LevelConfig* level, float musicTime);
+
 // Level-specific wave plan loader from JSON
 SpawnEvent* LoadWaveplanFromJSON(const char* jsonFilePath, int* eventCount);
 
@@ -4,6 +4,7 @@
 #include "raylib.h"
 #include "input_config.h"
 #include "input_manager.h"
+#include "database.h"
 #include <stdbool.h>
 
 // Menu states
@@ -16,6 +17,7 @@ typedef enum {
     MENU_OPTIONS_CONTROLS,
     MENU_CREDITS,
     MENU_HIGH_SCORES,
+    MENU_RUN_STATS,     // Run telemetry aggregates (opened from the high scores screen)
     MENU_NAME_INPUT,
     MENU_GAME,
     MENU_PAUSE_CONFIRM  // Pause menu with exit confirmation
@@ -71,6 +73,8 @@ typedef struct {
     int nameLength;
     int pendingScore;
     int pendingDifficulty;
+    DBReplayInfo pendingReplayInfo;     // Replay of the run, stored with the score
+    unsigned char* pendingReplayData;   // NULL if the run has no replay (owned by the menu)
     bool nameInputActive;
     float nameInputBlink;
     
@@ -104,6 +108,7 @@ void DrawOptionsVideo(Menu* menu);
 void DrawOptionsGame(Menu* menu);
 void DrawOptionsControls(Menu* menu);
 void DrawHighScores(Menu* menu);
+void DrawRunStats(const Menu* menu);
 void DrawNameInput(Menu* menu);
 void DrawCredits(const Menu* menu);
 void DrawPauseConfirm(const Menu* menu);
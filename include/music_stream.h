@@ -0,0 +1,116 @@
+#ifndef MUSIC_STREAM_H
+#define MUSIC_STREAM_H
+
+#include <stdbool.h>
+
+/**
+ * Music Stream - Background music streamed from a dedicated audio thread
+ *
+ * The game thread never touches the raylib Music directly: play, pause,
+ * resume, stop, volume and seek requests go through a single-producer /
+ * single-consumer lock-free command queue that the audio thread drains
+ * before every UpdateMusicStream call. Long frames on the game thread
+ * (level loads, database writes) therefore no longer starve the stream.
+ *
+ * The audio thread also publishes the playback position, so the game
+ * clock can be disciplined against what is actually being heard.
+ *
+ * All functions are meant to be called from the game thread only.
+ */
+
+#define MUSIC_STREAM_THREADED true        // false = stream from the game loop (MusicStream_Update)
+#define MUSIC_STREAM_BUFFER_FRAMES 4096   // Frames per stream sub-buffer (0 = raylib default)
+#define MUSIC_STREAM_UPDATE_MS 5          // Audio thread wake-up period
+#define MUSIC_STREAM_HIGH_PRIORITY true   // Request real-time scheduling for the audio thread
+#define MUSIC_STREAM_QUEUE_SIZE 64        // Command queue capacity (power of two)
+
+typedef struct MusicStreamConfig {
+    bool threaded;            // Stream from a dedicated thread
+    int bufferFrames;         // Stream sub-buffer size in frames (0 = raylib default)
+    int updateIntervalMs;     // Audio thread wake-up period in milliseconds
+    bool highPriority;        // Try to raise the audio thread's scheduling priority
+} MusicStreamConfig;
+
+/**
+ * Default configuration (MUSIC_STREAM_* values)
+ *
+ * @return Configuration
+ */
+MusicStreamConfig MusicStream_DefaultConfig(void);
+
+/**
+ * Start the music streamer (call once, after InitAudioDevice)
+ *
+ * @param config Configuration (NULL = defaults)
+ * @return true on success (falls back to game-loop streaming if the thread cannot start)
+ */
+bool MusicStream_Init(const MusicStreamConfig* config);
+
+/**
+ * Unload any music and stop the audio thread
+ */
+void MusicStream_Shutdown(void);
+
+/**
+ * Load a music file (packed or loose) and hand it to the streamer
+ * Replaces the current music, if any. The new music starts stopped.
+ *
+ * @param path Music file path
+ * @return true if the music was loaded
+ */
+bool MusicStream_Load(const char* path);
+
+/**
+ * Stop and unload the current music
+ */
+void MusicStream_Unload(void);
+
+/**
+ * Whether music is loaded
+ *
+ * @return true if loaded
+ */
+bool MusicStream_IsLoaded(void);
+
+/**
+ * Queue playback commands (applied by the audio thread)
+ */
+void MusicStream_Play(void);
+void MusicStream_Pause(void);
+void MusicStream_Resume(void);
+void MusicStream_Stop(void);
+
+/**
+ * Queue a volume change
+ *
+ * @param volume Volume (0.0 - 1.0)
+ */
+void MusicStream_SetVolume(float volume);
+
+/**
+ * Queue a seek
+ *
+ * @param position Position in seconds
+ */
+void MusicStream_Seek(float position);
+
+/**
+ * Stream from the game loop (only does work when not threaded)
+ */
+void MusicStream_Update(void);
+
+/**
+ * Whether the music is playing (not stopped or paused)
+ *
+ * @return true if playing
+ */
+bool MusicStream_IsPlaying(void);
+
+/**
+ * Current playback position, extrapolated from the last audio thread update
+ *
+ * @return Position in seconds (0 if nothing is loaded)
+ */
+float MusicStream_GetTime(void);
+
+#endif // MUSIC_STREAM_H
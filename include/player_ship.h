@@ -35,6 +35,7 @@ typedef struct {
 typedef struct PlayerShip {
     // Core properties
     Vector2 position;
+    Vector2 previousPosition;   // Position at the start of the tick (swept collisions)
     Vector2 velocity;
     Rectangle bounds;
     float rotation;         // Ship rotation for banking effects
@@ -46,7 +47,7 @@ typedef struct PlayerShip {
     float maxShield;
     float shieldRegenRate;
     float shieldRegenDelay; // Time before shield starts regenerating
-    float lastDamageTime;
+    float lastDamageTime;   // animTime of the last hit
     
     // Energy system
     float energy;           // Energy for abilities (0-100)
@@ -60,6 +61,8 @@ typedef struct PlayerShip {
     bool overheated;
     float cooldownTime;
     float fireTimer;        // Time since last shot
+    float shootTimer;       // Time until the normal fire modes can shoot again
+    float devastatingFireTimer; // Time until the next volley of the offensive special
     float chargeLevel;      // For charge beam (0-100)
     bool isCharging;
     
@@ -82,7 +85,7 @@ typedef struct PlayerShip {
     int trailIndex;
     
     // Animation
-    float animTime;         // General animation timer
+    float animTime;         // Ship clock: animation and the regen delays (advances with the simulation)
     float bankAngle;        // Banking angle when turning
     float enginePulse;      // Engine pulse effect
     
@@ -99,7 +102,7 @@ typedef struct PlayerShip {
     float specialAbilityHoldTimer;   // Timer for holding CTRL in defensive mode
     bool energyFull;                 // Cache whether energy is at max
     float energyDrainRate;           // Rate at which energy drains during special (per second)
-    float lastEnergyDepletionTime;   // Time when energy was last depleted to 0
+    float lastEnergyDepletionTime;   // animTime when energy was last depleted to 0
     float energyRegenDelay;          // Delay before energy starts regenerating after depletion
     
     // Stats
@@ -7,7 +7,7 @@
 #include "player_ship.h"
 #include <stdbool.h>
 
-// Maximum number of active powerups
+// Default number of powerup slots
 #define MAX_POWERUPS 20
 
 // Powerup types
@@ -47,14 +47,16 @@ typedef struct {
 
 // Powerup system
 struct PowerupSystem {
-    Powerup powerups[MAX_POWERUPS];
+    Powerup* powerups;
+    int capacity;
     int activePowerupCount;
     float totalPowerupsSpawned;
     float totalPowerupsCollected;
+    int collectedByType[POWERUP_TYPE_COUNT];  // Per-type collection counts (run telemetry)
 };
 
-// Initialize powerup system
-void InitPowerupSystem(PowerupSystem* system);
+// Initialize powerup system with room for capacity powerups (false if the pool can't be allocated)
+bool InitPowerupSystem(PowerupSystem* system, int capacity);
 
 // Update all powerups
 void UpdatePowerups(PowerupSystem* system, PlayerShip* player, float deltaTime);
@@ -71,6 +73,9 @@ void DropPowerupFromEnemy(PowerupSystem* system, const EnemyEx* enemy);
 // Check collision between player and powerups
 void CheckPowerupCollisions(PowerupSystem* system, PlayerShip* player, int* score);
 
+// Collect an active powerup: apply its effect and count it
+void CollectPowerup(PowerupSystem* system, int index, PlayerShip* player, int* score);
+
 // Apply powerup effect to player
 void ApplyPowerupEffect(PlayerShip* player, PowerupType type, int* score);
 
@@ -89,7 +94,7 @@ const char* GetPowerupName(PowerupType type);
 // Get powerup description
 const char* GetPowerupDescription(PowerupType type);
 
-// Cleanup powerup system
+// Cleanup powerup system (frees the pool)
 void CleanupPowerupSystem(PowerupSystem* system);
 
 #endif // POWERUP_H
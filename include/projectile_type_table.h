@@ -0,0 +1,65 @@
+#ifndef PROJECTILE_TYPE_TABLE_H
+#define PROJECTILE_TYPE_TABLE_H
+
+#include "enemy_type_table.h"
+
+/**
+ * Projectile Type Table - Single source of truth for projectiles and enemy weapons
+ *
+ * The ProjectileType enum, the read-only projectileTypes[] definitions and
+ * enemyWeapons[] configs are generated from these lists.
+ *
+ * X(id, name, speed, damage, size, hitboxRadius, primaryColor, secondaryColor, glowColor,
+ *   pattern, homingStrength, lifetime, piercing, explosive, explosionRadius)
+ */
+
+#define PROJECTILE_TYPE_TABLE(X) \
+    /* LASER - Fast, straight, basic projectile */ \
+    X(PROJECTILE_LASER,         "Laser",         500.0f, 10, 12.0f,  4.0f, \
+      TABLE_COLOR(255, 50, 50, 255),   TABLE_COLOR(255, 150, 150, 200), TABLE_COLOR(255, 200, 200, 100), \
+      PATTERN_STRAIGHT, 0.0f,   3.0f, false, false,  0.0f) \
+    /* PLASMA - Medium speed, slight homing */ \
+    X(PROJECTILE_PLASMA,        "Plasma",        300.0f, 20, 16.0f,  6.0f, \
+      TABLE_COLOR(100, 200, 255, 255), TABLE_COLOR(150, 220, 255, 200), TABLE_COLOR(200, 240, 255, 150), \
+      PATTERN_HOMING,   0.3f,   4.0f, false, false,  0.0f) \
+    /* MISSILE - Medium-fast, high damage, strong homing (long lifetime to reach screen edge) */ \
+    X(PROJECTILE_MISSILE,       "Missile",       280.0f, 50, 20.0f,  8.0f, \
+      TABLE_COLOR(100, 100, 100, 255), TABLE_COLOR(255, 150, 0, 255),   TABLE_COLOR(255, 200, 0, 150), \
+      PATTERN_HOMING,   0.7f, 999.0f, false, true,  30.0f) \
+    /* ENERGY ORB - Slow, area damage, despawns at screen edge */ \
+    X(PROJECTILE_ENERGY_ORB,    "Energy Orb",    150.0f, 35, 24.0f, 10.0f, \
+      TABLE_COLOR(200, 50, 255, 255),  TABLE_COLOR(150, 100, 255, 200), TABLE_COLOR(255, 150, 255, 150), \
+      PATTERN_WAVE,     0.0f, 999.0f, true,  true,  40.0f) \
+    /* PLAYER BULLET - Player's basic projectile, exactly 1 damage */ \
+    X(PROJECTILE_PLAYER_BULLET, "Player Bullet", 600.0f,  1,  8.0f,  3.0f, \
+      TABLE_COLOR(255, 255, 0, 255),   TABLE_COLOR(255, 200, 0, 200),   TABLE_COLOR(255, 255, 150, 100), \
+      PATTERN_STRAIGHT, 0.0f,   2.0f, false, false,  0.0f)
+
+/**
+ * Enemy weapons - one row per EnemyType (checked at compile time)
+ *
+ * X(enemyType, primaryProjectile, secondaryProjectile, fireRate, burstCount, spreadAngle)
+ */
+#define ENEMY_WEAPON_TABLE(X) \
+    /* GRUNT - Basic laser shots */ \
+    X(ENEMY_GRUNT,   PROJECTILE_LASER,      PROJECTILE_LASER,      1.0f, 1,   0.0f) \
+    /* TANK - Powerful missile barrage */ \
+    X(ENEMY_TANK,    PROJECTILE_MISSILE,    PROJECTILE_ENERGY_ORB, 0.6f, 3,  20.0f) \
+    /* SPEEDER - Rapid laser fire */ \
+    X(ENEMY_SPEEDER, PROJECTILE_LASER,      PROJECTILE_LASER,      3.0f, 3,  15.0f) \
+    /* ZIGZAG - Plasma shots with spread */ \
+    X(ENEMY_ZIGZAG,  PROJECTILE_PLASMA,     PROJECTILE_LASER,      1.5f, 2,  30.0f) \
+    /* BOMBER - Energy orbs */ \
+    X(ENEMY_BOMBER,  PROJECTILE_ENERGY_ORB, PROJECTILE_MISSILE,    0.8f, 1,   0.0f) \
+    /* SHIELD - Defensive plasma bursts in all directions */ \
+    X(ENEMY_SHIELD,  PROJECTILE_PLASMA,     PROJECTILE_PLASMA,     1.2f, 6, 360.0f) \
+    /* SWARM - Rapid weak lasers */ \
+    X(ENEMY_SWARM,   PROJECTILE_LASER,      PROJECTILE_LASER,      2.0f, 1,   0.0f) \
+    /* ELITE - Mixed arsenal */ \
+    X(ENEMY_ELITE,   PROJECTILE_PLASMA,     PROJECTILE_MISSILE,    2.0f, 4,  45.0f) \
+    /* GHOST - Phasing plasma shots */ \
+    X(ENEMY_GHOST,   PROJECTILE_PLASMA,     PROJECTILE_ENERGY_ORB, 1.0f, 2,  20.0f) \
+    /* BOSS - Everything! */ \
+    X(ENEMY_BOSS,    PROJECTILE_MISSILE,    PROJECTILE_ENERGY_ORB, 2.5f, 8, 360.0f)
+
+#endif // PROJECTILE_TYPE_TABLE_H
@@ -3,15 +3,14 @@
 
 #include "raylib.h"
 #include "enemy_types.h"
+#include "projectile_type_table.h"
 #include <stdbool.h>
 
-// Projectile type enumeration
+// Projectile type enumeration (generated from PROJECTILE_TYPE_TABLE)
 typedef enum {
-    PROJECTILE_LASER,       // Fast, straight line, low damage
-    PROJECTILE_PLASMA,      // Medium speed, medium damage, slight homing
-    PROJECTILE_MISSILE,     // Slow, high damage, strong homing
-    PROJECTILE_ENERGY_ORB,  // Slow, area damage, no homing
-    PROJECTILE_PLAYER_BULLET, // Player's basic bullet, damage = 1
+#define X(id, ...) id,
+    PROJECTILE_TYPE_TABLE(X)
+#undef X
     PROJECTILE_TYPE_COUNT
 } ProjectileType;
 
@@ -46,6 +45,7 @@ typedef struct {
 // Individual projectile instance
 typedef struct {
     Vector2 position;
+    Vector2 previousPosition;   // Position at the start of the tick (swept collisions)
     Vector2 velocity;
     ProjectileType type;
     bool active;
@@ -77,26 +77,64 @@ typedef struct {
     ProjectileType primaryProjectile;
     ProjectileType secondaryProjectile;  // Some enemies have two attack types
     float fireRate;         // Shots per second
+    float fireInterval;     // Seconds between shots (1 / fireRate)
     int burstCount;         // Number of shots in a burst
     float spreadAngle;      // Spread for multi-shot
 } EnemyWeaponConfig;
 
+// Projectile definitions (generated from PROJECTILE_TYPE_TABLE, read-only)
+static const ProjectileDefinition projectileTypes[PROJECTILE_TYPE_COUNT] = {
+#define X(id, typeName, spd, dmg, sz, hitbox, primary, secondary, glow, movement, homing, life, pierce, explode, radius) \
+    [id] = { .type = id, .name = typeName, .speed = spd, .damage = dmg, .size = sz, \
+             .hitboxRadius = hitbox, .primaryColor = primary, .secondaryColor = secondary, \
+             .glowColor = glow, .pattern = movement, .homingStrength = homing, .lifetime = life, \
+             .piercing = pierce, .explosive = explode, .explosionRadius = radius },
+    PROJECTILE_TYPE_TABLE(X)
+#undef X
+};
+
+// Enemy weapon configs (generated from ENEMY_WEAPON_TABLE, read-only)
+static const EnemyWeaponConfig enemyWeapons[ENEMY_TYPE_COUNT] = {
+#define X(enemy, primary, secondary, rate, burst, spread) \
+    [enemy] = { .enemyType = enemy, .primaryProjectile = primary, .secondaryProjectile = secondary, \
+                .fireRate = rate, .fireInterval = 1.0f / (rate), .burstCount = burst, .spreadAngle = spread },
+    ENEMY_WEAPON_TABLE(X)
+#undef X
+};
+
+// Every enemy type needs exactly one weapon row (a missing row would fire at rate 0)
+#define X(...) + 1
+TABLE_STATIC_ASSERT(0 ENEMY_WEAPON_TABLE(X) == ENEMY_TYPE_COUNT, enemy_weapon_table_covers_every_enemy_type);
+#undef X
+
+// Accessors
+static inline const ProjectileDefinition* GetProjectileDefinition(ProjectileType type) {
+    if ((unsigned int)type >= PROJECTILE_TYPE_COUNT) {
+        return &projectileTypes[PROJECTILE_LASER];  // Default to laser
+    }
+    return &projectileTypes[type];
+}
+
+static inline const EnemyWeaponConfig* GetEnemyWeaponConfig(EnemyType enemyType) {
+    if ((unsigned int)enemyType >= ENEMY_TYPE_COUNT) {
+        return &enemyWeapons[ENEMY_GRUNT];  // Default to grunt
+    }
+    return &enemyWeapons[enemyType];
+}
+
+static inline ProjectileType GetEnemyPrimaryProjectile(EnemyType enemyType) {
+    return GetEnemyWeaponConfig(enemyType)->primaryProjectile;
+}
+
+static inline ProjectileType GetEnemySecondaryProjectile(EnemyType enemyType) {
+    return GetEnemyWeaponConfig(enemyType)->secondaryProjectile;
+}
+
 // Function declarations
-void InitProjectileTypes(void);
-const ProjectileDefinition* GetProjectileDefinition(ProjectileType type);
 void InitializeProjectile(Projectile* projectile, ProjectileType type, Vector2 position, Vector2 target, bool isPlayer);
 void UpdateProjectile(Projectile* projectile, float deltaTime);
 void DrawProjectile(const Projectile* projectile);
 void DrawProjectileSprite(const Projectile* projectile, Texture2D spriteSheet, Rectangle sourceRect);
 
-// Weapon configuration
-const EnemyWeaponConfig* GetEnemyWeaponConfig(EnemyType enemyType);
-ProjectileType GetEnemyPrimaryProjectile(EnemyType enemyType);
-ProjectileType GetEnemySecondaryProjectile(EnemyType enemyType);
-
-// Global projectile definitions
-extern ProjectileDefinition projectileTypes[PROJECTILE_TYPE_COUNT];
-extern EnemyWeaponConfig enemyWeapons[ENEMY_TYPE_COUNT];
-
 #endif // PROJECTILE_TYPES_H
 
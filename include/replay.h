@@ -0,0 +1,100 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "input_manager.h"
+#include "database.h"
+#include <stdbool.h>
+
+/**
+ * Replay - Recording and playback of a run's input
+ *
+ * The simulation advances in fixed ticks (SIM_TICK_RATE) driven only by one
+ * InputTickState per tick and the random seed, so the seed, the start level
+ * and the tick states are enough to play a run again.
+ *
+ * Encoding: the tick states are run-length encoded. Each run is two varints
+ * (7 bits per byte, low bits first): the XOR of its state with the previous
+ * run's state, then the number of ticks it lasts. Held buttons cost nothing
+ * per tick, so a nine-minute run is a few kilobytes.
+ *
+ * The reader decodes straight from the database blob through a small chunk
+ * buffer (DB_ReadReplayData), so playback never loads the whole replay.
+ */
+
+#define REPLAY_FORMAT_VERSION 2      // 2: gameplay draws from GameRandom instead of raylib / libc rand
+#define REPLAY_READ_CHUNK 512        // Blob bytes fetched per read
+
+typedef struct ReplayRecorder {
+    unsigned char* data;            // Encoded runs (grown as needed)
+    int size;
+    int capacity;
+    InputTickState previousState;   // State of the last encoded run
+    InputTickState runState;        // State of the run being counted
+    int runLength;                  // Ticks in it (0 before the first tick)
+    int tickCount;
+    bool failed;                    // Out of memory: the recording is dropped
+} ReplayRecorder;
+
+typedef struct ReplayReader {
+    DBReplayInfo info;
+    unsigned char buffer[REPLAY_READ_CHUNK];
+    int bufferSize;
+    int bufferPos;
+    int nextOffset;                 // Blob offset of the next chunk
+    InputTickState state;           // State of the current run
+    int remaining;                  // Ticks left in it
+    int ticksRead;
+    bool failed;                    // Read error or malformed data
+} ReplayReader;
+
+/**
+ * Start an empty recording
+ *
+ * @param recorder Recorder to reset
+ */
+void Replay_InitRecorder(ReplayRecorder* recorder);
+
+/**
+ * Append one tick's input
+ *
+ * @param recorder Recorder
+ * @param state Input the tick ran with
+ */
+void Replay_RecordTick(ReplayRecorder* recorder, InputTickState state);
+
+/**
+ * Close the recording and hand over its data
+ *
+ * @param recorder Recorder (empty afterwards)
+ * @param outData Encoded input, malloc'd; the caller owns it
+ * @param outSize Bytes in outData
+ * @return false if nothing was recorded or recording failed
+ */
+bool Replay_FinishRecorder(ReplayRecorder* recorder, unsigned char** outData, int* outSize);
+
+/**
+ * Free a recording that was not finished
+ *
+ * @param recorder Recorder
+ */
+void Replay_FreeRecorder(ReplayRecorder* recorder);
+
+/**
+ * Open a stored replay for playback
+ *
+ * @param reader Reader to set up
+ * @param replayId Replay id in the database
+ * @return false if the replay does not exist or has an unknown format
+ */
+bool Replay_OpenReader(ReplayReader* reader, int replayId);
+
+/**
+ * Next tick's input
+ *
+ * @param reader Reader
+ * @param outState Input for the tick
+ * @return false at the end of the replay (or on a read error, see reader->failed)
+ */
+bool Replay_NextInput(ReplayReader* reader, InputTickState* outState);
+
+#endif // REPLAY_H
@@ -0,0 +1,108 @@
+#ifndef RUN_TELEMETRY_H
+#define RUN_TELEMETRY_H
+
+#include "types.h"
+#include "enemy_types.h"
+#include "powerup.h"
+#include "database.h"
+
+/**
+ * Run Telemetry - Per-run gameplay statistics buffered during play
+ *
+ * Everything is counted in fixed-size arrays owned by the game: kills and
+ * damage per EnemyType, one phase per level played, and a histogram of
+ * gameplay frame times (RUN_TELEMETRY_FRAME_BUCKET_MS buckets) for the
+ * percentiles. Nothing touches the database until the run ends, when
+ * RunTelemetry_Submit hands one DBRunRecord to DB_RecordRun, which writes
+ * it in a single transaction on the database writer thread.
+ *
+ * The recording calls are inline and NULL-safe so the collision code can
+ * use them without linking this module (showcases run without telemetry).
+ */
+
+#define RUN_TELEMETRY_FRAME_BUCKET_MS 0.1f   // Histogram resolution
+#define RUN_TELEMETRY_FRAME_BUCKETS 1000     // Frames over 100 ms share the last bucket
+
+TABLE_STATIC_ASSERT(ENEMY_TYPE_COUNT <= DB_RUN_MAX_ENEMY_TYPES, run_telemetry_enemy_types_fit);
+TABLE_STATIC_ASSERT(POWERUP_TYPE_COUNT <= DB_RUN_MAX_POWERUP_TYPES, run_telemetry_powerup_types_fit);
+
+typedef struct RunTelemetry {
+    int kills[ENEMY_TYPE_COUNT];
+    int damage[ENEMY_TYPE_COUNT];
+    int totalKills;
+    DBRunPhase phases[DB_RUN_MAX_PHASES];
+    int phaseCount;
+    int phaseStartScore;            // Score when the current phase began
+    int phaseStartKills;
+    int frameBuckets[RUN_TELEMETRY_FRAME_BUCKETS];
+    int frameCount;
+    float frameTimeMax;             // Milliseconds
+    bool submitted;
+} RunTelemetry;
+
+// Damage dealt to an enemy (telemetry may be NULL)
+static inline void RunTelemetry_RecordHit(RunTelemetry* telemetry, EnemyType type, int damage) {
+    if (telemetry && type >= 0 && type < ENEMY_TYPE_COUNT) {
+        telemetry->damage[type] += damage;
+    }
+}
+
+// Enemy destroyed by the player (telemetry may be NULL)
+static inline void RunTelemetry_RecordKill(RunTelemetry* telemetry, EnemyType type) {
+    if (telemetry && type >= 0 && type < ENEMY_TYPE_COUNT) {
+        telemetry->kills[type]++;
+        telemetry->totalKills++;
+    }
+}
+
+/**
+ * Clear all counters for a new run
+ *
+ * @param telemetry Telemetry to reset
+ */
+void RunTelemetry_Init(RunTelemetry* telemetry);
+
+/**
+ * Close the current phase (if any) and start one for a level
+ *
+ * Phases beyond DB_RUN_MAX_PHASES are merged into the last one.
+ *
+ * @param telemetry Telemetry
+ * @param level Level number of the new phase
+ * @param gameTime Game time the phase starts at
+ * @param score Score at the start of the phase
+ */
+void RunTelemetry_BeginPhase(RunTelemetry* telemetry, int level, float gameTime, int score);
+
+/**
+ * Count one gameplay frame
+ *
+ * @param telemetry Telemetry
+ * @param frameTime Frame time in seconds (GetFrameTime)
+ */
+void RunTelemetry_RecordFrame(RunTelemetry* telemetry, float frameTime);
+
+/**
+ * Build the database record for the run so far
+ *
+ * Closes the current phase at the game's time, reads powerup counts from the
+ * powerup system and derives the outcome from the game state.
+ *
+ * @param telemetry Telemetry
+ * @param game Game the telemetry was recorded for
+ * @param record Output record
+ */
+void RunTelemetry_Finish(RunTelemetry* telemetry, const Game* game, DBRunRecord* record);
+
+/**
+ * Finish the run and queue it for the database (once per run)
+ *
+ * Runs with no gameplay frames are not recorded.
+ *
+ * @param telemetry Telemetry
+ * @param game Game the telemetry was recorded for
+ * @return true if the run was queued
+ */
+bool RunTelemetry_Submit(RunTelemetry* telemetry, const Game* game);
+
+#endif // RUN_TELEMETRY_H
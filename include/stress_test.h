@@ -0,0 +1,108 @@
+#ifndef STRESS_TEST_H
+#define STRESS_TEST_H
+
+#include "types.h"
+
+/**
+ * Stress Test - Bullet-hell load for finding the simulation's scaling limits
+ *
+ * Started with --stress. The run plays the first level as usual, but the pools
+ * are sized for the stress load and every tick StressTest_Populate tops the
+ * enemies and enemy projectiles back up to their targets (new enemies fire
+ * right away) and refills the player so the run can not end early.
+ *
+ * StepGame times each stage of every tick (the job stages as the CPU time of
+ * all their chunks, plus the wall time of the whole job graph) and hands the
+ * timings to StressTest_EndTick, which prints the average and worst tick of
+ * each stage every STRESS_REPORT_INTERVAL seconds and a summary for the whole
+ * run when it ends after STRESS_DURATION seconds. Stress runs are not recorded
+ * (no replay, telemetry or high score).
+ */
+
+#define STRESS_DEFAULT_ENEMIES 500
+#define STRESS_DEFAULT_PROJECTILES 20000
+#define STRESS_DURATION 60.0f           // Game seconds before the run ends
+#define STRESS_REPORT_INTERVAL 5.0f     // Game seconds per printed report
+#define STRESS_ENEMY_SPAWNS_PER_TICK 32 // Top-up rate (the pools fill within a second or two)
+
+// Timed parts of a tick
+typedef enum {
+    STRESS_STAGE_TICK = 0,          // Whole StepGame
+    STRESS_STAGE_BULLETS,
+    STRESS_STAGE_WAVES,
+    STRESS_STAGE_ENEMY_MOVE,
+    STRESS_STAGE_ENEMY_FIRE,
+    STRESS_STAGE_PROJECTILES,
+    STRESS_STAGE_EXPLOSIONS,
+    STRESS_STAGE_POWERUPS,
+    STRESS_STAGE_STARFIELD,
+    STRESS_STAGE_JOBS,              // Wall time of the job graph (all stages above but bullets)
+    STRESS_STAGE_COLLISIONS,
+    STRESS_STAGE_COUNT
+} StressStage;
+
+typedef struct {
+    double totalMs;
+    double maxMs;
+} StressTiming;
+
+struct StressTest {
+    int targetEnemies;
+    int targetProjectiles;
+    bool finished;
+    float elapsed;                  // Game seconds since the first tick
+    float nextReport;
+    double stageMs[STRESS_STAGE_COUNT];     // Current tick, filled by StepGame
+    StressTiming window[STRESS_STAGE_COUNT];
+    int windowTicks;
+    StressTiming run[STRESS_STAGE_COUNT];
+    int runTicks;
+    int nextShooter;                // Enemy slot that fires the next top-up shot
+    int activeEnemies;              // As of the last top-up
+    int activeProjectiles;
+    int peakEnemies;
+    int peakProjectiles;
+};
+
+/**
+ * Set up a stress run
+ *
+ * @param stress Stress test to reset
+ * @param enemies Enemies to keep alive (<= 0 = STRESS_DEFAULT_ENEMIES)
+ * @param projectiles Enemy projectiles to keep in flight (<= 0 = STRESS_DEFAULT_PROJECTILES)
+ */
+void StressTest_Init(StressTest* stress, int enemies, int projectiles);
+
+/**
+ * Raise pool sizes to what the stress load needs (capped at MAX_POOL_CAPACITY)
+ *
+ * @param stress Stress test
+ * @param capacity Pool sizes of the run, raised in place
+ */
+void StressTest_RaiseCapacity(const StressTest* stress, PoolCapacity* capacity);
+
+/**
+ * Top up enemies and projectiles and refill the player (start of a tick)
+ *
+ * @param stress Stress test
+ * @param game Game being stressed
+ */
+void StressTest_Populate(StressTest* stress, Game* game);
+
+/**
+ * Clear the stage timings for a new tick
+ *
+ * @param stress Stress test
+ */
+void StressTest_BeginTick(StressTest* stress);
+
+/**
+ * Add the tick's timings to the report, printing it when due
+ *
+ * @param stress Stress test
+ * @param game Game being stressed (ended when the stress run is over)
+ * @param deltaTime Tick length in seconds
+ */
+void StressTest_EndTick(StressTest* stress, Game* game, float deltaTime);
+
+#endif // STRESS_TEST_H
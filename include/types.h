@@ -7,16 +7,25 @@
 // Forward declarations
 typedef struct Game Game;
 typedef struct WaveSystem WaveSystem;
+typedef struct WaveTimeline WaveTimeline;
 typedef struct EnemyEx EnemyEx;
 typedef struct PlayerShip PlayerShip;
 typedef struct ExplosionSystem ExplosionSystem;
 typedef struct PowerupSystem PowerupSystem;
 typedef struct LevelManager LevelManager;
 typedef struct InputManager InputManager;
+typedef struct RunTelemetry RunTelemetry;
+typedef struct ReplayRecorder ReplayRecorder;
+typedef struct ReplayReader ReplayReader;
+typedef struct CollisionEventQueue CollisionEventQueue;
+typedef struct StressTest StressTest;
+typedef struct GameSnapshot GameSnapshot;
+typedef struct GameSnapshotHistory GameSnapshotHistory;
 
 // Bullet structure
 typedef struct Bullet {
     Vector2 position;
+    Vector2 previousPosition;   // Position at the start of the tick (swept collisions)
     Rectangle bounds;
     bool active;
     float speed;
@@ -25,6 +34,15 @@ typedef struct Bullet {
     int powerLevel;     // Weapon power level 0-3 (standard, +1, +2, +3)
 } Bullet;
 
+// Entity pool sizes of a run (0 in a level config = default size)
+typedef struct PoolCapacity {
+    int bullets;
+    int enemies;
+    int projectiles;
+    int powerups;
+    int explosions;
+} PoolCapacity;
+
 // Note: Enemy structure has been replaced by EnemyEx in enemy_types.h
 
 // Starfield for background
@@ -41,6 +59,7 @@ struct Game {
     Bullet* bullets;
     void* projectiles;        // Projectile* (using void* to avoid circular dependency)
     EnemyEx* enemies;         // Updated to use new enemy structure
+    PoolCapacity capacity;    // Slots in the bullet, enemy, projectile, powerup and explosion pools
     int score;
     float backgroundX;
     bool gameOver;
@@ -52,6 +71,7 @@ struct Game {
     LevelManager* levelManager;
     // Wave system
     WaveSystem* waveSystem;
+    WaveTimeline* waveTimeline; // Seek checkpoints (pre-rolled on first seek)
     // Explosion system
     ExplosionSystem* explosionSystem;
     // Powerup system
@@ -59,14 +79,29 @@ struct Game {
     // Starfield
     Star* stars;
     int numStars;
+    // Run telemetry (buffered during play, written to the database when the run ends)
+    RunTelemetry* telemetry;
+    // Replays: the run's input is recorded tick by tick, or read back from a stored replay
+    unsigned int seed;        // Random seed the run started with
+    int startLevel;           // Level number the run started in
+    ReplayRecorder* replayRecorder; // NULL when not recording (playback, or a seek happened)
+    ReplayReader* replayReader;     // Non-NULL while playing a replay back
+    float tickAccumulator;    // Frame time not yet simulated (less than one tick)
+    unsigned int lastTickInput;     // InputTickState of the previous tick
+    unsigned int pendingHotkey;     // Weapon hotkey pressed in a frame that ran no tick
+    // Collision events (reused every tick)
+    CollisionEventQueue* collisionEvents;
+    // Stress test (--stress): keeps the pools full and times the tick stages, NULL otherwise
+    StressTest* stressTest;
+    // Practice mode (--practice): the last ticks for rewinding and the state the level started in, NULL otherwise
+    GameSnapshotHistory* rewindHistory;
+    GameSnapshot* levelCheckpoint;
     // Collision logging
     char deathCause[256];
     void* logFile;            // FILE* (using void* to avoid including stdio.h here)
     int nextEnemyId;
     int nextProjectileId;
-    // Audio
-    Music backgroundMusic;
-    bool musicLoaded;
+    // Audio (the music itself is owned by the music streamer)
     float musicVolume;
     // Boss tracking
     int bossEnemyIndex;       // Index of boss enemy in enemies array (-1 if none)
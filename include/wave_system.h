@@ -4,6 +4,8 @@
 #include "types.h"
 #include "enemy_types.h"
 
+#define WAVE_INDEX_BUCKET_SIZE 1.0f   // Seconds covered by each spawn index bucket
+
 // Wave phase structure
 typedef struct WavePhase {
     int phaseNumber;
@@ -36,6 +38,10 @@ typedef struct WaveSystem {
     int eventCount;
     int nextEventIndex;
     
+    // Time-bucket index: eventBuckets[b] is the first event at or after b * WAVE_INDEX_BUCKET_SIZE
+    int* eventBuckets;
+    int bucketCount;
+    
     float waveTimer;
     float totalDuration;
     bool isComplete;
@@ -44,15 +50,18 @@ typedef struct WaveSystem {
     float lastSpawnTime;
     int totalEnemiesSpawned;
     int totalEnemiesKilled;
+    int totalSpawnsDropped;   // Spawns discarded because every enemy slot was busy
 } WaveSystem;
 
 // Forward declaration
 typedef struct LevelConfig LevelConfig;
 
 // Function declarations
-void InitWaveSystem(WaveSystem* waveSystem, const LevelConfig* levelConfig, bool applyDebugPhase);
+void InitWaveSystem(WaveSystem* waveSystem, const LevelConfig* levelConfig);
 void UpdateWaveSystem(WaveSystem* waveSystem, struct Game* game, float deltaTime);
-void SpawnWaveEnemy(struct Game* game, EnemyType type, float x, float y, const char* pattern);
+int FindSpawnEventIndex(const WaveSystem* waveSystem, float time);  // First event at or after time
+void SeekWaveSystem(WaveSystem* waveSystem, float time);            // Jump timer/event cursor, no spawns
+bool SpawnWaveEnemy(struct Game* game, EnemyType type, float x, float y, const char* pattern);  // false if pool is full
 void CleanupWaveSystem(WaveSystem* waveSystem);
 const char* GetCurrentPhaseName(const WaveSystem* waveSystem);
 float GetWaveProgress(const WaveSystem* waveSystem);
@@ -0,0 +1,98 @@
+#ifndef WAVE_TIMELINE_H
+#define WAVE_TIMELINE_H
+
+#include "types.h"
+#include "constants.h"
+#include "enemy_types.h"
+#include "projectile_types.h"
+
+/**
+ * Wave Timeline - Seekable level playback
+ *
+ * Pre-rolls a level headlessly (wave spawns, enemy movement and enemy fire,
+ * no player interaction) and keeps a full snapshot of the enemy and
+ * projectile pools (at the game's pool sizes) every WAVE_CHECKPOINT_INTERVAL
+ * seconds. Seeking restores the nearest earlier checkpoint and simulates the
+ * short remainder, so jumping to any point of a level shows the enemies that
+ * should be on screen.
+ */
+
+#define WAVE_CHECKPOINT_INTERVAL 10.0f   // Seconds between pre-roll checkpoints
+#define WAVE_TIMELINE_FPS 60             // Movement code is frame-based, so step at the game's frame rate
+
+// Snapshot of everything the wave simulation touches
+typedef struct WaveCheckpoint {
+    float levelTime;
+    EnemyEx* enemies;            // Pool copies, stored in the timeline's slot arrays
+    Projectile* projectiles;
+    int nextEventIndex;
+    float waveTimer;
+    int totalEnemiesSpawned;
+    int totalSpawnsDropped;
+    bool isComplete;
+    int nextEnemyId;
+    int bossEnemyIndex;
+    float bossSpawnTime;
+} WaveCheckpoint;
+
+// Checkpoints for one level
+typedef struct WaveTimeline {
+    WaveCheckpoint* checkpoints;
+    int checkpointCount;
+    EnemyEx* enemySlots;         // enemyCapacity slots per checkpoint
+    Projectile* projectileSlots; // projectileCapacity slots per checkpoint
+    int enemyCapacity;
+    int projectileCapacity;
+    int levelNumber;             // Level the checkpoints were recorded for (0 = none)
+} WaveTimeline;
+
+/**
+ * Advance the wave simulation by one headless frame
+ *
+ * Same order as UpdateGame: projectiles, wave spawns, enemy movement and firing.
+ *
+ * @param game Game whose enemies, projectiles and wave system are stepped
+ * @param playerPosition Target for aimed enemy weapons
+ * @param deltaTime Frame time
+ */
+void WaveTimeline_Step(Game* game, Vector2 playerPosition, float deltaTime);
+
+/**
+ * Pre-roll the game's current level from zero and record checkpoints
+ *
+ * Runs on scratch pools; the game itself is not modified.
+ *
+ * @param timeline Timeline to fill (previous checkpoints are freed)
+ * @param game Game providing the level manager and loaded wave system
+ * @return true if at least one checkpoint was recorded
+ */
+bool WaveTimeline_Build(WaveTimeline* timeline, const Game* game);
+
+/**
+ * Restore the game's wave state to a level time
+ *
+ * Builds the timeline first if it does not match the current level.
+ *
+ * @param timeline Timeline for the current level
+ * @param game Game to restore into
+ * @param levelTime Target time in seconds from level start
+ * @return true on success
+ */
+bool WaveTimeline_Seek(WaveTimeline* timeline, Game* game, float levelTime);
+
+/**
+ * Free all checkpoints
+ *
+ * @param timeline Timeline to clear
+ */
+void WaveTimeline_Cleanup(WaveTimeline* timeline);
+
+/**
+ * Start time of a DEBUG_START_PHASE phase number
+ *
+ * @param phase Phase number (1-17)
+ * @return Level time in seconds, 0 for unknown phases
+ */
+float WaveTimeline_GetPhaseStartTime(int phase);
+
+#endif // WAVE_TIMELINE_H
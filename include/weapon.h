@@ -4,13 +4,13 @@
 #include "types.h"
 
 // Initialize bullets array
-void InitBullets(Bullet* bullets);
+void InitBullets(Bullet* bullets, int count);
 
 // Shoot a bullet from given position (legacy - use ShootBulletsForMode)
 void ShootBullet(Bullet* bullets, Vector2 position);
 
 // Fire bullets according to weapon mode with balanced damage
-void ShootBulletsForMode(Bullet* bullets, PlayerShip* playerShip);
+void ShootBulletsForMode(Bullet* bullets, int count, PlayerShip* playerShip);
 
 // Update weapon heat system
 void UpdateWeaponHeat(PlayerShip* playerShip, float deltaTime);
@@ -19,7 +19,7 @@ void UpdateWeaponHeat(PlayerShip* playerShip, float deltaTime);
 void UpdateBullets(Game* game);
 
 // Draw all bullets
-void DrawBullets(const Bullet* bullets);
+void DrawBullets(const Bullet* bullets, int count);
 
 // Draw weapon heat UI
 void DrawWeaponHeatBar(const PlayerShip* playerShip);
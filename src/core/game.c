@@ -5,6 +5,7 @@
 #include "projectile_types.h"
 #include "level_system.h"
 #include "wave_system.h"
+#include "wave_timeline.h"
 #include "weapon.h"
 #include "explosion.h"
 #include "combat_system.h"
@@ -12,33 +13,161 @@
 #include "collision.h"
 #include "powerup.h"
 #include "utils.h"
+#include "asset_pack.h"
+#include "music_stream.h"
+#include "run_telemetry.h"
+#include "replay.h"
+#include "input_manager.h"
+#include "job_system.h"
+#include "stress_test.h"
+#include "game_random.h"
+#include "game_snapshot.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <time.h>
+
+// Level time requested from the command line (negative = use DEBUG_START_PHASE)
+static float s_startTimeOverride = -1.0f;
+
+void SetGameStartTime(float levelTime) {
+    s_startTimeOverride = levelTime;
+}
+
+// Replay to play back on the next InitGame (command line --replay, 0 = none)
+static int s_replayId = 0;
+
+void SetGameReplay(int replayId) {
+    s_replayId = replayId;
+}
+
+// Stress load requested from the command line (--stress, kept for restarts)
+static bool s_stressTest = false;
+static int s_stressEnemies = 0;
+static int s_stressProjectiles = 0;
+
+void SetGameStressTest(int enemies, int projectiles) {
+    s_stressTest = true;
+    s_stressEnemies = enemies;
+    s_stressProjectiles = projectiles;
+}
+
+// Practice mode requested from the command line (--practice, kept for restarts)
+static bool s_practice = false;
+
+void SetGamePractice(bool enabled) {
+    s_practice = enabled;
+}
+
+// Practice mode keeps the last GAME_REWIND_TICKS ticks and the level's starting state
+static bool InitPractice(Game* game) {
+    game->rewindHistory = (GameSnapshotHistory*)malloc(sizeof(GameSnapshotHistory));
+    game->levelCheckpoint = (GameSnapshot*)calloc(1, sizeof(GameSnapshot));
+    if (game->rewindHistory && !GameSnapshotHistory_Init(game->rewindHistory, GAME_REWIND_TICKS)) {
+        free(game->rewindHistory);
+        game->rewindHistory = NULL;
+    }
+    
+    if (!game->rewindHistory || !game->levelCheckpoint) {
+        free(game->rewindHistory);
+        free(game->levelCheckpoint);
+        game->rewindHistory = NULL;
+        game->levelCheckpoint = NULL;
+        return false;
+    }
+    return true;
+}
+
+static void CleanupPractice(Game* game) {
+    if (game->rewindHistory) {
+        GameSnapshotHistory_Free(game->rewindHistory);
+        free(game->rewindHistory);
+        game->rewindHistory = NULL;
+    }
+    if (game->levelCheckpoint) {
+        GameSnapshot_Free(game->levelCheckpoint);
+        free(game->levelCheckpoint);
+        game->levelCheckpoint = NULL;
+    }
+}
+
+// A run that seeked or went back in time can not be replayed from its input
+static void DropReplayRecording(Game* game) {
+    if (game->replayRecorder) {
+        Replay_FreeRecorder(game->replayRecorder);
+        free(game->replayRecorder);
+        game->replayRecorder = NULL;
+    }
+}
 
 void InitGame(Game* game) {
     // Initialize logger
     InitLogger(game);
     
+    // Open the requested replay (played once; a restart is a normal game)
+    game->replayReader = NULL;
+    game->replayRecorder = NULL;
+    if (s_replayId > 0) {
+        ReplayReader* reader = (ReplayReader*)malloc(sizeof(ReplayReader));
+        if (reader && Replay_OpenReader(reader, s_replayId)) {
+            game->replayReader = reader;
+            printf("[REPLAY] Playing replay %d (%d ticks, score %d)\n",
+                   s_replayId, reader->info.tickCount, reader->info.score);
+        } else {
+            free(reader);
+        }
+        s_replayId = 0;
+    }
+    
+    // A stress run plays normally with a heavy load on top (it is not recorded)
+    game->stressTest = NULL;
+    if (s_stressTest) {
+        game->stressTest = (StressTest*)malloc(sizeof(StressTest));
+        if (game->stressTest) {
+            StressTest_Init(game->stressTest, s_stressEnemies, s_stressProjectiles);
+            printf("[STRESS] Keeping %d enemies and %d enemy projectiles alive for %.0fs\n",
+                   game->stressTest->targetEnemies, game->stressTest->targetProjectiles, STRESS_DURATION);
+        }
+    }
+    
+    // Practice runs can be rewound, so they are not recorded either
+    game->rewindHistory = NULL;
+    game->levelCheckpoint = NULL;
+    if (s_practice && !game->replayReader && !game->stressTest) {
+        if (InitPractice(game)) {
+            printf("[GAME] Practice mode: hold BACKSPACE to rewind up to %ds, R after a game over retries the level\n",
+                   GAME_REWIND_SECONDS);
+        } else {
+            fprintf(stderr, "Failed to allocate practice mode snapshots\n");
+        }
+    }
+    
+    // Seed the simulation's random generator: with the same seed and input the run plays out the same
+    game->seed = game->replayReader ? game->replayReader->info.seed : (unsigned int)time(NULL);
+    GameRandom_Seed(game->seed);
+    
     // Initialize level manager
     game->levelManager = (LevelManager*)malloc(sizeof(LevelManager));
     InitLevelManager(game->levelManager);
     
     // Get current level configuration
     const LevelConfig* currentLevel = GetCurrentLevel(game->levelManager);
+    game->startLevel = currentLevel->levelNumber;
+    if (game->replayReader && game->replayReader->info.startLevel != game->startLevel) {
+        printf("[REPLAY] Replay starts in level %d but this build starts in level %d, not playing it\n",
+               game->replayReader->info.startLevel, game->startLevel);
+        free(game->replayReader);
+        game->replayReader = NULL;
+    }
     
     // Try to load background music for current level
-    // Note: Audio device is initialized once in main(), not here
-    game->musicLoaded = false;
+    // Note: Audio device and music streamer are initialized once in main(), not here
     game->musicVolume = 0.5f;  // Default 50% volume
     const char* musicPath = currentLevel->audioPath;
-    if (FileExists(musicPath)) {
-        game->backgroundMusic = LoadMusicStream(musicPath);
-        // Check if music loaded successfully (ctxType will be non-zero if valid)
-        if (game->backgroundMusic.ctxType > 0) {
-            game->musicLoaded = true;
-            PlayMusicStream(game->backgroundMusic);
-            SetMusicVolume(game->backgroundMusic, game->musicVolume);
+    if (AssetPack_FileExists(musicPath)) {
+        if (MusicStream_Load(musicPath)) {
+            MusicStream_SetVolume(game->musicVolume);
+            MusicStream_Play();
             printf("[GAME] Loaded music for level %d: %s\n", 
                    currentLevel->levelNumber, musicPath);
         }
@@ -46,10 +175,20 @@ void InitGame(Game* game) {
         printf("[GAME] WARNING: Music file not found: %s\n", musicPath);
     }
     
+    // Pools are sized once for the whole run (the most demanding level decides),
+    // so slot indices never move while enemies and shots are alive
+    game->capacity = GetRunPoolCapacity(game->levelManager);
+    if (game->stressTest) {
+        StressTest_RaiseCapacity(game->stressTest, &game->capacity);
+    }
+    printf("[GAME] Pools: %d bullets, %d enemies, %d projectiles, %d powerups, %d explosions\n",
+           game->capacity.bullets, game->capacity.enemies, game->capacity.projectiles,
+           game->capacity.powerups, game->capacity.explosions);
+    
     // Allocate memory for arrays
-    game->bullets = (Bullet*)malloc(MAX_BULLETS * sizeof(Bullet));
-    game->projectiles = malloc(MAX_PROJECTILES * sizeof(Projectile));
-    game->enemies = (EnemyEx*)malloc(MAX_ENEMIES * sizeof(EnemyEx));
+    game->bullets = (Bullet*)malloc(game->capacity.bullets * sizeof(Bullet));
+    game->projectiles = malloc(game->capacity.projectiles * sizeof(Projectile));
+    game->enemies = (EnemyEx*)malloc(game->capacity.enemies * sizeof(EnemyEx));
     
     // Initialize player ship
     game->playerShip = (PlayerShip*)malloc(sizeof(PlayerShip));
@@ -59,40 +198,48 @@ void InitGame(Game* game) {
     game->numStars = 150;
     game->stars = (Star*)malloc(game->numStars * sizeof(Star));
     for (int i = 0; i < game->numStars; i++) {
-        game->stars[i].position.x = GetRandomValue(0, SCREEN_WIDTH);
-        game->stars[i].position.y = GetRandomValue(0, SCREEN_HEIGHT);
+        game->stars[i].position.x = GameRandom_Int(0, SCREEN_WIDTH);
+        game->stars[i].position.y = GameRandom_Int(0, SCREEN_HEIGHT);
         game->stars[i].speed = 1.0f + (i % 3) * 0.5f;
         game->stars[i].brightness = 100 + (i % 3) * 50;
     }
     
     // Initialize bullets
-    InitBullets(game->bullets);
-    
-    // Initialize projectile types
-    InitProjectileTypes();
+    InitBullets(game->bullets, game->capacity.bullets);
     
     // Initialize projectiles array
     Projectile* projectiles = (Projectile*)game->projectiles;
-    for (int i = 0; i < MAX_PROJECTILES; i++) {
+    for (int i = 0; i < game->capacity.projectiles; i++) {
         projectiles[i].active = false;
     }
     
     // Initialize enemies array
-    for (int i = 0; i < MAX_ENEMIES; i++) {
+    for (int i = 0; i < game->capacity.enemies; i++) {
         game->enemies[i].active = false;
     }
     
     // Initialize wave system with current level configuration
     game->waveSystem = (WaveSystem*)malloc(sizeof(WaveSystem));
-    InitWaveSystem(game->waveSystem, currentLevel, true);  // Apply debug phase on initial start
+    InitWaveSystem(game->waveSystem, currentLevel);
+    
+    // Seek checkpoints are only pre-rolled when a seek is requested
+    game->waveTimeline = (WaveTimeline*)calloc(1, sizeof(WaveTimeline));
     
     // Initialize explosion system
     game->explosionSystem = (ExplosionSystem*)malloc(sizeof(ExplosionSystem));
-    InitExplosionSystem(game->explosionSystem);
+    InitExplosionSystem(game->explosionSystem, game->capacity.explosions);
     
     // Initialize powerup system
     game->powerupSystem = (PowerupSystem*)malloc(sizeof(PowerupSystem));
-    InitPowerupSystem(game->powerupSystem);
+    InitPowerupSystem(game->powerupSystem, game->capacity.powerups);
+    
+    // Collision events are detected into this queue, then resolved
+    game->collisionEvents = (CollisionEventQueue*)malloc(sizeof(CollisionEventQueue));
+    Collision_InitEventQueue(game->collisionEvents);
+    
+    // Initialize run telemetry
+    game->telemetry = (RunTelemetry*)malloc(sizeof(RunTelemetry));
+    RunTelemetry_Init(game->telemetry);
     
     // Initialize game state
     game->score = 0;
@@ -113,46 +260,10 @@ void InitGame(Game* game) {
     game->levelStartTime = 0.0f;  // Level starts at time 0
     game->maxScrollSpeed = 0.0f;  // No speed cap initially
     
-    // Apply DEBUG_START_PHASE to set starting time
-    float startTime = 0.0f;
-    if (DEBUG_START_PHASE > 0 && DEBUG_START_PHASE <= 17) {
-        // Phase timing mapping based on documentation
-        const float phaseTimes[] = {
-            0.0f,    // Phase 0: Normal start
-            0.0f,    // Phase 1: Warm-Up (0-5s)
-            5.0f,    // Phase 2: First Wave (5-35s)
-            35.0f,   // Phase 3: Tank Squadron (35-55s)
-            55.0f,   // Phase 4: Swarm Attack (55-85s)
-            85.0f,   // Phase 5: Mixed Assault (85-120s)
-            120.0f,  // Phase 6: Elite Squadron (120-150s)
-            150.0f,  // Phase 7: Zigzag Chaos (150-180s)
-            180.0f,  // Phase 8: Shield Wall (180-220s)
-            220.0f,  // Phase 9: Bomber Run (220-260s)
-            260.0f,  // Phase 10: Ghost Ambush (260-300s)
-            300.0f,  // Phase 11: Combined Arms (300-345s)
-            345.0f,  // Phase 12: Mini-Boss (345-390s)
-            390.0f,  // Phase 13: Recovery (390-420s)
-            420.0f,  // Phase 14: Elite & Shield (420-460s)
-            460.0f,  // Phase 15: Evasive Maneuvers (460-500s)
-            500.0f,  // Phase 16: Heavy Assault (500-540s)
-            540.0f   // Phase 17: Final Wave (540-590s)
-        };
-        startTime = phaseTimes[DEBUG_START_PHASE];
-        
-        // Seek music to start time if music is loaded
-        if (game->musicLoaded) {
-            SeekMusicStream(game->backgroundMusic, startTime);
-        }
-    }
-    
-    game->gameTime = startTime;
+    game->gameTime = 0.0f;
     game->levelStartTime = 0.0f;  // Always start at 0 for the current level
     game->speedLevel = 1;
-    
-    // Calculate initial scroll speed based on start time
-    // This ensures proper speed even when starting at different phases
-    game->speedLevel = (int)(game->gameTime / SPEED_UPDATE_INTERVAL) + 1;
-    game->scrollSpeed = BASE_SCROLL_SPEED + (SPEED_INCREMENT * (game->speedLevel - 1));
+    game->scrollSpeed = BASE_SCROLL_SPEED;
     
     // Note: maxScrollSpeed is set to 0.0 initially
     // UpdateGameSpeed() will cap speed based on current level number (not time)
@@ -160,6 +271,74 @@ void InitGame(Game* game) {
     game->nextEnemyId = 1;
     game->nextProjectileId = 1;
     strcpy(game->deathCause, "Alive");
+    
+    // Fixed tick state
+    game->tickAccumulator = 0.0f;
+    game->lastTickInput = 0;
+    game->pendingHotkey = 0;
+    
+    // Debug start: command line seek wins over DEBUG_START_PHASE (a replay always starts at 0)
+    float startTime = (s_startTimeOverride >= 0.0f) ? s_startTimeOverride
+                                                     : WaveTimeline_GetPhaseStartTime(DEBUG_START_PHASE);
+    if (startTime > 0.0f && !game->replayReader) {
+        SeekGameToTime(game, startTime);
+    } else if (!game->replayReader && !game->stressTest && !game->rewindHistory) {
+        // Record the input of runs played from the start (kept with the high score)
+        game->replayRecorder = (ReplayRecorder*)malloc(sizeof(ReplayRecorder));
+        if (game->replayRecorder) {
+            Replay_InitRecorder(game->replayRecorder);
+        }
+    }
+    
+    // First telemetry phase starts after any debug seek
+    RunTelemetry_BeginPhase(game->telemetry, currentLevel->levelNumber, game->gameTime, game->score);
+    
+    // Practice checkpoints: the level as it starts, and the first state to rewind to
+    if (game->rewindHistory) {
+        GameSnapshot_Capture(game->levelCheckpoint, game);
+        GameSnapshotHistory_Push(game->rewindHistory, game);
+    }
+}
+
+bool SeekGameToTime(Game* game, float levelTime) {
+    if (!game->waveTimeline || !WaveTimeline_Seek(game->waveTimeline, game, levelTime)) {
+        printf("[GAME] WARNING: Seek to %.2fs failed\n", levelTime);
+        return false;
+    }
+    
+    DropReplayRecording(game);
+    
+    // Wave state is restored; reset what the timeline does not simulate
+    for (int i = 0; i < game->capacity.bullets; i++) {
+        game->bullets[i].active = false;
+    }
+    
+    // The pre-roll has no kills, so nothing from before the seek may survive in these pools
+    ExplosionSystem* explosions = game->explosionSystem;
+    memset(explosions->explosions, 0, sizeof(Explosion) * explosions->capacity);
+    explosions->activeCount = 0;
+    explosions->cleanupTimer = 0.0f;
+    explosions->screenShakeIntensity = 0.0f;
+    explosions->screenShakeDuration = 0.0f;
+    explosions->screenShakeOffset = (Vector2){0, 0};
+    
+    PowerupSystem* powerups = game->powerupSystem;
+    memset(powerups->powerups, 0, sizeof(Powerup) * powerups->capacity);
+    powerups->activePowerupCount = 0;
+    game->bossEscapeTriggered = false;
+    game->bossEscapeTimer = 0.0f;
+    game->bossEscapePhase = 0;
+    game->showingLevelComplete = false;
+    game->levelCompleteTimer = 0.0f;
+    
+    // Scroll speed follows game time
+    UpdateGameSpeed(game);
+    
+    // Keep the music in sync with the level clock
+    MusicStream_Seek(game->waveSystem->waveTimer);
+    
+    LogEvent(game, "[%.2f] DEBUG: Seek to level time %.2f", game->gameTime, game->waveSystem->waveTimer);
+    return true;
 }
 
 void UpdateGameSpeed(Game* game) {
@@ -204,7 +383,7 @@ void FireEnemyProjectile(Game* game, EnemyEx* enemy) {
     CombatContext ctx = {
         .playerPosition = game->playerShip->position,
         .projectiles = (Projectile*)game->projectiles,
-        .maxProjectiles = MAX_PROJECTILES,
+        .maxProjectiles = game->capacity.projectiles,
         .screenWidth = SCREEN_WIDTH,
         .screenHeight = SCREEN_HEIGHT
     };
@@ -212,35 +391,253 @@ void FireEnemyProjectile(Game* game, EnemyEx* enemy) {
     Combat_FireEnemyProjectile(&ctx, enemy);
 }
 
-void UpdateEnemies(Game* game) {
-    float deltaTime = GetFrameTime();
+void DrawEnemies(const Game* game, bool showHitbox) {
+    for (int i = 0; i < game->capacity.enemies; i++) {
+        if (game->enemies[i].active) {
+            DrawEnemyEx(&game->enemies[i]);
+            
+            // Debug: Show hitbox when requested
+            if (showHitbox) {
+                DrawRectangleLines(
+                    game->enemies[i].bounds.x, game->enemies[i].bounds.y,
+                    game->enemies[i].bounds.width, game->enemies[i].bounds.height,
+                    PINK
+                );
+            }
+        }
+    }
+}
+
+int CountActiveEnemies(const Game* game) {
+    int count = 0;
+    for (int i = 0; i < game->capacity.enemies; i++) {
+        if (game->enemies[i].active) count++;
+    }
+    return count;
+}
+
+// Items per job when the simulation stages are split into chunks
+#define ENEMY_JOB_CHUNK 8
+#define PROJECTILE_JOB_CHUNK 64
+#define EXPLOSION_JOB_CHUNK 8
+
+// Shared by the jobs of one tick's simulation stages
+typedef struct {
+    Game* game;
+    float deltaTime;
+    bool* enemyMoved;           // Per enemy slot: active when the movement ran, fires this tick
+    int* explosionsEnded;       // Per explosion slot: chunk results, at the chunk's first index
+} SimulationStages;
+
+// Per-slot scratch of the stage jobs, grown with the pools and reused from tick to tick
+static bool* s_enemyMoved = NULL;
+static int s_enemyMovedSize = 0;
+static int* s_explosionsEnded = NULL;
+static int s_explosionsEndedSize = 0;
+
+static bool ReserveStageScratch(const Game* game) {
+    if (s_enemyMovedSize < game->capacity.enemies) {
+        bool* enemyMoved = (bool*)realloc(s_enemyMoved, game->capacity.enemies * sizeof(bool));
+        if (!enemyMoved) {
+            return false;
+        }
+        s_enemyMoved = enemyMoved;
+        s_enemyMovedSize = game->capacity.enemies;
+    }
+    if (s_explosionsEndedSize < game->capacity.explosions) {
+        int* explosionsEnded = (int*)realloc(s_explosionsEnded, game->capacity.explosions * sizeof(int));
+        if (!explosionsEnded) {
+            return false;
+        }
+        s_explosionsEnded = explosionsEnded;
+        s_explosionsEndedSize = game->capacity.explosions;
+    }
+    
+    memset(s_enemyMoved, 0, game->capacity.enemies * sizeof(bool));
+    memset(s_explosionsEnded, 0, game->capacity.explosions * sizeof(int));
+    return true;
+}
+
+static void WaveJob(void* data, int begin, int end) {
+    SimulationStages* stages = (SimulationStages*)data;
+    (void)begin; (void)end;
+    UpdateWaveSystem(stages->game->waveSystem, stages->game, stages->deltaTime);
+}
+
+// Bosses draw random numbers while moving, so they move in BossMoveJob instead
+static void EnemyMoveJob(void* data, int begin, int end) {
+    SimulationStages* stages = (SimulationStages*)data;
+    for (int i = begin; i < end; i++) {
+        EnemyEx* enemy = &stages->game->enemies[i];
+        if (enemy->type == ENEMY_BOSS) continue;
+        
+        stages->enemyMoved[i] = enemy->active;
+        if (enemy->active) {
+            UpdateEnemyMovement(enemy, stages->deltaTime);
+        }
+    }
+}
+
+static void BossMoveJob(void* data, int begin, int end) {
+    SimulationStages* stages = (SimulationStages*)data;
+    (void)begin; (void)end;
+    for (int i = 0; i < stages->game->capacity.enemies; i++) {
+        EnemyEx* enemy = &stages->game->enemies[i];
+        if (enemy->type != ENEMY_BOSS) continue;
+        
+        stages->enemyMoved[i] = enemy->active;
+        if (enemy->active) {
+            UpdateEnemyMovement(enemy, stages->deltaTime);
+        }
+    }
+}
+
+// Firing takes free projectile slots in enemy order, so it runs as one job after all movement
+static void EnemyFireJob(void* data, int begin, int end) {
+    SimulationStages* stages = (SimulationStages*)data;
+    Game* game = stages->game;
+    (void)begin; (void)end;
     
-    // Create combat context for enemy firing
     CombatContext ctx = {
         .playerPosition = game->playerShip->position,
         .projectiles = (Projectile*)game->projectiles,
-        .maxProjectiles = MAX_PROJECTILES,
+        .maxProjectiles = game->capacity.projectiles,
         .screenWidth = SCREEN_WIDTH,
         .screenHeight = SCREEN_HEIGHT
     };
     
-    // Update all active enemies
-    for (int i = 0; i < MAX_ENEMIES; i++) {
-        if (game->enemies[i].active) {
-            EnemyEx* enemy = &game->enemies[i];
-            
-            // Update movement
-            UpdateEnemyMovement(enemy, deltaTime);
-            
-            // Update firing using generic combat system
-            Combat_UpdateEnemyFiring(enemy, &ctx, deltaTime, 
-                                     0, SCREEN_WIDTH, 
+    for (int i = 0; i < game->capacity.enemies; i++) {
+        if (stages->enemyMoved[i]) {
+            Combat_UpdateEnemyFiring(&game->enemies[i], &ctx, stages->deltaTime,
+                                     0, SCREEN_WIDTH,
                                      0, SCREEN_HEIGHT);
         }
     }
+}
+
+static void ProjectileJob(void* data, int begin, int end) {
+    SimulationStages* stages = (SimulationStages*)data;
+    ProjectileManager mgr = {
+        .projectiles = (Projectile*)stages->game->projectiles + begin,
+        .maxProjectiles = end - begin,
+        .minX = -100, .maxX = SCREEN_WIDTH + 100,
+        .minY = -100, .maxY = SCREEN_HEIGHT + 100
+    };
+    
+    ProjectileManager_UpdateAll(&mgr, stages->deltaTime);
+}
+
+static void ExplosionShakeJob(void* data, int begin, int end) {
+    SimulationStages* stages = (SimulationStages*)data;
+    (void)begin; (void)end;
+    UpdateExplosionShake(stages->game->explosionSystem, stages->deltaTime);
+}
+
+static void ExplosionJob(void* data, int begin, int end) {
+    SimulationStages* stages = (SimulationStages*)data;
+    stages->explosionsEnded[begin] = UpdateExplosionRange(stages->game->explosionSystem,
+                                                          begin, end, stages->deltaTime);
+}
+
+static void ExplosionFinishJob(void* data, int begin, int end) {
+    SimulationStages* stages = (SimulationStages*)data;
+    (void)begin; (void)end;
+    
+    int ended = 0;
+    for (int i = 0; i < stages->game->capacity.explosions; i++) {
+        ended += stages->explosionsEnded[i];
+    }
+    FinishExplosionUpdate(stages->game->explosionSystem, ended, stages->deltaTime);
+}
+
+static void PowerupJob(void* data, int begin, int end) {
+    SimulationStages* stages = (SimulationStages*)data;
+    (void)begin; (void)end;
+    UpdatePowerups(stages->game->powerupSystem, stages->game->playerShip, stages->deltaTime);
+}
+
+static void StarfieldJob(void* data, int begin, int end) {
+    SimulationStages* stages = (SimulationStages*)data;
+    Game* game = stages->game;
+    (void)begin; (void)end;
+    
+    for (int i = 0; i < game->numStars; i++) {
+        game->stars[i].position.x -= game->stars[i].speed * game->scrollSpeed;
+        if (game->stars[i].position.x < 0) {
+            game->stars[i].position.x = SCREEN_WIDTH;
+            game->stars[i].position.y = GameRandom_Int(0, SCREEN_HEIGHT);
+        }
+    }
+}
+
+// Update waves, enemies, projectiles, explosions, powerups and the starfield for one tick.
+// The stages run as a job graph on the worker threads. Jobs that write the same data, or
+// draw random numbers (waves -> boss movement -> screen shake -> starfield), are chained
+// in the order the stages used to run one after another, so the result is the same on any
+// number of threads.
+static void UpdateSimulationStages(Game* game, float deltaTime) {
+    static JobGraph graph;      // Rebuilt every tick (kept off the stack, about 20 KB)
+    if (!ReserveStageScratch(game)) {
+        fprintf(stderr, "Failed to allocate simulation stage buffers\n");
+        return;
+    }
+    SimulationStages stages = {
+        .game = game,
+        .deltaTime = deltaTime,
+        .enemyMoved = s_enemyMoved,
+        .explosionsEnded = s_explosionsEnded
+    };
+    
+    JobGraph_Init(&graph);
+    graph.timed = game->stressTest != NULL;
+    int waves = JobGraph_Add(&graph, WaveJob, &stages);
+    int enemyMoves = JobGraph_AddRange(&graph, EnemyMoveJob, &stages, game->capacity.enemies, ENEMY_JOB_CHUNK);
+    int bossMoves = JobGraph_Add(&graph, BossMoveJob, &stages);
+    int projectiles = JobGraph_AddRange(&graph, ProjectileJob, &stages, game->capacity.projectiles,
+                                        PROJECTILE_JOB_CHUNK);
+    int enemyFire = JobGraph_Add(&graph, EnemyFireJob, &stages);
+    int shake = JobGraph_Add(&graph, ExplosionShakeJob, &stages);
+    int explosions = JobGraph_AddRange(&graph, ExplosionJob, &stages, game->capacity.explosions,
+                                       EXPLOSION_JOB_CHUNK);
+    int explosionFinish = JobGraph_Add(&graph, ExplosionFinishJob, &stages);
+    int powerups = JobGraph_Add(&graph, PowerupJob, &stages);   // Independent of the other stages
+    int starfield = JobGraph_Add(&graph, StarfieldJob, &stages);
+    
+    // Enemies spawned this tick move and fire this tick
+    JobGraph_Depend(&graph, enemyMoves, waves);
+    JobGraph_Depend(&graph, bossMoves, waves);
+    
+    // New enemy shots are not moved until the next tick
+    JobGraph_Depend(&graph, enemyFire, enemyMoves);
+    JobGraph_Depend(&graph, enemyFire, bossMoves);
+    JobGraph_Depend(&graph, enemyFire, projectiles);
+    
+    JobGraph_Depend(&graph, explosionFinish, explosions);
+    
+    // Random number order
+    JobGraph_Depend(&graph, shake, bossMoves);
+    JobGraph_Depend(&graph, starfield, shake);
+    
+    double runStart = graph.timed ? GetTime() : 0.0;
+    JobGraph_Run(&graph);
+    
+    if (game->stressTest) {
+        double* stageMs = game->stressTest->stageMs;
+        stageMs[STRESS_STAGE_JOBS] = (GetTime() - runStart) * 1000.0;
+        stageMs[STRESS_STAGE_WAVES] = JobGraph_GetMilliseconds(&graph, waves);
+        stageMs[STRESS_STAGE_ENEMY_MOVE] = JobGraph_GetMilliseconds(&graph, enemyMoves) +
+                                           JobGraph_GetMilliseconds(&graph, bossMoves);
+        stageMs[STRESS_STAGE_ENEMY_FIRE] = JobGraph_GetMilliseconds(&graph, enemyFire);
+        stageMs[STRESS_STAGE_PROJECTILES] = JobGraph_GetMilliseconds(&graph, projectiles);
+        stageMs[STRESS_STAGE_EXPLOSIONS] = JobGraph_GetMilliseconds(&graph, shake) +
+                                           JobGraph_GetMilliseconds(&graph, explosions) +
+                                           JobGraph_GetMilliseconds(&graph, explosionFinish);
+        stageMs[STRESS_STAGE_POWERUPS] = JobGraph_GetMilliseconds(&graph, powerups);
+        stageMs[STRESS_STAGE_STARFIELD] = JobGraph_GetMilliseconds(&graph, starfield);
+    }
     
     // Check if boss has escaped or been destroyed
-    if (game->bossEnemyIndex >= 0 && game->bossEnemyIndex < MAX_ENEMIES) {
+    if (game->bossEnemyIndex >= 0 && game->bossEnemyIndex < game->capacity.enemies) {
         if (!game->enemies[game->bossEnemyIndex].active) {
             // Boss is no longer active - check if it escaped
             if (game->bossEscapeTriggered) {
@@ -251,43 +648,380 @@ void UpdateEnemies(Game* game) {
     }
 }
 
-void DrawEnemies(const Game* game, bool showHitbox) {
-    for (int i = 0; i < MAX_ENEMIES; i++) {
-        if (game->enemies[i].active) {
-            DrawEnemyEx(&game->enemies[i]);
+// Nudge the frame step toward the music position so spawns stay on the beat.
+// Large differences (music loop, seek still in flight) are left alone.
+static float MusicClockCorrection(const Game* game, float deltaTime) {
+    float levelTime = game->gameTime + game->tickAccumulator - game->levelStartTime;
+    float drift = MusicStream_GetTime() - levelTime;
+    if (fabsf(drift) > MUSIC_SYNC_MAX_DRIFT) {
+        return 0.0f;
+    }
+    
+    float correction = drift * MUSIC_SYNC_RATE;
+    float limit = deltaTime * MUSIC_SYNC_MAX_SLEW;
+    if (correction > limit) correction = limit;
+    if (correction < -limit) correction = -limit;
+    return correction;
+}
+
+// Advance the game by one fixed tick with the given input.
+// Everything that changes the outcome of a run happens here, driven only by the
+// tick input and the seeded random generator, so replaying the input reproduces it.
+static void StepGame(Game* game, InputTickState input) {
+    // Get level-specific timing (used throughout this function)
+    const LevelConfig* currentLevel = GetCurrentLevel(game->levelManager);
+    float levelDuration = currentLevel ? currentLevel->duration : 553.82f;
+    float deltaTime = SIM_TICK_TIME;
+    StressTest* stress = game->stressTest;
+    double tickStart = 0.0;
+    if (stress) {
+        StressTest_BeginTick(stress);
+        tickStart = GetTime();
+    }
+    
+    // Gameplay reads the tick input instead of the devices
+    if (game->inputManager) {
+        InputManager_BeginTick(game->inputManager, input, game->lastTickInput);
+    }
+    if (game->replayRecorder) {
+        Replay_RecordTick(game->replayRecorder, input);
+    }
+    game->lastTickInput = input;
+    
+    // Update game time
+    game->gameTime += deltaTime;
+    
+    // Update speed levels
+    UpdateGameSpeed(game);
+    
+    // Swept collision tests run from where everything starts the tick
+    Collision_BeginTick(game);
+    
+    // Update game components
+    // Update new player ship
+    UpdatePlayerShip(game->playerShip, deltaTime, game->inputManager);
+    
+    // Check for weapon powerup revive event and log it
+    static bool wasJustRevived = false;
+    if (game->playerShip->justRevived && !wasJustRevived) {
+        LogEvent(game, "[%.2f] SHIP REVIVED! Weapon powerup consumed. Hull restored: %d HP | Shield: 50%% | Weapon Power: Level %d",
+                game->gameTime, game->playerShip->health, game->playerShip->weaponPowerupCount);
+        wasJustRevived = true;
+    } else if (!game->playerShip->justRevived) {
+        wasJustRevived = false;
+    }
+    
+    // Player ship properties are used directly
+    
+    // Stress load goes in before anything moves
+    if (stress) {
+        StressTest_Populate(stress, game);
+    }
+    
+    // Use original bullet system
+    double stageStart = stress ? GetTime() : 0.0;
+    UpdateBullets(game);
+    if (stress) {
+        stress->stageMs[STRESS_STAGE_BULLETS] = (GetTime() - stageStart) * 1000.0;
+    }
+    
+    // Waves, enemies, projectiles, explosions, powerups and starfield (on the job threads)
+    UpdateSimulationStages(game, deltaTime);
+    
+    // Background scroll with dynamic speed
+    game->backgroundX -= game->scrollSpeed;
+    if (game->backgroundX <= -SCREEN_WIDTH) {
+        game->backgroundX = 0;
+    }
+    
+    // Boss escape sequence - starts AFTER boss has been alive for a certain time
+    // Level 1: 90 seconds after boss spawn (427s → 517s)
+    // Level 2: 70 seconds after boss spawn (530s → 600s)
+    // DRAMATIC PHASED SEQUENCE
+    if (!game->bossEscapeTriggered && game->bossSpawnTime >= 0) {
+        // Calculate boss battle duration (using level time)
+        float currentLevelTime = game->gameTime - game->levelStartTime;
+        float bossBattleTime = currentLevelTime - game->bossSpawnTime;  // Both in level time
+        float requiredBattleTime = (currentLevel && currentLevel->levelNumber == 2) ? 70.0f : 90.0f;
+        
+        // Check if boss has been alive long enough
+        if (bossBattleTime >= requiredBattleTime) {
+            // Check if boss is still active
+            if (game->bossEnemyIndex >= 0 && 
+                game->bossEnemyIndex < game->capacity.enemies && 
+                game->enemies[game->bossEnemyIndex].active &&
+                game->enemies[game->bossEnemyIndex].type == ENEMY_BOSS) {
+                
+                game->bossEscapeTriggered = true;
+                game->bossEscapePhase = 1;  // Start destruction phase
+                game->bossEscapeTimer = 0.0f;
+                game->enemies[game->bossEnemyIndex].isEscaping = true;
+                
+                LogEvent(game, "[%.2f] BOSS DOOMSDAY - Escape sequence initiated! (Boss alive for %.1fs)", 
+                        game->gameTime, bossBattleTime);
+            }
+        }
+    }
+    
+    // Handle dramatic boss escape phases
+    if (game->bossEscapeTriggered && game->bossEscapePhase > 0) {
+        game->bossEscapeTimer += deltaTime;
+        
+        // PHASE 1: DESTRUCTION (0-2.5 seconds) - Staggered explosions
+        if (game->bossEscapePhase == 1) {
+            // Destroy bullets immediately at start
+            if (game->bossEscapeTimer < 0.1f) {
+                for (int i = 0; i < game->capacity.bullets; i++) {
+                    if (game->bullets[i].active) {
+                        CreateExplosion(game->explosionSystem, game->bullets[i].position, EXPLOSION_SMALL);
+                        game->bullets[i].active = false;
+                    }
+                }
+            }
             
-            // Debug: Show hitbox when requested
-            if (showHitbox) {
-                DrawRectangleLines(
-                    game->enemies[i].bounds.x, game->enemies[i].bounds.y,
-                    game->enemies[i].bounds.width, game->enemies[i].bounds.height,
-                    PINK
-                );
+            // Destroy projectiles at 0.3s
+            if (game->bossEscapeTimer >= 0.3f && game->bossEscapeTimer < 0.4f) {
+                Projectile* projectiles = (Projectile*)game->projectiles;
+                for (int i = 0; i < game->capacity.projectiles; i++) {
+                    if (projectiles[i].active) {
+                        CreateExplosion(game->explosionSystem, projectiles[i].position, EXPLOSION_SMALL);
+                        projectiles[i].active = false;
+                    }
+                }
+            }
+            
+            // Destroy enemies in waves (0.5s - 2.0s)
+            if (game->bossEscapeTimer >= 0.5f && game->bossEscapeTimer < 2.0f) {
+                // Destroy a few enemies each frame for dramatic effect
+                int destroyCount = 0;
+                for (int i = 0; i < game->capacity.enemies && destroyCount < 2; i++) {
+                    if (game->enemies[i].active && i != game->bossEnemyIndex) {
+                        Color enemyColor = GetEnemyTypeColor(game->enemies[i].type);
+                        CreateEnemyExplosion(game->explosionSystem, game->enemies[i].position, 
+                                           enemyColor, game->enemies[i].bounds.width);
+                        game->enemies[i].active = false;
+                        destroyCount++;
+                    }
+                }
+            }
+            
+            // OBLITERATE THE PLAYER at 1.5s
+            if (game->bossEscapeTimer >= 1.5f && game->bossEscapeTimer < 1.6f) {
+                CreatePlayerExplosion(game->explosionSystem, game->playerShip->position);
+                game->playerShip->health = 0;
+                game->playerShip->maxHealth = 0;
+                game->playerShip->isVisible = false;  // Remove player ship from screen
+                LogEvent(game, "[%.2f] PLAYER OBLITERATED by boss doomsday attack!", game->gameTime);
+            }
+            
+            // Move to phase 2 after 2.5 seconds
+            if (game->bossEscapeTimer >= 2.5f) {
+                game->bossEscapePhase = 2;
+                game->bossEscapeTimer = 0.0f;
+                LogEvent(game, "[%.2f] Boss escaping through the chaos...", game->gameTime);
             }
         }
+        
+        // PHASE 2: BOSS ESCAPE (2.5s - until boss off screen)
+        else if (game->bossEscapePhase == 2) {
+            // Check if boss has escaped off screen
+            if (game->bossEnemyIndex >= 0 && game->bossEnemyIndex < game->capacity.enemies) {
+                EnemyEx* boss = &game->enemies[game->bossEnemyIndex];
+                
+                if (!boss->active || boss->position.x > SCREEN_WIDTH + 150) {
+                    // Boss has escaped!
+                    game->bossEscapePhase = 3;
+                    game->bossEscapeTimer = 0.0f;
+                    LogEvent(game, "[%.2f] Boss successfully escaped! Preparing final message...", game->gameTime);
+                }
+            } else {
+                // Boss was destroyed somehow during escape, move to phase 3
+                game->bossEscapePhase = 3;
+                game->bossEscapeTimer = 0.0f;
+            }
+        }
+        
+        // PHASE 3: SHOW GAME OVER (after 1 second delay)
+        else if (game->bossEscapePhase == 3) {
+            if (game->bossEscapeTimer >= 1.0f) {
+                // NOW show game over
+                game->gameOver = true;
+                strcpy(game->deathCause, "DEFEAT! The Boss escaped and obliterated everything!");
+                LogEvent(game, "[%.2f] GAME OVER - Boss escape complete", game->gameTime);
+                game->bossEscapePhase = 4;  // Mark as complete
+            }
+        }
+    }
+    
+    // Interlevel transition system
+    // Calculate time elapsed in current level (gameTime continues across levels)
+    float levelTime = game->gameTime - game->levelStartTime;
+    float timeRemaining = levelDuration - levelTime;
+    
+    // Show level complete overlay when 15 seconds remain
+    if (timeRemaining <= 15.0f && timeRemaining > 0.0f && !game->showingLevelComplete) {
+        game->showingLevelComplete = true;
+        game->levelCompleteTimer = 0.0f;
+        LogEvent(game, "[%.2f] Level %d completion overlay displayed - 15 seconds remaining", 
+                game->gameTime, currentLevel->levelNumber);
+    }
+    
+    // Update level complete timer
+    if (game->showingLevelComplete) {
+        game->levelCompleteTimer += deltaTime;
+    }
+    
+    // Check if level time limit reached
+    if (levelTime >= levelDuration && !game->bossEscapeTriggered) {
+        // Check if there's a next level
+        if (game->levelManager->currentLevel + 1 < game->levelManager->levelCount) {
+            // Transition to next level seamlessly
+            if (!game->transitioningToNextLevel) {
+                game->transitioningToNextLevel = true;
+                
+                LogEvent(game, "[%.2f] Level %d complete! Score: %d - Transitioning to next level...", 
+                        game->gameTime, currentLevel->levelNumber, game->score);
+                
+                // Note: Speed capping is now handled automatically in UpdateGameSpeed()
+                // based on game time vs level 1 duration
+                
+                // Advance to next level
+                AdvanceToNextLevel(game->levelManager);
+                const LevelConfig* nextLevel = GetCurrentLevel(game->levelManager);
+                
+                // Load new music
+                MusicStream_Unload();
+                if (AssetPack_FileExists(nextLevel->audioPath)) {
+                    if (MusicStream_Load(nextLevel->audioPath)) {
+                        MusicStream_Play();
+                        LogEvent(game, "[%.2f] Started music for level %d: %s", 
+                                game->gameTime, nextLevel->levelNumber, nextLevel->audioPath);
+                    }
+                }
+                
+                // Clear remaining enemies from previous level
+                for (int i = 0; i < game->capacity.enemies; i++) {
+                    game->enemies[i].active = false;
+                }
+                
+                // Clear remaining projectiles from previous level
+                Projectile* projectiles = (Projectile*)game->projectiles;
+                for (int i = 0; i < game->capacity.projectiles; i++) {
+                    projectiles[i].active = false;
+                }
+                
+                // Reinitialize wave system for new level
+                CleanupWaveSystem(game->waveSystem);
+                InitWaveSystem(game->waveSystem, nextLevel);  // waveTimer starts at 0
+                
+                // Mark the start of the new level (gameTime continues running)
+                // This allows speed to be preserved while level timer resets
+                game->levelStartTime = game->gameTime;
+                // Note: gameTime, speedLevel and scrollSpeed continue from previous level
+                RunTelemetry_BeginPhase(game->telemetry, nextLevel->levelNumber,
+                                        game->gameTime, game->score);
+                
+                // Reset boss tracking
+                game->bossEnemyIndex = -1;
+                game->bossSpawnTime = -1.0f;
+                game->bossEscapeTriggered = false;
+                game->bossEscapeTimer = 0.0f;
+                game->bossEscapePhase = 0;
+                
+                // Reset interlevel transition state
+                game->showingLevelComplete = false;
+                game->levelCompleteTimer = 0.0f;
+                game->transitioningToNextLevel = false;
+                
+                LogEvent(game, "[%.2f] Now playing Level %d: %s (Level Time: 0.00)", 
+                        game->gameTime, nextLevel->levelNumber, nextLevel->name);
+            }
+        } else {
+            // Last level completed - end game with victory
+            game->gameOver = true;
+            strcpy(game->deathCause, "VICTORY! You survived all levels!");
+            LogEvent(game, "[%.2f] All levels completed! Final score: %d", 
+                    game->gameTime, game->score);
+        }
+    }
+    
+    // Game over check (but not during boss escape sequence - that handles its own game over)
+    if (game->playerShip->health <= 0 && !game->bossEscapeTriggered) {
+        // Create dramatic player explosion
+        CreatePlayerExplosion(game->explosionSystem, game->playerShip->position);
+        game->gameOver = true;
+    }
+    
+    // Check collisions (powerup pickups included)
+    if (!game->gameOver) {
+        stageStart = stress ? GetTime() : 0.0;
+        CheckCollisions(game);
+        if (stress) {
+            stress->stageMs[STRESS_STAGE_COLLISIONS] = (GetTime() - stageStart) * 1000.0;
+        }
+    }
+    
+    if (game->inputManager) {
+        InputManager_EndTick(game->inputManager);
+    }
+    
+    if (stress) {
+        stress->stageMs[STRESS_STAGE_TICK] = (GetTime() - tickStart) * 1000.0;
+        StressTest_EndTick(stress, game, deltaTime);
     }
 }
 
-int CountActiveEnemies(const Game* game) {
-    int count = 0;
-    for (int i = 0; i < MAX_ENEMIES; i++) {
-        if (game->enemies[i].active) count++;
+// Compare the end of a playback with what was recorded
+static void FinishReplayPlayback(Game* game) {
+    const ReplayReader* reader = game->replayReader;
+    bool matches = reader->ticksRead == reader->info.tickCount && game->score == reader->info.score;
+    
+    if (reader->failed) {
+        printf("[REPLAY] Replay %d could not be read past tick %d\n", reader->info.id, reader->ticksRead);
+    } else {
+        printf("[REPLAY] Replay %d ended at tick %d/%d with score %d (recorded %d): %s\n",
+               reader->info.id, reader->ticksRead, reader->info.tickCount,
+               game->score, reader->info.score, matches ? "match" : "MISMATCH");
+    }
+    
+    if (!game->gameOver) {
+        game->gameOver = true;
+        strcpy(game->deathCause, "Replay ended");
     }
-    return count;
 }
 
-void UpdateProjectiles(Game* game) {
-    float deltaTime = GetFrameTime();
+// Practice mode: keep the tick for rewinding, and the tick a new level started in for retries
+static void RecordPracticeTick(Game* game) {
+    GameSnapshotHistory_Push(game->rewindHistory, game);
     
-    // Use projectile manager for cleaner code
-    ProjectileManager mgr = {
-        .projectiles = (Projectile*)game->projectiles,
-        .maxProjectiles = MAX_PROJECTILES,
-        .minX = -100, .maxX = SCREEN_WIDTH + 100,
-        .minY = -100, .maxY = SCREEN_HEIGHT + 100
-    };
+    if (game->levelStartTime == game->gameTime) {
+        GameSnapshot_Capture(game->levelCheckpoint, game);
+    }
+}
+
+bool RestoreGameSnapshot(Game* game, const GameSnapshot* snapshot) {
+    int levelNumber = GetCurrentLevel(game->levelManager)->levelNumber;
+    if (!GameSnapshot_Restore(snapshot, game)) {
+        printf("[GAME] WARNING: Snapshot restore failed\n");
+        return false;
+    }
+    
+    DropReplayRecording(game);
+    
+    // Keep the music in sync with the level clock (another track if the snapshot is from another level)
+    const LevelConfig* level = GetCurrentLevel(game->levelManager);
+    if (level->levelNumber != levelNumber) {
+        MusicStream_Unload();
+        if (AssetPack_FileExists(level->audioPath) && MusicStream_Load(level->audioPath)) {
+            MusicStream_Play();
+        }
+    }
+    MusicStream_Seek(game->waveSystem->waveTimer);
     
-    ProjectileManager_UpdateAll(&mgr, deltaTime);
+    // Frame time and hotkeys from before the restore do not carry over
+    game->tickAccumulator = 0.0f;
+    game->pendingHotkey = 0;
+    return true;
 }
 
 void UpdateGame(Game* game) {
@@ -295,319 +1029,157 @@ void UpdateGame(Game* game) {
     if (game->justStarted) {
         game->justStarted = false;
         // Still update music
-        if (game->musicLoaded) {
-            UpdateMusicStream(game->backgroundMusic);
-        }
+        MusicStream_Update();
         return;  // Skip all other updates on first frame
     }
     
-    // Update music stream if loaded
-    if (game->musicLoaded) {
-        UpdateMusicStream(game->backgroundMusic);
+    // Update music stream (no-op when streaming from the audio thread)
+    MusicStream_Update();
+    
+    // Practice mode: holding BACKSPACE runs the last ticks backwards (out of a game over too)
+    if (game->rewindHistory && !game->gamePaused && IsKeyDown(KEY_BACKSPACE)) {
+        const GameSnapshot* snapshot = GameSnapshotHistory_StepBack(game->rewindHistory, 1);
+        if (snapshot) {
+            RestoreGameSnapshot(game, snapshot);
+        }
+        return;
     }
     
     if (!game->gameOver) {
-        // Get level-specific timing (used throughout this function)
-        const LevelConfig* currentLevel = GetCurrentLevel(game->levelManager);
-        float levelDuration = currentLevel ? currentLevel->duration : 553.82f;
-        
         // Only update if not paused
         if (!game->gamePaused) {
-            // Update game time
-            float deltaTime = GetFrameTime();
-            game->gameTime += deltaTime;
+            float frameTime = GetFrameTime();
+            RunTelemetry_RecordFrame(game->telemetry, frameTime);
             
-            // Update speed levels
-            UpdateGameSpeed(game);
-            
-            // Update game components
-            // Update new player ship
-            UpdatePlayerShip(game->playerShip, deltaTime, game->inputManager);
-            
-            // Check for weapon powerup revive event and log it
-            static bool wasJustRevived = false;
-            if (game->playerShip->justRevived && !wasJustRevived) {
-                LogEvent(game, "[%.2f] SHIP REVIVED! Weapon powerup consumed. Hull restored: %d HP | Shield: 50%% | Weapon Power: Level %d",
-                        game->gameTime, game->playerShip->health, game->playerShip->weaponPowerupCount);
-                wasJustRevived = true;
-            } else if (!game->playerShip->justRevived) {
-                wasJustRevived = false;
+            // Discipline the level clock against the music actually being heard
+            if (MUSIC_CLOCK_SYNC && MusicStream_IsPlaying()) {
+                frameTime += MusicClockCorrection(game, frameTime);
             }
+            game->tickAccumulator += frameTime;
             
-            // Player ship properties are used directly
-            
-            // Use original bullet system
-            UpdateBullets(game);
-            UpdateProjectiles(game);
-            UpdateWaveSystem(game->waveSystem, game, deltaTime);
-            UpdateEnemies(game);
-            
-            // Update explosion system
-            UpdateExplosionSystem(game->explosionSystem, deltaTime);
-            
-            // Update powerup system
-            UpdatePowerups(game->powerupSystem, game->playerShip, deltaTime);
-            
-            // Update starfield
-            for (int i = 0; i < game->numStars; i++) {
-                game->stars[i].position.x -= game->stars[i].speed * game->scrollSpeed;
-                if (game->stars[i].position.x < 0) {
-                    game->stars[i].position.x = SCREEN_WIDTH;
-                    game->stars[i].position.y = GetRandomValue(0, SCREEN_HEIGHT);
+            // Debug timeline seeking (restores enemies from pre-rolled checkpoints)
+            if (DEBUG_SEEK_KEYS && !game->replayReader) {
+                float levelTime = game->gameTime - game->levelStartTime;
+                if (IsKeyPressed(KEY_PAGE_DOWN)) {
+                    SeekGameToTime(game, levelTime + DEBUG_SEEK_STEP);
+                } else if (IsKeyPressed(KEY_PAGE_UP)) {
+                    SeekGameToTime(game, levelTime - DEBUG_SEEK_STEP);
                 }
             }
             
-            // Background scroll with dynamic speed
-            game->backgroundX -= game->scrollSpeed;
-            if (game->backgroundX <= -SCREEN_WIDTH) {
-                game->backgroundX = 0;
+            // Devices are read once per frame; a hotkey press waits for the next tick that runs
+            InputTickState input = 0;
+            if (game->inputManager) {
+                input = InputManager_SampleTick(game->inputManager);
             }
-            
-            // Boss escape sequence - starts AFTER boss has been alive for a certain time
-            // Level 1: 90 seconds after boss spawn (427s → 517s)
-            // Level 2: 70 seconds after boss spawn (530s → 600s)
-            // DRAMATIC PHASED SEQUENCE
-            if (!game->bossEscapeTriggered && game->bossSpawnTime >= 0) {
-                // Calculate boss battle duration (using level time)
-                float currentLevelTime = game->gameTime - game->levelStartTime;
-                float bossBattleTime = currentLevelTime - game->bossSpawnTime;  // Both in level time
-                float requiredBattleTime = (currentLevel && currentLevel->levelNumber == 2) ? 70.0f : 90.0f;
-                
-                // Check if boss has been alive long enough
-                if (bossBattleTime >= requiredBattleTime) {
-                    // Check if boss is still active
-                    if (game->bossEnemyIndex >= 0 && 
-                        game->bossEnemyIndex < MAX_ENEMIES && 
-                        game->enemies[game->bossEnemyIndex].active &&
-                        game->enemies[game->bossEnemyIndex].type == ENEMY_BOSS) {
-                        
-                        game->bossEscapeTriggered = true;
-                        game->bossEscapePhase = 1;  // Start destruction phase
-                        game->bossEscapeTimer = 0.0f;
-                        game->enemies[game->bossEnemyIndex].isEscaping = true;
-                        
-                        LogEvent(game, "[%.2f] BOSS DOOMSDAY - Escape sequence initiated! (Boss alive for %.1fs)", 
-                                game->gameTime, bossBattleTime);
-                    }
-                }
+            if (!(input & INPUT_TICK_HOTKEY_MASK)) {
+                input |= game->pendingHotkey;
             }
+            game->pendingHotkey = input & INPUT_TICK_HOTKEY_MASK;
             
-            // Handle dramatic boss escape phases
-            if (game->bossEscapeTriggered && game->bossEscapePhase > 0) {
-                game->bossEscapeTimer += deltaTime;
-                
-                // PHASE 1: DESTRUCTION (0-2.5 seconds) - Staggered explosions
-                if (game->bossEscapePhase == 1) {
-                    // Destroy bullets immediately at start
-                    if (game->bossEscapeTimer < 0.1f) {
-                        for (int i = 0; i < MAX_BULLETS; i++) {
-                            if (game->bullets[i].active) {
-                                CreateExplosion(game->explosionSystem, game->bullets[i].position, EXPLOSION_SMALL);
-                                game->bullets[i].active = false;
-                            }
-                        }
-                    }
-                    
-                    // Destroy projectiles at 0.3s
-                    if (game->bossEscapeTimer >= 0.3f && game->bossEscapeTimer < 0.4f) {
-                        Projectile* projectiles = (Projectile*)game->projectiles;
-                        for (int i = 0; i < MAX_PROJECTILES; i++) {
-                            if (projectiles[i].active) {
-                                CreateExplosion(game->explosionSystem, projectiles[i].position, EXPLOSION_SMALL);
-                                projectiles[i].active = false;
-                            }
-                        }
-                    }
-                    
-                    // Destroy enemies in waves (0.5s - 2.0s)
-                    if (game->bossEscapeTimer >= 0.5f && game->bossEscapeTimer < 2.0f) {
-                        // Destroy a few enemies each frame for dramatic effect
-                        int destroyCount = 0;
-                        for (int i = 0; i < MAX_ENEMIES && destroyCount < 2; i++) {
-                            if (game->enemies[i].active && i != game->bossEnemyIndex) {
-                                Color enemyColor = GetEnemyTypeColor(game->enemies[i].type);
-                                CreateEnemyExplosion(game->explosionSystem, game->enemies[i].position, 
-                                                   enemyColor, game->enemies[i].bounds.width);
-                                game->enemies[i].active = false;
-                                destroyCount++;
-                            }
-                        }
-                    }
-                    
-                    // OBLITERATE THE PLAYER at 1.5s
-                    if (game->bossEscapeTimer >= 1.5f && game->bossEscapeTimer < 1.6f) {
-                        CreatePlayerExplosion(game->explosionSystem, game->playerShip->position);
-                        game->playerShip->health = 0;
-                        game->playerShip->maxHealth = 0;
-                        game->playerShip->isVisible = false;  // Remove player ship from screen
-                        LogEvent(game, "[%.2f] PLAYER OBLITERATED by boss doomsday attack!", game->gameTime);
-                    }
-                    
-                    // Move to phase 2 after 2.5 seconds
-                    if (game->bossEscapeTimer >= 2.5f) {
-                        game->bossEscapePhase = 2;
-                        game->bossEscapeTimer = 0.0f;
-                        LogEvent(game, "[%.2f] Boss escaping through the chaos...", game->gameTime);
-                    }
+            // Run the ticks this frame covers
+            int ticks = 0;
+            while (game->tickAccumulator >= SIM_TICK_TIME && !game->gameOver) {
+                if (ticks == SIM_MAX_TICKS_PER_FRAME) {
+                    game->tickAccumulator = 0.0f;
+                    break;
                 }
                 
-                // PHASE 2: BOSS ESCAPE (2.5s - until boss off screen)
-                else if (game->bossEscapePhase == 2) {
-                    // Check if boss has escaped off screen
-                    if (game->bossEnemyIndex >= 0 && game->bossEnemyIndex < MAX_ENEMIES) {
-                        EnemyEx* boss = &game->enemies[game->bossEnemyIndex];
-                        
-                        if (!boss->active || boss->position.x > SCREEN_WIDTH + 150) {
-                            // Boss has escaped!
-                            game->bossEscapePhase = 3;
-                            game->bossEscapeTimer = 0.0f;
-                            LogEvent(game, "[%.2f] Boss successfully escaped! Preparing final message...", game->gameTime);
-                        }
-                    } else {
-                        // Boss was destroyed somehow during escape, move to phase 3
-                        game->bossEscapePhase = 3;
-                        game->bossEscapeTimer = 0.0f;
-                    }
+                if (game->replayReader && !Replay_NextInput(game->replayReader, &input)) {
+                    FinishReplayPlayback(game);
+                    break;
                 }
                 
-                // PHASE 3: SHOW GAME OVER (after 1 second delay)
-                else if (game->bossEscapePhase == 3) {
-                    if (game->bossEscapeTimer >= 1.0f) {
-                        // NOW show game over
-                        game->gameOver = true;
-                        strcpy(game->deathCause, "DEFEAT! The Boss escaped and obliterated everything!");
-                        LogEvent(game, "[%.2f] GAME OVER - Boss escape complete", game->gameTime);
-                        game->bossEscapePhase = 4;  // Mark as complete
-                    }
+                StepGame(game, input);
+                game->tickAccumulator -= SIM_TICK_TIME;
+                ticks++;
+                
+                if (game->rewindHistory) {
+                    RecordPracticeTick(game);
                 }
-            }
-            
-            // Interlevel transition system
-            // Calculate time elapsed in current level (gameTime continues across levels)
-            float levelTime = game->gameTime - game->levelStartTime;
-            float timeRemaining = levelDuration - levelTime;
-            
-            // Show level complete overlay when 15 seconds remain
-            if (timeRemaining <= 15.0f && timeRemaining > 0.0f && !game->showingLevelComplete) {
-                game->showingLevelComplete = true;
-                game->levelCompleteTimer = 0.0f;
-                LogEvent(game, "[%.2f] Level %d completion overlay displayed - 15 seconds remaining", 
-                        game->gameTime, currentLevel->levelNumber);
-            }
-            
-            // Update level complete timer
-            if (game->showingLevelComplete) {
-                game->levelCompleteTimer += deltaTime;
-            }
-            
-            // Check if level time limit reached
-            if (levelTime >= levelDuration && !game->bossEscapeTriggered) {
-                // Check if there's a next level
-                if (game->levelManager->currentLevel + 1 < game->levelManager->levelCount) {
-                    // Transition to next level seamlessly
-                    if (!game->transitioningToNextLevel) {
-                        game->transitioningToNextLevel = true;
-                        
-                        LogEvent(game, "[%.2f] Level %d complete! Score: %d - Transitioning to next level...", 
-                                game->gameTime, currentLevel->levelNumber, game->score);
-                        
-                        // Note: Speed capping is now handled automatically in UpdateGameSpeed()
-                        // based on game time vs level 1 duration
-                        
-                        // Advance to next level
-                        AdvanceToNextLevel(game->levelManager);
-                        const LevelConfig* nextLevel = GetCurrentLevel(game->levelManager);
-                        
-                        // Load new music
-                        if (game->musicLoaded) {
-                            StopMusicStream(game->backgroundMusic);
-                            UnloadMusicStream(game->backgroundMusic);
-                        }
-                        
-                        game->musicLoaded = false;
-                        if (FileExists(nextLevel->audioPath)) {
-                            game->backgroundMusic = LoadMusicStream(nextLevel->audioPath);
-                            if (game->backgroundMusic.ctxType > 0) {
-                                game->musicLoaded = true;
-                                PlayMusicStream(game->backgroundMusic);
-                                SetMusicVolume(game->backgroundMusic, game->musicVolume);
-                                LogEvent(game, "[%.2f] Started music for level %d: %s", 
-                                        game->gameTime, nextLevel->levelNumber, nextLevel->audioPath);
-                            }
-                        }
-                        
-                        // Clear remaining enemies from previous level
-                        for (int i = 0; i < MAX_ENEMIES; i++) {
-                            game->enemies[i].active = false;
-                        }
-                        
-                        // Clear remaining projectiles from previous level
-                        Projectile* projectiles = (Projectile*)game->projectiles;
-                        for (int i = 0; i < MAX_PROJECTILES; i++) {
-                            projectiles[i].active = false;
-                        }
-                        
-                        // Reinitialize wave system for new level
-                        CleanupWaveSystem(game->waveSystem);
-                        InitWaveSystem(game->waveSystem, nextLevel, false);  // NO debug phase - start at 0
-                        
-                        // Mark the start of the new level (gameTime continues running)
-                        // This allows speed to be preserved while level timer resets
-                        game->levelStartTime = game->gameTime;
-                        // Note: gameTime, speedLevel and scrollSpeed continue from previous level
-                        
-                        // Reset boss tracking
-                        game->bossEnemyIndex = -1;
-                        game->bossSpawnTime = -1.0f;
-                        game->bossEscapeTriggered = false;
-                        game->bossEscapeTimer = 0.0f;
-                        game->bossEscapePhase = 0;
-                        
-                        // Reset interlevel transition state
-                        game->showingLevelComplete = false;
-                        game->levelCompleteTimer = 0.0f;
-                        game->transitioningToNextLevel = false;
-                        
-                        LogEvent(game, "[%.2f] Now playing Level %d: %s (Level Time: 0.00)", 
-                                game->gameTime, nextLevel->levelNumber, nextLevel->name);
-                    }
-                } else {
-                    // Last level completed - end game with victory
-                    game->gameOver = true;
-                    strcpy(game->deathCause, "VICTORY! You survived all levels!");
-                    LogEvent(game, "[%.2f] All levels completed! Final score: %d", 
-                            game->gameTime, game->score);
+                
+                // A hotkey press applies to one tick
+                input &= ~INPUT_TICK_HOTKEY_MASK;
+                game->pendingHotkey = 0;
+                
+                if (game->replayReader && game->gameOver) {
+                    FinishReplayPlayback(game);
                 }
             }
-            
-            // Game over check (but not during boss escape sequence - that handles its own game over)
-            if (game->playerShip->health <= 0 && !game->bossEscapeTriggered) {
-                // Create dramatic player explosion
-                CreatePlayerExplosion(game->explosionSystem, game->playerShip->position);
-                game->gameOver = true;
-            }
         }
     } else {
-        // Restart game on R key press
+        // Restart game on R key press (practice mode retries the level from its start)
         if (IsKeyPressed(KEY_R)) {
-            CleanupGame(game);
-            InitGame(game);
+            if (game->levelCheckpoint && RestoreGameSnapshot(game, game->levelCheckpoint)) {
+                GameSnapshotHistory_Clear(game->rewindHistory);
+                GameSnapshotHistory_Push(game->rewindHistory, game);
+            } else {
+                InputManager* inputManager = game->inputManager;  // Owned by main.c
+                CleanupGame(game);
+                InitGame(game);
+                game->inputManager = inputManager;
+            }
         }
     }
 }
 
+bool TakeGameReplay(Game* game, DBReplayInfo* info, unsigned char** outData) {
+    if (!game->replayRecorder) {
+        return false;
+    }
+    
+    int tickCount = game->replayRecorder->tickCount;
+    int size = 0;
+    bool ok = Replay_FinishRecorder(game->replayRecorder, outData, &size);
+    free(game->replayRecorder);
+    game->replayRecorder = NULL;
+    if (!ok) {
+        return false;
+    }
+    
+    const LevelConfig* level = GetCurrentLevel(game->levelManager);
+    memset(info, 0, sizeof(DBReplayInfo));
+    info->formatVersion = REPLAY_FORMAT_VERSION;
+    info->seed = game->seed;
+    info->startLevel = game->startLevel;
+    info->finalLevel = level ? level->levelNumber : game->startLevel;
+    info->tickRate = SIM_TICK_RATE;
+    info->tickCount = tickCount;
+    info->score = game->score;
+    info->dataSize = size;
+    return true;
+}
+
 void CleanupGame(Game* game) {
+    // The run ends here (game over, exit to menu or restart): queue its telemetry
+    // (a replay playback is not a run of its own, and a practice run's rewinds and retries
+    // leave kills and damage from abandoned timelines in the telemetry)
+    if (game->telemetry) {
+        if (!game->replayReader && !game->stressTest && !game->rewindHistory) {
+            RunTelemetry_Submit(game->telemetry, game);
+        }
+        free(game->telemetry);
+        game->telemetry = NULL;
+    }
+    
+    // A recording nobody took is dropped
+    if (game->replayRecorder) {
+        Replay_FreeRecorder(game->replayRecorder);
+        free(game->replayRecorder);
+        game->replayRecorder = NULL;
+    }
+    if (game->replayReader) {
+        free(game->replayReader);
+        game->replayReader = NULL;
+    }
+    
     CloseLogger(game);
     
     // Clear input manager reference (it's owned by main.c, not freed here)
     game->inputManager = NULL;
     
     // Cleanup audio
-    if (game->musicLoaded) {
-        StopMusicStream(game->backgroundMusic);
-        UnloadMusicStream(game->backgroundMusic);
-        game->musicLoaded = false;
-    }
+    MusicStream_Unload();
     // Note: Don't call CloseAudioDevice() here - Raylib handles it on window close
     
     // Free level manager
@@ -624,12 +1196,27 @@ void CleanupGame(Game* game) {
         game->waveSystem = NULL;
     }
     
+    // Free seek checkpoints
+    if (game->waveTimeline) {
+        WaveTimeline_Cleanup(game->waveTimeline);
+        free(game->waveTimeline);
+        game->waveTimeline = NULL;
+    }
+    
     // Free explosion system
     if (game->explosionSystem) {
+        CleanupExplosionSystem(game->explosionSystem);
         free(game->explosionSystem);
         game->explosionSystem = NULL;
     }
     
+    // Free collision events
+    if (game->collisionEvents) {
+        Collision_CleanupEventQueue(game->collisionEvents);
+        free(game->collisionEvents);
+        game->collisionEvents = NULL;
+    }
+    
     // Free powerup system
     if (game->powerupSystem) {
         CleanupPowerupSystem(game->powerupSystem);
@@ -662,12 +1249,25 @@ void CleanupGame(Game* game) {
         free(game->enemies);
         game->enemies = NULL;
     }
+    
+    // Stage scratch is sized for this run's pools
+    free(s_enemyMoved);
+    s_enemyMoved = NULL;
+    s_enemyMovedSize = 0;
+    free(s_explosionsEnded);
+    s_explosionsEnded = NULL;
+    s_explosionsEndedSize = 0;
+    
+    if (game->stressTest) {
+        free(game->stressTest);
+        game->stressTest = NULL;
+    }
+    
+    CleanupPractice(game);
 }
 
 void SetGameMusicVolume(Game* game, float volume) {
     game->musicVolume = volume;
-    if (game->musicLoaded) {
-        SetMusicVolume(game->backgroundMusic, volume);
-    }
+    MusicStream_SetVolume(volume);
 }
 
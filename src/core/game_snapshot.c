@@ -0,0 +1,541 @@
+#include "game_snapshot.h"
+#include "game_random.h"
+#include "player_ship.h"
+#include "enemy_types.h"
+#include "projectile_types.h"
+#include "wave_system.h"
+#include "level_system.h"
+#include "explosion.h"
+#include "powerup.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Shorter stretches of unchanged bytes inside a delta are cheaper to store as changed
+#define DELTA_MIN_SKIP 8
+
+// Everything that is not a pool, at the start of the buffer
+typedef struct {
+    int size;                       // Whole snapshot in bytes
+    PoolCapacity capacity;
+    int numStars;
+    int levelNumber;
+
+    // Run state
+    int score;
+    float backgroundX;
+    bool gameOver;
+    float gameTime;
+    float scrollSpeed;
+    int speedLevel;
+    unsigned int lastTickInput;
+    char deathCause[256];           // Same size as Game.deathCause
+    int nextEnemyId;
+    int nextProjectileId;
+
+    // Boss escape sequence
+    int bossEnemyIndex;
+    float bossSpawnTime;
+    bool bossEscapeTriggered;
+    float bossEscapeTimer;
+    int bossEscapePhase;
+
+    // Level transition
+    bool showingLevelComplete;
+    float levelCompleteTimer;
+    bool transitioningToNextLevel;
+    float levelStartTime;
+    float maxScrollSpeed;
+
+    // Subsystems (their pointers are stored but never restored)
+    PlayerShip player;
+    WaveSystem waves;
+    ExplosionSystem explosions;
+    PowerupSystem powerups;
+    uint64_t random;
+} SnapshotState;
+
+// Pools, in buffer order after the state
+enum {
+    SECTION_BULLETS,
+    SECTION_ENEMIES,
+    SECTION_PROJECTILES,
+    SECTION_STARS,
+    SECTION_EXPLOSIONS,
+    SECTION_POWERUPS,
+    SECTION_COUNT
+};
+
+typedef struct {
+    const char* name;
+    void* data;                     // Pool in the game (NULL when only the layout is needed)
+    int elementSize;
+    int count;
+} SnapshotSection;
+
+static void GetSections(const SnapshotState* state, const Game* game, SnapshotSection* sections) {
+    const PoolCapacity* capacity = &state->capacity;
+
+    sections[SECTION_BULLETS] = (SnapshotSection){
+        "bullets", game ? game->bullets : NULL, sizeof(Bullet), capacity->bullets
+    };
+    sections[SECTION_ENEMIES] = (SnapshotSection){
+        "enemies", game ? game->enemies : NULL, sizeof(EnemyEx), capacity->enemies
+    };
+    sections[SECTION_PROJECTILES] = (SnapshotSection){
+        "projectiles", game ? game->projectiles : NULL, sizeof(Projectile), capacity->projectiles
+    };
+    sections[SECTION_STARS] = (SnapshotSection){
+        "stars", game ? game->stars : NULL, sizeof(Star), state->numStars
+    };
+    sections[SECTION_EXPLOSIONS] = (SnapshotSection){
+        "explosions", game ? game->explosionSystem->explosions : NULL, sizeof(Explosion), capacity->explosions
+    };
+    sections[SECTION_POWERUPS] = (SnapshotSection){
+        "powerups", game ? game->powerupSystem->powerups : NULL, sizeof(Powerup), capacity->powerups
+    };
+}
+
+static bool Reserve(unsigned char** data, int* capacity, int size) {
+    if (size <= *capacity) {
+        return true;
+    }
+
+    unsigned char* grown = (unsigned char*)realloc(*data, size);
+    if (!grown) {
+        fprintf(stderr, "Failed to allocate a %d byte game snapshot\n", size);
+        return false;
+    }
+    *data = grown;
+    *capacity = size;
+    return true;
+}
+
+bool GameSnapshot_Capture(GameSnapshot* snapshot, const Game* game) {
+    // Zeroed first so bytes no field covers are the same in every capture. Structs are copied
+    // with memcpy: struct assignment need not copy padding, which would show up in deltas.
+    SnapshotState state;
+    memset(&state, 0, sizeof(SnapshotState));
+
+    memcpy(&state.capacity, &game->capacity, sizeof(PoolCapacity));
+    state.numStars = game->numStars;
+    state.levelNumber = GetCurrentLevel(game->levelManager)->levelNumber;
+
+    state.score = game->score;
+    state.backgroundX = game->backgroundX;
+    state.gameOver = game->gameOver;
+    state.gameTime = game->gameTime;
+    state.scrollSpeed = game->scrollSpeed;
+    state.speedLevel = game->speedLevel;
+    state.lastTickInput = game->lastTickInput;
+    memcpy(state.deathCause, game->deathCause, sizeof(state.deathCause));
+    state.nextEnemyId = game->nextEnemyId;
+    state.nextProjectileId = game->nextProjectileId;
+
+    state.bossEnemyIndex = game->bossEnemyIndex;
+    state.bossSpawnTime = game->bossSpawnTime;
+    state.bossEscapeTriggered = game->bossEscapeTriggered;
+    state.bossEscapeTimer = game->bossEscapeTimer;
+    state.bossEscapePhase = game->bossEscapePhase;
+
+    state.showingLevelComplete = game->showingLevelComplete;
+    state.levelCompleteTimer = game->levelCompleteTimer;
+    state.transitioningToNextLevel = game->transitioningToNextLevel;
+    state.levelStartTime = game->levelStartTime;
+    state.maxScrollSpeed = game->maxScrollSpeed;
+
+    memcpy(&state.player, game->playerShip, sizeof(PlayerShip));
+    memcpy(&state.waves, game->waveSystem, sizeof(WaveSystem));
+    memcpy(&state.explosions, game->explosionSystem, sizeof(ExplosionSystem));
+    memcpy(&state.powerups, game->powerupSystem, sizeof(PowerupSystem));
+    state.random = GameRandom_GetState();
+
+    SnapshotSection sections[SECTION_COUNT];
+    GetSections(&state, game, sections);
+    int size = (int)sizeof(SnapshotState);
+    for (int s = 0; s < SECTION_COUNT; s++) {
+        size += sections[s].elementSize * sections[s].count;
+    }
+    state.size = size;
+
+    if (!Reserve(&snapshot->data, &snapshot->capacity, size)) {
+        return false;
+    }
+
+    unsigned char* out = snapshot->data;
+    memcpy(out, &state, sizeof(SnapshotState));
+    out += sizeof(SnapshotState);
+    for (int s = 0; s < SECTION_COUNT; s++) {
+        int bytes = sections[s].elementSize * sections[s].count;
+        memcpy(out, sections[s].data, bytes);
+        out += bytes;
+    }
+    snapshot->size = size;
+    return true;
+}
+
+bool GameSnapshot_Restore(const GameSnapshot* snapshot, Game* game) {
+    if (snapshot->size < (int)sizeof(SnapshotState)) {
+        fprintf(stderr, "Game snapshot is empty\n");
+        return false;
+    }
+
+    SnapshotState state;
+    memcpy(&state, snapshot->data, sizeof(SnapshotState));
+    if (state.size != snapshot->size || state.numStars != game->numStars ||
+        memcmp(&state.capacity, &game->capacity, sizeof(PoolCapacity)) != 0) {
+        fprintf(stderr, "Game snapshot does not fit this game (different pool sizes)\n");
+        return false;
+    }
+
+    // Taken in another level: its wave plan is loaded first
+    if (GetCurrentLevel(game->levelManager)->levelNumber != state.levelNumber) {
+        const LevelConfig* level = GetLevel(game->levelManager, state.levelNumber);
+        if (!level) {
+            fprintf(stderr, "Game snapshot is from level %d, which does not exist\n", state.levelNumber);
+            return false;
+        }
+        ResetToLevel(game->levelManager, state.levelNumber);
+        CleanupWaveSystem(game->waveSystem);
+        InitWaveSystem(game->waveSystem, level);
+    }
+
+    game->score = state.score;
+    game->backgroundX = state.backgroundX;
+    game->gameOver = state.gameOver;
+    game->gameTime = state.gameTime;
+    game->scrollSpeed = state.scrollSpeed;
+    game->speedLevel = state.speedLevel;
+    game->lastTickInput = state.lastTickInput;
+    memcpy(game->deathCause, state.deathCause, sizeof(state.deathCause));
+    game->nextEnemyId = state.nextEnemyId;
+    game->nextProjectileId = state.nextProjectileId;
+
+    game->bossEnemyIndex = state.bossEnemyIndex;
+    game->bossSpawnTime = state.bossSpawnTime;
+    game->bossEscapeTriggered = state.bossEscapeTriggered;
+    game->bossEscapeTimer = state.bossEscapeTimer;
+    game->bossEscapePhase = state.bossEscapePhase;
+
+    game->showingLevelComplete = state.showingLevelComplete;
+    game->levelCompleteTimer = state.levelCompleteTimer;
+    game->transitioningToNextLevel = state.transitioningToNextLevel;
+    game->levelStartTime = state.levelStartTime;
+    game->maxScrollSpeed = state.maxScrollSpeed;
+
+    // memcpy keeps the padding too, so a capture right after a restore matches the snapshot
+    memcpy(game->playerShip, &state.player, sizeof(PlayerShip));
+
+    // The wave plan and its index stay the ones loaded for the level
+    WaveSystem* waves = game->waveSystem;
+    state.waves.phases = waves->phases;
+    state.waves.phaseCount = waves->phaseCount;
+    state.waves.spawnEvents = waves->spawnEvents;
+    state.waves.eventCount = waves->eventCount;
+    state.waves.eventBuckets = waves->eventBuckets;
+    state.waves.bucketCount = waves->bucketCount;
+    memcpy(waves, &state.waves, sizeof(WaveSystem));
+
+    state.explosions.explosions = game->explosionSystem->explosions;
+    state.explosions.capacity = game->explosionSystem->capacity;
+    memcpy(game->explosionSystem, &state.explosions, sizeof(ExplosionSystem));
+
+    state.powerups.powerups = game->powerupSystem->powerups;
+    state.powerups.capacity = game->powerupSystem->capacity;
+    memcpy(game->powerupSystem, &state.powerups, sizeof(PowerupSystem));
+
+    GameRandom_SetState(state.random);
+
+    SnapshotSection sections[SECTION_COUNT];
+    GetSections(&state, game, sections);
+    const unsigned char* in = snapshot->data + sizeof(SnapshotState);
+    for (int s = 0; s < SECTION_COUNT; s++) {
+        int bytes = sections[s].elementSize * sections[s].count;
+        memcpy(sections[s].data, in, bytes);
+        in += bytes;
+    }
+    return true;
+}
+
+void GameSnapshot_Free(GameSnapshot* snapshot) {
+    free(snapshot->data);
+    memset(snapshot, 0, sizeof(GameSnapshot));
+}
+
+// Name the part of a snapshot an offset falls in
+static void DescribeOffset(const GameSnapshot* snapshot, int offset, char* where, int whereSize) {
+    static const struct {
+        const char* name;
+        size_t offset;
+    } parts[] = {
+        { "game state", 0 },
+        { "player", offsetof(SnapshotState, player) },
+        { "wave system", offsetof(SnapshotState, waves) },
+        { "explosion system", offsetof(SnapshotState, explosions) },
+        { "powerup system", offsetof(SnapshotState, powerups) },
+        { "random generator", offsetof(SnapshotState, random) }
+    };
+
+    if (offset < (int)sizeof(SnapshotState)) {
+        int part = 0;
+        for (int i = 1; i < (int)(sizeof(parts) / sizeof(parts[0])); i++) {
+            if ((size_t)offset >= parts[i].offset) {
+                part = i;
+            }
+        }
+        snprintf(where, whereSize, "%s byte %d", parts[part].name, offset - (int)parts[part].offset);
+        return;
+    }
+
+    SnapshotState state;
+    memcpy(&state, snapshot->data, sizeof(SnapshotState));
+    SnapshotSection sections[SECTION_COUNT];
+    GetSections(&state, NULL, sections);
+
+    int start = (int)sizeof(SnapshotState);
+    for (int s = 0; s < SECTION_COUNT; s++) {
+        int bytes = sections[s].elementSize * sections[s].count;
+        if (offset < start + bytes) {
+            int local = offset - start;
+            snprintf(where, whereSize, "%s[%d] byte %d", sections[s].name,
+                     local / sections[s].elementSize, local % sections[s].elementSize);
+            return;
+        }
+        start += bytes;
+    }
+    snprintf(where, whereSize, "byte %d", offset);
+}
+
+int GameSnapshot_FindDifference(const GameSnapshot* a, const GameSnapshot* b, char* where, int whereSize) {
+    int offset = -1;
+    if (a->size != b->size) {
+        offset = 0;
+    } else {
+        for (int i = 0; i < a->size; i++) {
+            if (a->data[i] != b->data[i]) {
+                offset = i;
+                break;
+            }
+        }
+    }
+
+    if (where && whereSize > 0) {
+        if (offset < 0) {
+            snprintf(where, whereSize, "none");
+        } else if (a->size != b->size) {
+            snprintf(where, whereSize, "size (%d / %d bytes)", a->size, b->size);
+        } else {
+            DescribeOffset(a, offset, where, whereSize);
+        }
+    }
+    return offset;
+}
+
+// First byte at or after pos that differs (whole words at a time)
+static int SkipEqual(const unsigned char* a, const unsigned char* b, int pos, int size) {
+    while (pos + 8 <= size) {
+        uint64_t wordA, wordB;
+        memcpy(&wordA, a + pos, 8);
+        memcpy(&wordB, b + pos, 8);
+        if (wordA != wordB) {
+            break;
+        }
+        pos += 8;
+    }
+    while (pos < size && a[pos] == b[pos]) {
+        pos++;
+    }
+    return pos;
+}
+
+// End of the changed run starting at pos: the next DELTA_MIN_SKIP equal bytes, or the end
+static int SkipChanged(const unsigned char* a, const unsigned char* b, int pos, int size) {
+    int equal = 0;
+    while (pos < size) {
+        if (a[pos] != b[pos]) {
+            equal = 0;
+        } else if (++equal == DELTA_MIN_SKIP) {
+            return pos + 1 - DELTA_MIN_SKIP;
+        }
+        pos++;
+    }
+    return pos - equal;
+}
+
+static int WriteVarint(unsigned char* out, int pos, unsigned int value) {
+    while (value >= 0x80) {
+        out[pos++] = (unsigned char)(value | 0x80);
+        value >>= 7;
+    }
+    out[pos++] = (unsigned char)value;
+    return pos;
+}
+
+static bool ReadVarint(const GameSnapshotDelta* delta, int* pos, unsigned int* value) {
+    *value = 0;
+    for (int shift = 0; shift < 32 && *pos < delta->size; shift += 7) {
+        unsigned char byte = delta->data[(*pos)++];
+        *value |= (unsigned int)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GameSnapshot_EncodeDelta(GameSnapshotDelta* delta, const GameSnapshot* from, const GameSnapshot* to) {
+    if (from->size != to->size) {
+        fprintf(stderr, "Game snapshots of different sizes (%d / %d bytes) can not be delta encoded\n",
+                from->size, to->size);
+        return false;
+    }
+
+    // Worst case: every changed run is followed by DELTA_MIN_SKIP unchanged bytes and costs two 5-byte varints
+    int size = to->size;
+    if (!Reserve(&delta->data, &delta->capacity, size + (size / DELTA_MIN_SKIP + 1) * 10)) {
+        return false;
+    }
+
+    const unsigned char* a = from->data;
+    const unsigned char* b = to->data;
+    unsigned char* out = delta->data;
+    int written = 0;
+    int pos = 0;
+    while (pos < size) {
+        int unchanged = pos;
+        pos = SkipEqual(a, b, pos, size);
+        if (pos == size) {
+            break;
+        }
+
+        int changed = pos;
+        pos = SkipChanged(a, b, pos, size);
+        written = WriteVarint(out, written, (unsigned int)(changed - unchanged));
+        written = WriteVarint(out, written, (unsigned int)(pos - changed));
+        for (int i = changed; i < pos; i++) {
+            out[written++] = a[i] ^ b[i];
+        }
+    }
+    delta->size = written;
+    return true;
+}
+
+bool GameSnapshot_ApplyDelta(GameSnapshot* snapshot, const GameSnapshotDelta* delta) {
+    // Checked in full first so a bad delta leaves the snapshot alone
+    for (int pass = 0; pass < 2; pass++) {
+        int read = 0;
+        int pos = 0;
+        while (read < delta->size) {
+            unsigned int unchanged, changed;
+            if (!ReadVarint(delta, &read, &unchanged) || !ReadVarint(delta, &read, &changed) ||
+                unchanged > (unsigned int)(snapshot->size - pos) ||
+                changed > (unsigned int)(snapshot->size - pos - (int)unchanged) ||
+                changed > (unsigned int)(delta->size - read)) {
+                fprintf(stderr, "Game snapshot delta does not fit the snapshot\n");
+                return false;
+            }
+
+            pos += (int)unchanged;
+            if (pass == 1) {
+                for (unsigned int i = 0; i < changed; i++) {
+                    snapshot->data[pos + i] ^= delta->data[read + i];
+                }
+            }
+            pos += (int)changed;
+            read += (int)changed;
+        }
+    }
+    return true;
+}
+
+void GameSnapshot_FreeDelta(GameSnapshotDelta* delta) {
+    free(delta->data);
+    memset(delta, 0, sizeof(GameSnapshotDelta));
+}
+
+bool GameSnapshotHistory_Init(GameSnapshotHistory* history, int ticks) {
+    memset(history, 0, sizeof(GameSnapshotHistory));
+
+    history->deltas = (GameSnapshotDelta*)calloc(ticks, sizeof(GameSnapshotDelta));
+    if (!history->deltas) {
+        fprintf(stderr, "Failed to allocate a %d tick game history\n", ticks);
+        return false;
+    }
+    history->capacity = ticks;
+    return true;
+}
+
+bool GameSnapshotHistory_Push(GameSnapshotHistory* history, const Game* game) {
+    if (history->latest.size == 0 || history->capacity == 0) {
+        return GameSnapshot_Capture(&history->latest, game);
+    }
+
+    // The new state goes into the spare buffer; the delta leads from it back to the previous one
+    if (!GameSnapshot_Capture(&history->next, game)) {
+        GameSnapshotHistory_Clear(history);
+        return false;
+    }
+
+    bool stored = GameSnapshot_EncodeDelta(&history->encoded, &history->next, &history->latest);
+    int slot = (history->first + history->count) % history->capacity;
+    if (history->count == history->capacity) {
+        history->first = (history->first + 1) % history->capacity;
+    } else {
+        history->count++;
+    }
+
+    // Deltas are kept at their own size (the encoding buffer is sized for the worst case)
+    GameSnapshotDelta* delta = &history->deltas[slot];
+    if (stored) {
+        stored = Reserve(&delta->data, &delta->capacity, history->encoded.size);
+    }
+    if (stored) {
+        memcpy(delta->data, history->encoded.data, history->encoded.size);
+        delta->size = history->encoded.size;
+    }
+
+    GameSnapshot previous = history->latest;
+    history->latest = history->next;
+    history->next = previous;
+
+    if (!stored) {
+        history->first = 0;
+        history->count = 0;
+    }
+    return stored;
+}
+
+const GameSnapshot* GameSnapshotHistory_StepBack(GameSnapshotHistory* history, int ticks) {
+    if (history->latest.size == 0) {
+        return NULL;
+    }
+
+    for (int i = 0; i < ticks && history->count > 0; i++) {
+        int slot = (history->first + history->count - 1) % history->capacity;
+        if (!GameSnapshot_ApplyDelta(&history->latest, &history->deltas[slot])) {
+            history->count = 0;
+            break;
+        }
+        history->count--;
+    }
+    return &history->latest;
+}
+
+void GameSnapshotHistory_Clear(GameSnapshotHistory* history) {
+    history->latest.size = 0;
+    history->first = 0;
+    history->count = 0;
+}
+
+void GameSnapshotHistory_Free(GameSnapshotHistory* history) {
+    for (int i = 0; i < history->capacity; i++) {
+        GameSnapshot_FreeDelta(&history->deltas[i]);
+    }
+    free(history->deltas);
+    GameSnapshot_Free(&history->latest);
+    GameSnapshot_Free(&history->next);
+    GameSnapshot_FreeDelta(&history->encoded);
+    memset(history, 0, sizeof(GameSnapshotHistory));
+}
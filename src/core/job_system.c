@@ -0,0 +1,301 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L   // clock_gettime under -std=c99
+#endif
+
+#include "job_system.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <unistd.h>
+#endif
+
+// Ready jobs of one thread: the owner takes the newest, thieves the oldest
+typedef struct {
+    int items[JOB_MAX_NODES];
+    int head;
+    int count;
+} JobQueue;
+
+// Guards everything below and the running graph's counters
+static pthread_mutex_t schedulerLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t schedulerWake = PTHREAD_COND_INITIALIZER;
+
+static pthread_t workers[JOB_MAX_WORKERS];
+static int workerCount = 0;
+static bool stopping = false;
+static JobQueue queues[JOB_MAX_WORKERS + 1];    // [0] = thread calling JobGraph_Run
+static JobGraph* activeGraph = NULL;
+
+static int GetCoreCount(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+#endif
+}
+
+static double NowMilliseconds(void) {
+#ifdef _WIN32
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000.0 + now.tv_nsec / 1000000.0;
+#endif
+}
+
+static void PushJob(int self, int node) {
+    JobQueue* queue = &queues[self];
+    queue->items[(queue->head + queue->count) % JOB_MAX_NODES] = node;
+    queue->count++;
+}
+
+static bool TakeJob(int self, int* outNode) {
+    JobQueue* own = &queues[self];
+    if (own->count > 0) {
+        own->count--;
+        *outNode = own->items[(own->head + own->count) % JOB_MAX_NODES];
+        return true;
+    }
+
+    for (int i = 1; i <= workerCount; i++) {
+        JobQueue* victim = &queues[(self + i) % (workerCount + 1)];
+        if (victim->count > 0) {
+            *outNode = victim->items[victim->head];
+            victim->head = (victim->head + 1) % JOB_MAX_NODES;
+            victim->count--;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Run a job and release its successors (called and returns with the lock held)
+static void RunJob(int self, int index) {
+    JobGraph* graph = activeGraph;
+    JobNode* node = &graph->nodes[index];
+
+    if (node->func) {
+        pthread_mutex_unlock(&schedulerLock);
+        double start = graph->timed ? NowMilliseconds() : 0.0;
+        node->func(node->data, node->begin, node->end);
+        if (graph->timed) {
+            node->milliseconds = NowMilliseconds() - start;
+        }
+        pthread_mutex_lock(&schedulerLock);
+    }
+
+    int released = 0;
+    for (int e = node->firstEdge; e >= 0; e = graph->edges[e].next) {
+        int next = graph->edges[e].to;
+        if (--graph->nodes[next].pending == 0) {
+            PushJob(self, next);
+            released++;
+        }
+    }
+    graph->remaining--;
+
+    // This thread takes one released job itself; wake the others for the rest (or the caller when done)
+    if (released > 1 || graph->remaining == 0) {
+        pthread_cond_broadcast(&schedulerWake);
+    }
+}
+
+static void* WorkerMain(void* arg) {
+    int self = (int)(intptr_t)arg;
+
+    pthread_mutex_lock(&schedulerLock);
+    while (!stopping) {
+        int node;
+        if (activeGraph && TakeJob(self, &node)) {
+            RunJob(self, node);
+        } else {
+            pthread_cond_wait(&schedulerWake, &schedulerLock);
+        }
+    }
+    pthread_mutex_unlock(&schedulerLock);
+    return NULL;
+}
+
+bool JobSystem_Init(int count) {
+    if (workerCount > 0) {
+        return true;
+    }
+
+    if (count < 0) {
+        count = GetCoreCount() - 1;
+    }
+    if (count > JOB_MAX_WORKERS) {
+        count = JOB_MAX_WORKERS;
+    }
+
+    pthread_mutex_lock(&schedulerLock);
+    stopping = false;
+    for (int i = 0; i < count; i++) {
+        if (pthread_create(&workers[i], NULL, WorkerMain, (void*)(intptr_t)(i + 1)) != 0) {
+            fprintf(stderr, "Failed to start job worker %d, using %d\n", i + 1, i);
+            break;
+        }
+        workerCount++;
+    }
+    pthread_mutex_unlock(&schedulerLock);
+
+    return count <= 0 || workerCount > 0;
+}
+
+void JobSystem_Shutdown(void) {
+    pthread_mutex_lock(&schedulerLock);
+    stopping = true;
+    pthread_cond_broadcast(&schedulerWake);
+    pthread_mutex_unlock(&schedulerLock);
+
+    for (int i = 0; i < workerCount; i++) {
+        pthread_join(workers[i], NULL);
+    }
+    workerCount = 0;
+}
+
+int JobSystem_GetWorkerCount(void) {
+    return workerCount;
+}
+
+void JobGraph_Init(JobGraph* graph) {
+    graph->nodeCount = 0;
+    graph->edgeCount = 0;
+    graph->remaining = 0;
+    graph->timed = false;
+}
+
+static int AddNode(JobGraph* graph, JobFunc func, void* data, int begin, int end) {
+    if (graph->nodeCount >= JOB_MAX_NODES) {
+        fprintf(stderr, "Job graph full (%d jobs)\n", JOB_MAX_NODES);
+        return -1;
+    }
+
+    int index = graph->nodeCount++;
+    JobNode* node = &graph->nodes[index];
+    node->func = func;
+    node->data = data;
+    node->begin = begin;
+    node->end = end;
+    node->join = index;
+    node->firstEdge = -1;
+    node->pending = 0;
+    node->milliseconds = 0.0;
+    return index;
+}
+
+static void AddEdge(JobGraph* graph, int from, int to) {
+    if (graph->edgeCount >= JOB_MAX_EDGES) {
+        fprintf(stderr, "Job graph full (%d dependencies)\n", JOB_MAX_EDGES);
+        return;
+    }
+
+    int index = graph->edgeCount++;
+    graph->edges[index].to = to;
+    graph->edges[index].next = graph->nodes[from].firstEdge;
+    graph->nodes[from].firstEdge = index;
+    graph->nodes[to].pending++;
+}
+
+int JobGraph_Add(JobGraph* graph, JobFunc func, void* data) {
+    return AddNode(graph, func, data, 0, 0);
+}
+
+int JobGraph_AddRange(JobGraph* graph, JobFunc func, void* data, int count, int chunkSize) {
+    if (chunkSize < 1) {
+        chunkSize = 1;
+    }
+    if (count > chunkSize * JOB_MAX_CHUNKS) {
+        chunkSize = (count + JOB_MAX_CHUNKS - 1) / JOB_MAX_CHUNKS;
+    }
+
+    int chunks = (count + chunkSize - 1) / chunkSize;
+    if (chunks <= 1) {
+        return AddNode(graph, func, data, 0, count);
+    }
+    if (graph->nodeCount + chunks + 2 > JOB_MAX_NODES) {
+        fprintf(stderr, "Job graph full (%d jobs)\n", JOB_MAX_NODES);
+        return -1;
+    }
+
+    // Bookends: dependencies of the range attach to start, dependents wait for end
+    int start = AddNode(graph, NULL, NULL, 0, 0);
+    int end = AddNode(graph, NULL, NULL, 0, 0);
+    for (int begin = 0; begin < count; begin += chunkSize) {
+        int last = begin + chunkSize < count ? begin + chunkSize : count;
+        int chunk = AddNode(graph, func, data, begin, last);
+        AddEdge(graph, start, chunk);
+        AddEdge(graph, chunk, end);
+    }
+    graph->nodes[start].join = end;
+    return start;
+}
+
+void JobGraph_Depend(JobGraph* graph, int job, int dependency) {
+    if (job < 0 || dependency < 0) {
+        return;
+    }
+    AddEdge(graph, graph->nodes[dependency].join, job);
+}
+
+void JobGraph_Run(JobGraph* graph) {
+    if (graph->nodeCount == 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&schedulerLock);
+    activeGraph = graph;
+    graph->remaining = graph->nodeCount;
+
+    // Spread the jobs that can start right away over all queues
+    int target = 0;
+    for (int i = 0; i < graph->nodeCount; i++) {
+        if (graph->nodes[i].pending == 0) {
+            PushJob(target, i);
+            target = (target + 1) % (workerCount + 1);
+        }
+    }
+    pthread_cond_broadcast(&schedulerWake);
+
+    while (graph->remaining > 0) {
+        int node;
+        if (TakeJob(0, &node)) {
+            RunJob(0, node);
+        } else {
+            pthread_cond_wait(&schedulerWake, &schedulerLock);
+        }
+    }
+
+    activeGraph = NULL;
+    pthread_mutex_unlock(&schedulerLock);
+}
+
+double JobGraph_GetMilliseconds(const JobGraph* graph, int job) {
+    if (job < 0 || job >= graph->nodeCount) {
+        return 0.0;
+    }
+
+    const JobNode* node = &graph->nodes[job];
+    if (node->join == job) {
+        return node->milliseconds;
+    }
+
+    // Range: the start bookend leads to every chunk
+    double total = 0.0;
+    for (int e = node->firstEdge; e >= 0; e = graph->edges[e].next) {
+        total += graph->nodes[graph->edges[e].to].milliseconds;
+    }
+    return total;
+}
@@ -2,15 +2,18 @@
 #include "types.h"
 #include "constants.h"
 #include "game.h"
-#include "collision.h"
-#include "powerup.h"
 #include "renderer.h"
 #include "menu.h"
 #include "database.h"
 #include "input_config.h"
 #include "input_manager.h"
+#include "asset_pack.h"
+#include "music_stream.h"
+#include "job_system.h"
 #include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 // Base resolution for game rendering
 #define BASE_WIDTH 1200
@@ -47,11 +50,80 @@ RenderScale CalculateRenderScale(int windowWidth, int windowHeight) {
     return rs;
 }
 
-int main(void) {
+// Report background database writes that failed or took longer than a frame
+static void OnDatabaseWrite(const DBWriteResult* result, void* userData) {
+    (void)userData;
+    const char* what = result->type == DB_WRITE_SETTINGS ? "settings" :
+                       result->type == DB_WRITE_HIGH_SCORE ? "high score" : "run statistics";
+    
+    if (!result->success) {
+        fprintf(stderr, "Warning: Failed to save %s to the database.\n", what);
+        return;
+    }
+    
+    if (result->replayId > 0) {
+        printf("Database: replay %d saved (play it with --replay %d)\n", result->replayId, result->replayId);
+    }
+    if (result->durationMs > 16.0) {
+        printf("Database: saving %s took %.1f ms (background)\n", what, result->durationMs);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    // Command line: --seek <seconds> starts the level at that time,
+    // --replay <id> plays back a stored high score run,
+    // --pack <file> / --no-pack choose the asset archive (default: assets.pak if present),
+    // --jobs <n> sets the simulation worker threads (0 = single-threaded, default: one per extra core),
+    // --stress [enemies [projectiles]] runs a timed bullet-hell load and exits,
+    // --practice lets the player rewind and retry levels (no high scores)
+    const char* packPath = ASSET_PACK_DEFAULT;
+    bool playReplay = false;
+    bool stressTest = false;
+    int jobWorkers = -1;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--seek") == 0 && i + 1 < argc) {
+            SetGameStartTime((float)atof(argv[++i]));
+        } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            SetGameReplay(atoi(argv[++i]));
+            playReplay = true;
+        } else if (strcmp(argv[i], "--pack") == 0 && i + 1 < argc) {
+            packPath = argv[++i];
+        } else if (strcmp(argv[i], "--no-pack") == 0) {
+            packPath = NULL;
+        } else if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc) {
+            jobWorkers = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--stress") == 0) {
+            int enemies = 0;
+            int projectiles = 0;
+            if (i + 1 < argc && argv[i + 1][0] != '-') {
+                enemies = atoi(argv[++i]);
+                if (i + 1 < argc && argv[i + 1][0] != '-') {
+                    projectiles = atoi(argv[++i]);
+                }
+            }
+            SetGameStressTest(enemies, projectiles);
+            stressTest = true;
+        } else if (strcmp(argv[i], "--practice") == 0) {
+            SetGamePractice(true);
+        }
+    }
+    
+    // Serve assets from the packed archive when available, loose files otherwise
+    if (packPath && FileExists(packPath) && !AssetPack_Mount(packPath, false)) {
+        fprintf(stderr, "Warning: Failed to mount %s, using loose asset files.\n", packPath);
+    }
+    
     // Initialize database
     if (!DB_Init()) {
         fprintf(stderr, "Warning: Failed to initialize database. Settings and high scores will not be saved.\n");
     }
+    DB_SetWriteCallback(OnDatabaseWrite, NULL);
+    
+    // Start the worker threads for the simulation stages
+    if (!JobSystem_Init(jobWorkers)) {
+        fprintf(stderr, "Warning: Failed to start job threads, simulating on the main thread.\n");
+    }
+    printf("Job system: %d worker threads\n", JobSystem_GetWorkerCount());
     
     // Initialize window with default resolution
     SetConfigFlags(FLAG_WINDOW_RESIZABLE);
@@ -63,6 +135,7 @@ int main(void) {
     
     // Initialize audio device (only once at program start)
     InitAudioDevice();
+    MusicStream_Init(NULL);
     
     // Create render texture for game rendering at base resolution
     RenderTexture2D gameRenderTarget = LoadRenderTexture(BASE_WIDTH, BASE_HEIGHT);
@@ -79,6 +152,11 @@ int main(void) {
     InitMenu(&menu);
     menu.inputManager = &inputManager;  // Link input manager to menu
     MenuState gameState = MENU_MAIN;
+    if (playReplay || stressTest) {
+        // Go straight to the game; the replay (or the stress load) drives it
+        gameState = MENU_GAME;
+        menu.currentState = MENU_GAME;
+    }
     
     // Create game instance (but don't initialize until needed)
     Game game;
@@ -91,6 +169,9 @@ int main(void) {
         // Update input manager each frame
         InputManager_Update(&inputManager);
         
+        // Deliver finished background database writes
+        DB_Update();
+        
         if ((gameState == MENU_GAME || gameState == MENU_PAUSE_CONFIRM) && !awaitingNameInput) {
             // Initialize game if not already done
             if (!gameInitialized) {
@@ -107,10 +188,11 @@ int main(void) {
             
             if (pauseExitPressed) {
                 if (game.gameOver) {
-                    // Game over - check if score qualifies as high score
-                    if (DB_IsHighScore(game.score, DIFFICULTY_NORMAL)) {
-                        // Show name input dialog
+                    // Game over - check if score qualifies as high score (a replay playback or practice run never does)
+                    if (!game.replayReader && !game.rewindHistory && DB_IsHighScore(game.score, DIFFICULTY_NORMAL)) {
+                        // Show name input dialog; the run's recorded input is saved with the score
                         StartNameInput(&menu, game.score, DIFFICULTY_NORMAL);
+                        TakeGameReplay(&game, &menu.pendingReplayInfo, &menu.pendingReplayData);
                         awaitingNameInput = true;
                         gameState = MENU_NAME_INPUT;
                     } else {
@@ -130,9 +212,7 @@ int main(void) {
                     gameState = MENU_PAUSE_CONFIRM;
                     // Pause the game
                     game.gamePaused = true;
-                    if (game.musicLoaded) {
-                        PauseMusicStream(game.backgroundMusic);
-                    }
+                    MusicStream_Pause();
                 }
             }
             
@@ -142,23 +222,19 @@ int main(void) {
                 game.gamePaused = false;
                 game.justStarted = true;  // Prevent immediate input processing after resume
                 menu.pauseMenuCooldown = 0.2f;  // Also set cooldown in case pause is triggered again
-                if (game.musicLoaded) {
-                    ResumeMusicStream(game.backgroundMusic);
-                }
+                MusicStream_Resume();
             }
             
             // Update and render game
             if (gameInitialized) {
                 // Only update game if not showing pause menu
                 if (menu.currentState != MENU_PAUSE_CONFIRM) {
-                    // Update game logic
+                    // Update game logic (fixed ticks, collisions included)
                     UpdateGame(&game);
                     
-                    // Check collisions
-                    if (!game.gameOver) {
-                        CheckCollisions(&game);
-                        // Check powerup collisions
-                        CheckPowerupCollisions(game.powerupSystem, game.playerShip, &game.score);
+                    // A stress run ends the program once its report is printed
+                    if (stressTest && game.gameOver) {
+                        shouldQuit = true;
                     }
                 }
                 
@@ -254,9 +330,12 @@ int main(void) {
     if (gameInitialized) {
         CleanupGame(&game);
     }
+    MusicStream_Shutdown();
     UnloadRenderTexture(gameRenderTarget);
+    JobSystem_Shutdown();
     DB_Cleanup();
     CloseWindow();
+    AssetPack_Unmount();  // After CleanupGame: packed music streams read from the mapping
     
     return 0;
 }
@@ -1,10 +1,13 @@
 // Console-based bass analyzer with real FFT analysis
 #include "raylib.h"
 #include "audio_analysis.h"
+#include "audio_detector.h"
+#include "audio_stft.h"
 #include <stdio.h>
 #include <math.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stdbool.h>
 #include <time.h>
 
 // Note: CLI uses shared default thresholds defined in audio_analysis.h
@@ -12,22 +15,8 @@
 
 // Global analyzer state
 typedef struct {
-    float audioBuffer[FFT_SIZE];
-    int audioBufferWritePos;
-    int samplesCollected;
-    float magnitude[FFT_SIZE/2];
-    float bassEnergy;
-    BassLevel currentBassLevel;
-    BassLevel previousBassLevel;
-    double bassStartTime;
-    int bassEventCount;
-    FILE *logFile;
-    BassConfig config;
-    double lastLogTime;
-    // Peak detection
-    float previousBassEnergy;
-    double lastPeakTime;
-    int peakCount;
+    AudioSTFT *stft;
+    BassDetector detector;
 } Analyzer;
 
 Analyzer *g_analyzer = NULL;
@@ -36,139 +25,90 @@ Analyzer *g_analyzer = NULL;
 void AudioProcessorCallback(void *buffer, unsigned int frames) {
     if (g_analyzer == NULL) return;
     
-    float *data = (float *)buffer;
-    
-    // Collect samples for FFT analysis
-    for (unsigned int i = 0; i < frames * 2; i += 2) {  // Stereo data
-        if (g_analyzer->samplesCollected < FFT_SIZE) {
-            // Use left channel
-            float sample = data[i];
-            g_analyzer->audioBuffer[g_analyzer->audioBufferWritePos] = sample;
-            g_analyzer->audioBufferWritePos = (g_analyzer->audioBufferWritePos + 1) % FFT_SIZE;
-            g_analyzer->samplesCollected++;
-        }
-    }
+    // Stereo float data; the STFT picks the configured channel
+    audio_stftPush(g_analyzer->stft, (const float *)buffer, frames, 2);
 }
 
-// Analyze audio frame
-void analyzeAudioFrame(Analyzer *analyzer, double currentTime, int verbose) {
-    if (analyzer->samplesCollected < FFT_SIZE) {
-        return;  // Not enough samples yet
-    }
-    
-    // Prepare FFT
-    float complex fftData[FFT_SIZE];
-    float windowedSamples[FFT_SIZE];
+// Real-time analysis: play the track silently and analyze what the stream processor captures
+float runRealtimeAnalysis(Analyzer *analyzer, Music music, float maxTime) {
+    // Attach audio processor
+    AttachAudioStreamProcessor(music.stream, AudioProcessorCallback);
     
-    for (int i = 0; i < FFT_SIZE; i++) {
-        windowedSamples[i] = analyzer->audioBuffer[i];
-    }
-    audio_applyWindow(windowedSamples, FFT_SIZE);
+    // Play music SILENTLY (very low volume)
+    PlayMusicStream(music);
+    SetMusicVolume(music, 0.001f);  // Nearly inaudible but keeps stream active
     
-    for (int i = 0; i < FFT_SIZE; i++) {
-        fftData[i] = windowedSamples[i];
-    }
+    printf("\nStarting silent analysis...\n");
+    printf("Note: Analysis runs at ~1x speed (%.0f seconds of audio ≈ %.0f seconds to process)\n", 
+           maxTime, maxTime);
+    printf("      Will exit when reaching %.2f seconds or when stream ends\n", maxTime);
+    printf("      Progress updates every 30 seconds\n");
+    printf("Time format: [seconds.ms]\n");
+    printf("=========================================\n\n");
     
-    // Perform FFT
-    audio_fft(fftData, FFT_SIZE);
+    // Process as fast as possible until we reach the target duration
+    float analysisTime = 0.0f;
+    float lastProgressUpdate = 0.0f;
+    time_t startWallTime = time(NULL);
+    float spectrum[FFT_SIZE/2];
+    double frameTime;
     
-    // Calculate magnitude spectrum with smoothing
-    for (int i = 0; i < FFT_SIZE/2; i++) {
-        float real = crealf(fftData[i]);
-        float imag = cimagf(fftData[i]);
-        float newMag = sqrtf(real * real + imag * imag) / (FFT_SIZE/4);
+    while (1) {  // Loop until we explicitly break
+        // Update music stream
+        UpdateMusicStream(music);
         
-        // Apply smoothing
-        analyzer->magnitude[i] = analyzer->magnitude[i] * 0.7f + newMag * 0.3f;
-    }
-    
-    // Calculate bass energy using shared function
-    analyzer->bassEnergy = audio_calculateBassEnergy(analyzer->magnitude, FFT_SIZE/2);
-    
-    // Determine bass level
-    analyzer->previousBassLevel = analyzer->currentBassLevel;
-    analyzer->currentBassLevel = audio_getBassLevel(analyzer->bassEnergy, &analyzer->config);
-    
-    // Verbose output - show all energy readings
-    if (verbose && ((int)(currentTime * 10) % 5 == 0)) {  // Every 0.5 seconds
-        printf("[%06.2f] Energy: %.3f Level: %s\n", 
-               currentTime, analyzer->bassEnergy, audio_getBassLevelString(analyzer->currentBassLevel));
-    }
-    
-    // Detect peaks - only if enabled
-    if (analyzer->config.peakEnabled) {
-        float energyDelta = analyzer->bassEnergy - analyzer->previousBassEnergy;
-        float energyIncrease = (analyzer->previousBassEnergy > 0.01f) ? 
-                               (energyDelta / analyzer->previousBassEnergy) : 0.0f;
+        float currentTime = GetMusicTimePlayed(music);
+        analysisTime = currentTime;
         
-        // Detect peak if energy increases by threshold percentage and enough time has passed
-        if (energyIncrease >= analyzer->config.peakThreshold && 
-            (currentTime - analyzer->lastPeakTime) >= PEAK_DEBOUNCE_TIME) {
-            analyzer->lastPeakTime = currentTime;
-            analyzer->peakCount++;
-            
-            printf("[%06.2f] PEAK detected - Energy: %.3f (increase: +%.1f%%)\n",
-                   currentTime, analyzer->bassEnergy, energyIncrease * 100.0f);
-            if (analyzer->logFile) {
-                fprintf(analyzer->logFile, "[%06.2f] PEAK detected - Energy: %.3f (increase: +%.1f%%)\n",
-                       currentTime, analyzer->bassEnergy, energyIncrease * 100.0f);
-                fflush(analyzer->logFile);
-            }
+        // Primary exit condition: reached the target duration (with small margin)
+        if (currentTime >= (maxTime - 0.1f)) {
+            printf("\n[Completed: analyzed %.2f of %.2f seconds]\n", currentTime, maxTime);
+            break;
         }
         
-        // Update previous energy for next peak detection
-        analyzer->previousBassEnergy = analyzer->bassEnergy;
-    }
-    
-    // Log bass events (with debouncing)
-    if (analyzer->previousBassLevel == BASS_NONE && analyzer->currentBassLevel != BASS_NONE) {
-        // Bass started
-        analyzer->bassStartTime = currentTime;
-        analyzer->bassEventCount++;
-        
-        const char *levelStr = audio_getBassLevelString(analyzer->currentBassLevel);
-        
-        printf("[%06.2f] Bass START - Level: %-6s (Energy: %.3f)\n",
-               currentTime, levelStr, analyzer->bassEnergy);
-        if (analyzer->logFile) {
-            fprintf(analyzer->logFile, "[%06.2f] Bass START - Level: %-6s (Energy: %.3f)\n",
-                   currentTime, levelStr, analyzer->bassEnergy);
-            fflush(analyzer->logFile);
+        // Secondary exit condition: stream stopped playing
+        if (!IsMusicStreamPlaying(music)) {
+            printf("\n[Music stream ended at %.2f seconds]\n", analysisTime);
+            break;
         }
-        analyzer->lastLogTime = currentTime;
-    }
-    else if (analyzer->previousBassLevel != BASS_NONE && 
-             analyzer->currentBassLevel != BASS_NONE &&
-             analyzer->previousBassLevel != analyzer->currentBassLevel) {
-        // Bass level changed (no debouncing for CHANGE events - log all transitions)
-        const char *levelStr = audio_getBassLevelString(analyzer->currentBassLevel);
         
-        printf("[%06.2f] Bass CHANGE - Level: %-6s (Energy: %.3f)\n",
-               currentTime, levelStr, analyzer->bassEnergy);
-        if (analyzer->logFile) {
-            fprintf(analyzer->logFile, "[%06.2f] Bass CHANGE - Level: %-6s (Energy: %.3f)\n",
-                   currentTime, levelStr, analyzer->bassEnergy);
-            fflush(analyzer->logFile);
+        // Show progress every 30 seconds
+        if (currentTime - lastProgressUpdate >= 30.0f) {
+            float percent = (currentTime / maxTime) * 100.0f;
+            time_t elapsed = time(NULL) - startWallTime;
+            printf("Progress: %.1f%% (%.1f/%.1f seconds) - %ld seconds elapsed\n", 
+                   percent, currentTime, maxTime, (long)elapsed);
+            lastProgressUpdate = currentTime;
         }
-        analyzer->lastLogTime = currentTime;
-    }
-    else if (analyzer->previousBassLevel != BASS_NONE && analyzer->currentBassLevel == BASS_NONE) {
-        // Bass ended
-        float duration = currentTime - analyzer->bassStartTime;
         
-        printf("[%06.2f] Bass END   - Duration: %.2fs\n", currentTime, duration);
-        if (analyzer->logFile) {
-            fprintf(analyzer->logFile, "[%06.2f] Bass END   - Duration: %.2fs\n", currentTime, duration);
-            fflush(analyzer->logFile);
+        // Analyze every frame the callback has completed
+        while (audio_stftNextFrame(analyzer->stft, spectrum, &frameTime)) {
+            audio_detectorProcessFrame(&analyzer->detector, spectrum, frameTime);
         }
-        analyzer->lastLogTime = currentTime;
+        
+        // NO WAIT - process as fast as possible
     }
     
-    // Reset sample counter for next batch
-    analyzer->samplesCollected = 0;
-    analyzer->audioBufferWritePos = 0;
+    DetachAudioStreamProcessor(music.stream, AudioProcessorCallback);
+    return analysisTime;
 }
 
+// Offline analysis: push the decoded PCM through the same STFT and analyze
+// the frames as fast as the CPU allows
+float runOfflineAnalysis(Analyzer *analyzer, const Wave *wave, float maxTime) {
+    // 32-bit stereo (see WaveFormat in main)
+    return audio_detectorAnalyzePCM(&analyzer->detector, analyzer->stft,
+                                    (const float *)wave->data, wave->frameCount, maxTime);
+}
+
+void releaseAudio(bool offline, Music music, Wave wave) {
+    if (offline) {
+        UnloadWave(wave);
+    } else {
+        UnloadMusicStream(music);
+        CloseAudioDevice();
+    }
+}
 
 void printUsage(const char *programName) {
     printf("Usage: %s [OPTIONS]\n", programName);
@@ -177,6 +117,12 @@ void printUsage(const char *programName) {
     printf("  -c, --config <path>      Specify configuration file path (default: %s)\n", CONFIG_FILE_DEFAULT);
     printf("  -t, --time <seconds>     Limit analysis to first N seconds (default: full song)\n");
     printf("  -v, --verbose            Show all energy readings (for debugging)\n");
+    printf("  --offline                Decode the whole file and analyze faster than realtime\n");
+    printf("                           (no audio device needed, same log format)\n");
+    printf("  --beats                  Also write a beat grid (onsets, beats, downbeats) to .beats\n");
+    printf("  --hop <samples>          Samples between analysis frames (default: %d, no overlap)\n", FFT_SIZE);
+    printf("  --window <type>          hann, hamming or blackman (default: hamming)\n");
+    printf("  --channel <channel>      left, right or mid (default: left)\n");
     printf("  --low <value>            Set LOW threshold (default: %.2f)\n", BASS_THRESHOLD_LOW_DEFAULT);
     printf("  --medium <value>         Set MEDIUM threshold (default: %.2f)\n", BASS_THRESHOLD_MEDIUM_DEFAULT);
     printf("  --high <value>           Set HIGH threshold (default: %.2f)\n", BASS_THRESHOLD_HIGH_DEFAULT);
@@ -189,6 +135,8 @@ void printUsage(const char *programName) {
     printf("  %s -f level1.mp3                      # Analyze complete level1.mp3\n", programName);
     printf("  %s -f level2.mp3 -t 30                # Analyze first 30 seconds\n", programName);
     printf("  %s -f level2.mp3 -v                   # Verbose mode - show all readings\n", programName);
+    printf("  %s -f level1.mp3 --offline            # Analyze in seconds on a headless machine\n", programName);
+    printf("  %s -f level1.mp3 --offline --beats --hop 512  # Beat grid for snapping spawns\n", programName);
     printf("  %s -f level1.mp3 --config myconfig.conf  # Use custom config file\n", programName);
     printf("  %s -f level1.mp3 --enable-peak --peak 0.25 --save-config  # Enable peak detection\n", programName);
     printf("  %s --file level2.mp3                  # Use saved config if available\n", programName);
@@ -210,6 +158,9 @@ int main(int argc, char *argv[]) {
     float timeLimit = 0.0f;  // 0 means no limit (use full song duration)
     int shouldSaveConfig = 0;
     int verbose = 0;
+    bool offline = false;
+    bool beats = false;
+    AudioSTFTConfig stftConfig = audio_stftDefaultConfig();
     
     // First pass: check for --help or --config argument
     for (int i = 1; i < argc; i++) {
@@ -262,6 +213,25 @@ int main(int argc, char *argv[]) {
                 shouldSaveConfig = 1;
             } else if (strcmp(argv[i], "-v") == 0 || strcmp(argv[i], "--verbose") == 0) {
                 verbose = 1;
+            } else if (strcmp(argv[i], "--offline") == 0) {
+                offline = true;
+            } else if (strcmp(argv[i], "--beats") == 0) {
+                beats = true;
+            } else if (strcmp(argv[i], "--hop") == 0 && i + 1 < argc) {
+                stftConfig.hopSize = atoi(argv[i + 1]);
+                i++;
+            } else if (strcmp(argv[i], "--window") == 0 && i + 1 < argc) {
+                if (!audio_stftParseWindow(argv[i + 1], &stftConfig.window)) {
+                    printf("Error: Unknown window '%s' (use hann, hamming or blackman)\n", argv[i + 1]);
+                    return 1;
+                }
+                i++;
+            } else if (strcmp(argv[i], "--channel") == 0 && i + 1 < argc) {
+                if (!audio_stftParseChannel(argv[i + 1], &stftConfig.channel)) {
+                    printf("Error: Unknown channel '%s' (use left, right or mid)\n", argv[i + 1]);
+                    return 1;
+                }
+                i++;
             } else if (argv[i][0] == '-') {
                 printf("Error: Unknown option '%s'\n\n", argv[i]);
                 printUsage(argv[0]);
@@ -304,21 +274,44 @@ int main(int argc, char *argv[]) {
     }
     
     printf("Loading: %s\n", audioFile);
-    printf("Mode: Silent background analysis (no audio playback)\n\n");
-    
-    // Initialize audio
-    InitAudioDevice();
+    if (offline) {
+        printf("Mode: Offline decode (no audio device, faster than realtime)\n\n");
+    } else {
+        printf("Mode: Silent background analysis (no audio playback)\n\n");
+    }
     
-    // Load music
-    Music music = LoadMusicStream(audioFile);
+    Music music = { 0 };
+    Wave wave = { 0 };
+    float duration;
     
-    if (music.frameCount == 0) {
-        printf("Error: Could not load audio file!\n");
-        CloseAudioDevice();
-        return 1;
+    if (offline) {
+        // Decode the whole file up front
+        wave = LoadWave(audioFile);
+        if (wave.frameCount == 0) {
+            printf("Error: Could not load audio file!\n");
+            return 1;
+        }
+        duration = (float)wave.frameCount / wave.sampleRate;
+        
+        // Analysis constants assume SAMPLE_RATE float stereo
+        if (wave.sampleRate != (unsigned int)SAMPLE_RATE || wave.sampleSize != 32 || wave.channels != 2) {
+            WaveFormat(&wave, (int)SAMPLE_RATE, 32, 2);
+        }
+    } else {
+        // Initialize audio
+        InitAudioDevice();
+        
+        // Load music
+        music = LoadMusicStream(audioFile);
+        
+        if (music.frameCount == 0) {
+            printf("Error: Could not load audio file!\n");
+            CloseAudioDevice();
+            return 1;
+        }
+        
+        duration = GetMusicTimeLength(music);
     }
-    
-    float duration = GetMusicTimeLength(music);
     printf("Successfully loaded audio\n");
     printf("Duration: %.2f seconds\n", duration);
     
@@ -330,8 +323,7 @@ int main(int argc, char *argv[]) {
         if (timeLimit > duration) {
             printf("Error: Time limit (%.2fs) exceeds song duration (%.2fs)\n", timeLimit, duration);
             printf("       Time limit must be between 0 and %.2f seconds\n", duration);
-            UnloadMusicStream(music);
-            CloseAudioDevice();
+            releaseAudio(offline, music, wave);
             return 1;  // Exit with error
         }
         analysisDuration = timeLimit;
@@ -363,20 +355,7 @@ int main(int argc, char *argv[]) {
     
     FILE *logFile = fopen(logFilePath, "w");
     if (logFile) {
-        fprintf(logFile, "=== Audio Bass Analyzer Log ===\n");
-        fprintf(logFile, "Audio file: %s\n", audioFile);
-        fprintf(logFile, "Duration: %.2f seconds\n", duration);
-        fprintf(logFile, "Bass Thresholds: LOW=%.3f, MEDIUM=%.3f, HIGH=%.3f\n", 
-               config.thresholdLow, config.thresholdMedium, config.thresholdHigh);
-        fprintf(logFile, "Peak Detection: %s", config.peakEnabled ? "ENABLED" : "DISABLED");
-        if (config.peakEnabled) {
-            fprintf(logFile, " (threshold: %.3f = %.0f%% energy increase)", 
-                   config.peakThreshold, config.peakThreshold * 100.0f);
-        }
-        fprintf(logFile, "\n\n");
-        fprintf(logFile, "Time format: [seconds from start]\n");
-        fprintf(logFile, "=====================================\n\n");
-        fflush(logFile);
+        audio_writeLogHeader(logFile, audioFile, duration, &config);
         printf("Log file created: %s\n", logFilePath);
     } else {
         printf("Warning: Could not create log file: %s\n", logFilePath);
@@ -384,97 +363,102 @@ int main(int argc, char *argv[]) {
     
     // Initialize analyzer
     Analyzer analyzer = {0};
-    analyzer.logFile = logFile;
-    analyzer.config = config;
+    audio_detectorInit(&analyzer.detector, &config, logFile, true);
+    analyzer.detector.verbose = verbose;
+    BassEnvelopeBuilder envelope;
+    if (BassEnvelope_BuilderInit(&envelope, BASS_ENVELOPE_FRAME_RATE)) {
+        analyzer.detector.envelope = &envelope;
+    }
+    analyzer.stft = audio_stftCreate(&stftConfig);
+    if (analyzer.stft == NULL) {
+        printf("Error: Invalid hop size %d (must be 1-%d)\n", stftConfig.hopSize, FFT_SIZE);
+        if (logFile) fclose(logFile);
+        BassEnvelope_BuilderFree(&envelope);
+        releaseAudio(offline, music, wave);
+        return 1;
+    }
     g_analyzer = &analyzer;
-    
-    // Attach audio processor
-    AttachAudioStreamProcessor(music.stream, AudioProcessorCallback);
-    
-    // Play music SILENTLY (very low volume)
-    PlayMusicStream(music);
-    SetMusicVolume(music, 0.001f);  // Nearly inaudible but keeps stream active
-    
-    printf("\nStarting silent analysis...\n");
-    printf("Note: Analysis runs at ~1x speed (%.0f seconds of audio ≈ %.0f seconds to process)\n", 
-           analysisDuration, analysisDuration);
-    printf("      Will exit when reaching %.2f seconds or when stream ends\n", analysisDuration);
-    printf("      Progress updates every 30 seconds\n");
-    printf("Time format: [seconds.ms]\n");
-    printf("=========================================\n\n");
-    
-    // Process as fast as possible until we reach the target duration
-    float analysisTime = 0.0f;
-    float maxTime = analysisDuration;  // This is set to song duration when no timeout specified
-    float lastProgressUpdate = 0.0f;
-    time_t startWallTime = time(NULL);
-    
-    while (1) {  // Loop until we explicitly break
-        // Update music stream
-        UpdateMusicStream(music);
-        
-        float currentTime = GetMusicTimePlayed(music);
-        analysisTime = currentTime;
-        
-        // Primary exit condition: reached the target duration (with small margin)
-        if (currentTime >= (maxTime - 0.1f)) {
-            printf("\n[Completed: analyzed %.2f of %.2f seconds]\n", currentTime, maxTime);
-            break;
-        }
-        
-        // Secondary exit condition: stream stopped playing
-        if (!IsMusicStreamPlaying(music)) {
-            printf("\n[Music stream ended at %.2f seconds]\n", analysisTime);
-            break;
-        }
-        
-        // Show progress every 30 seconds
-        if (currentTime - lastProgressUpdate >= 30.0f) {
-            float percent = (currentTime / maxTime) * 100.0f;
-            time_t elapsed = time(NULL) - startWallTime;
-            printf("Progress: %.1f%% (%.1f/%.1f seconds) - %ld seconds elapsed\n", 
-                   percent, currentTime, maxTime, (long)elapsed);
-            lastProgressUpdate = currentTime;
+    printf("STFT: %d-sample frames, hop %d, %s window, %s channel\n",
+           stftConfig.frameSize, stftConfig.hopSize,
+           audio_stftWindowName(stftConfig.window), audio_stftChannelName(stftConfig.channel));
+    
+    // Optional beat grid
+    char beatsFilePath[512];
+    audio_getBeatsFilePath(audioFile, beatsFilePath, sizeof(beatsFilePath));
+    if (beats) {
+        analyzer.detector.onsets = audio_onsetCreate(&stftConfig);
+        analyzer.detector.beatsFile = analyzer.detector.onsets ? fopen(beatsFilePath, "w") : NULL;
+        if (analyzer.detector.beatsFile) {
+            audio_writeBeatsHeader(analyzer.detector.beatsFile, audioFile, duration);
+            printf("Beat grid file created: %s\n", beatsFilePath);
+        } else {
+            printf("Warning: Could not create beat grid file: %s\n", beatsFilePath);
         }
-        
-        // Analyze if we have enough samples
-        if (analyzer.samplesCollected >= FFT_SIZE) {
-            analyzeAudioFrame(&analyzer, currentTime, verbose);
-        }
-        
-        // NO WAIT - process as fast as possible
     }
     
-    time_t totalWallTime = time(NULL) - startWallTime;
+    if (offline) {
+        printf("\nStarting offline analysis...\n");
+        printf("Time format: [seconds.ms]\n");
+        printf("=========================================\n\n");
+    }
+    
+    // Run the analysis (offline decode or real-time playback)
+    time_t startWallTime = time(NULL);
+    clock_t startClock = clock();
+    float analysisTime = offline ? runOfflineAnalysis(&analyzer, &wave, analysisDuration)
+                                 : runRealtimeAnalysis(&analyzer, music, analysisDuration);
     
     printf("\n=========================================\n");
     printf("Analysis complete!\n");
-    printf("Total bass events detected: %d\n", analyzer.bassEventCount);
+    printf("Total bass events detected: %d\n", analyzer.detector.bassEventCount);
     if (config.peakEnabled) {
-        printf("Total peaks detected: %d\n", analyzer.peakCount);
+        printf("Total peaks detected: %d\n", analyzer.detector.peakCount);
+    }
+    if (analyzer.detector.onsets) {
+        printf("Tempo: %.1f BPM, %d beats in %d bars, %d onsets\n",
+               audio_onsetGetTempo(analyzer.detector.onsets), analyzer.detector.beatCount,
+               analyzer.detector.barCount, analyzer.detector.onsetCount);
     }
     printf("Analysis duration: %.2f seconds\n", analysisTime);
-    printf("Wall clock time: %ld seconds (%.1fx speed)\n", 
-           (long)totalWallTime, analysisTime / (totalWallTime > 0 ? totalWallTime : 1));
+    if (offline) {
+        double processingTime = (double)(clock() - startClock) / CLOCKS_PER_SEC;
+        printf("Processing time: %.3f seconds (%.0fx realtime)\n",
+               processingTime, analysisTime / (processingTime > 0.0 ? processingTime : 0.001));
+    } else {
+        time_t totalWallTime = time(NULL) - startWallTime;
+        printf("Wall clock time: %ld seconds (%.1fx speed)\n", 
+               (long)totalWallTime, analysisTime / (totalWallTime > 0 ? totalWallTime : 1));
+    }
     
     // Write summary to log file and close it
     if (logFile) {
-        fprintf(logFile, "\n=====================================\n");
-        fprintf(logFile, "=== Analysis Summary ===\n");
-        fprintf(logFile, "Total bass events detected: %d\n", analyzer.bassEventCount);
-        if (config.peakEnabled) {
-            fprintf(logFile, "Total peaks detected: %d\n", analyzer.peakCount);
-        }
-        fprintf(logFile, "Analysis duration: %.2f seconds\n", analysisTime);
+        audio_writeLogSummary(logFile, &analyzer.detector, analysisTime);
         fclose(logFile);
         printf("Log file closed: %s\n", logFilePath);
     }
     
+    // Binary envelope for the game (same frames as the log)
+    char envelopePath[512];
+    BassEnvelope_GetPath(audioFile, envelopePath, sizeof(envelopePath));
+    if (BassEnvelope_Save(&envelope, envelopePath)) {
+        printf("Bass envelope written: %s (%d frames at %d Hz)\n",
+               envelopePath, envelope.frameCount, envelope.frameRate);
+    } else {
+        printf("Warning: Could not write bass envelope: %s\n", envelopePath);
+    }
+    BassEnvelope_BuilderFree(&envelope);
+    
+    if (analyzer.detector.beatsFile) {
+        audio_writeBeatsSummary(analyzer.detector.beatsFile, &analyzer.detector);
+        fclose(analyzer.detector.beatsFile);
+        printf("Beat grid closed: %s\n", beatsFilePath);
+    }
+    audio_onsetDestroy(analyzer.detector.onsets);
+    
     // Cleanup
-    DetachAudioStreamProcessor(music.stream, AudioProcessorCallback);
     g_analyzer = NULL;
-    UnloadMusicStream(music);
-    CloseAudioDevice();
+    audio_stftDestroy(analyzer.stft);
+    releaseAudio(offline, music, wave);
     
     return 0;
 }
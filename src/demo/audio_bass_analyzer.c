@@ -1,6 +1,7 @@
 // Console-based bass analyzer with real FFT analysis
 #include "raylib.h"
 #include "audio_analysis.h"
+#include "audio_stft.h"
 #include <stdio.h>
 #include <math.h>
 #include <string.h>
@@ -12,9 +13,7 @@
 
 // Global analyzer state
 typedef struct {
-    float audioBuffer[FFT_SIZE];
-    int audioBufferWritePos;
-    int samplesCollected;
+    AudioSTFT *stft;
     float magnitude[FFT_SIZE/2];
     float bassEnergy;
     BassLevel currentBassLevel;
@@ -36,47 +35,15 @@ Analyzer *g_analyzer = NULL;
 void AudioProcessorCallback(void *buffer, unsigned int frames) {
     if (g_analyzer == NULL) return;
     
-    float *data = (float *)buffer;
-    
-    // Collect samples for FFT analysis
-    for (unsigned int i = 0; i < frames * 2; i += 2) {  // Stereo data
-        if (g_analyzer->samplesCollected < FFT_SIZE) {
-            // Use left channel
-            float sample = data[i];
-            g_analyzer->audioBuffer[g_analyzer->audioBufferWritePos] = sample;
-            g_analyzer->audioBufferWritePos = (g_analyzer->audioBufferWritePos + 1) % FFT_SIZE;
-            g_analyzer->samplesCollected++;
-        }
-    }
+    // Stereo float data; the STFT picks the configured channel
+    audio_stftPush(g_analyzer->stft, (const float *)buffer, frames, 2);
 }
 
-// Analyze audio frame
-void analyzeAudioFrame(Analyzer *analyzer, double currentTime, int verbose) {
-    if (analyzer->samplesCollected < FFT_SIZE) {
-        return;  // Not enough samples yet
-    }
-    
-    // Prepare FFT
-    float complex fftData[FFT_SIZE];
-    float windowedSamples[FFT_SIZE];
-    
-    for (int i = 0; i < FFT_SIZE; i++) {
-        windowedSamples[i] = analyzer->audioBuffer[i];
-    }
-    audio_applyWindow(windowedSamples, FFT_SIZE);
-    
-    for (int i = 0; i < FFT_SIZE; i++) {
-        fftData[i] = windowedSamples[i];
-    }
-    
-    // Perform FFT
-    audio_fft(fftData, FFT_SIZE);
-    
+// Analyze one STFT frame (spectrum ends at currentTime)
+void analyzeAudioFrame(Analyzer *analyzer, const float *spectrum, double currentTime, int verbose) {
     // Calculate magnitude spectrum with smoothing
     for (int i = 0; i < FFT_SIZE/2; i++) {
-        float real = crealf(fftData[i]);
-        float imag = cimagf(fftData[i]);
-        float newMag = sqrtf(real * real + imag * imag) / (FFT_SIZE/4);
+        float newMag = spectrum[i] / (FFT_SIZE/4);
         
         // Apply smoothing
         analyzer->magnitude[i] = analyzer->magnitude[i] * 0.7f + newMag * 0.3f;
@@ -163,10 +130,6 @@ void analyzeAudioFrame(Analyzer *analyzer, double currentTime, int verbose) {
         }
         analyzer->lastLogTime = currentTime;
     }
-    
-    // Reset sample counter for next batch
-    analyzer->samplesCollected = 0;
-    analyzer->audioBufferWritePos = 0;
 }
 
 
@@ -387,6 +350,7 @@ int main(int argc, char *argv[]) {
     analyzer.logFile = logFile;
     analyzer.config = config;
     g_analyzer = &analyzer;
+    analyzer.stft = audio_stftCreate(NULL);
     
     // Attach audio processor
     AttachAudioStreamProcessor(music.stream, AudioProcessorCallback);
@@ -408,6 +372,8 @@ int main(int argc, char *argv[]) {
     float maxTime = analysisDuration;  // This is set to song duration when no timeout specified
     float lastProgressUpdate = 0.0f;
     time_t startWallTime = time(NULL);
+    float spectrum[FFT_SIZE/2];
+    double frameTime;
     
     while (1) {  // Loop until we explicitly break
         // Update music stream
@@ -437,9 +403,9 @@ int main(int argc, char *argv[]) {
             lastProgressUpdate = currentTime;
         }
         
-        // Analyze if we have enough samples
-        if (analyzer.samplesCollected >= FFT_SIZE) {
-            analyzeAudioFrame(&analyzer, currentTime, verbose);
+        // Analyze every frame the callback has completed
+        while (audio_stftNextFrame(analyzer.stft, spectrum, &frameTime)) {
+            analyzeAudioFrame(&analyzer, spectrum, frameTime, verbose);
         }
         
         // NO WAIT - process as fast as possible
@@ -473,6 +439,7 @@ int main(int argc, char *argv[]) {
     // Cleanup
     DetachAudioStreamProcessor(music.stream, AudioProcessorCallback);
     g_analyzer = NULL;
+    audio_stftDestroy(analyzer.stft);
     UnloadMusicStream(music);
     CloseAudioDevice();
     
@@ -1,5 +1,7 @@
 #include "raylib.h"
 #include "audio_analysis.h"
+#include "audio_stft.h"
+#include "audio_view.h"
 #include <stdio.h>
 #include <math.h>
 #include <string.h>
@@ -24,9 +26,10 @@
 #define BASS_THRESHOLD_HIGH_DEFAULT 0.30f
 
 typedef struct {
+    AudioSTFT *stft;
     float magnitude[FFT_SIZE/2];
-    float history[HISTORY_SIZE][FFT_SIZE/2];  // Spectrogram history
-    int historyIndex;
+    AudioSpectrumView spectrum;
+    AudioSpectrogramView spectrogram;  // Last HISTORY_SIZE frames
     float bassEnergy;
     BassLevel currentBassLevel;
     BassLevel previousBassLevel;
@@ -35,9 +38,6 @@ typedef struct {
     int bassEventCount;
     char logBuffer[1024];
     double lastLogTime;
-    float audioBuffer[FFT_SIZE];
-    int audioBufferWritePos;
-    int samplesCollected;
     FILE *logFile;  // File handle for logging
     BassConfig config;  // Configuration
     int configChanged;  // Flag to show config was changed
@@ -144,58 +144,23 @@ int selectAudioFile(char *selectedPath, size_t pathSize) {
 void AudioProcessorCallback(void *buffer, unsigned int frames) {
     if (g_analyzer == NULL) return;
     
-    float *data = (float *)buffer;
-    
-    // Collect samples for FFT analysis
-    for (unsigned int i = 0; i < frames * 2; i += 2) {  // Stereo data
-        if (g_analyzer->samplesCollected < FFT_SIZE) {
-            // Use left channel, normalize from stereo
-            float sample = data[i];
-            g_analyzer->audioBuffer[g_analyzer->audioBufferWritePos] = sample;
-            g_analyzer->audioBufferWritePos = (g_analyzer->audioBufferWritePos + 1) % FFT_SIZE;
-            g_analyzer->samplesCollected++;
-        }
-    }
+    // Stereo float data; the STFT picks the configured channel
+    audio_stftPush(g_analyzer->stft, (const float *)buffer, frames, 2);
 }
 
 
-// Analyze audio frame and extract spectrum
-void analyzeAudioFrame(AudioAnalyzer *analyzer) {
-    if (analyzer->samplesCollected < FFT_SIZE) {
-        return;  // Not enough samples yet
-    }
-    
-    // Prepare complex array for FFT
-    float complex fftData[FFT_SIZE];
-    
-    // Copy samples and apply window
-    float windowedSamples[FFT_SIZE];
-    for (int i = 0; i < FFT_SIZE; i++) {
-        windowedSamples[i] = analyzer->audioBuffer[i];
-    }
-    audio_applyWindow(windowedSamples, FFT_SIZE);
-    
-    // Convert to complex
-    for (int i = 0; i < FFT_SIZE; i++) {
-        fftData[i] = windowedSamples[i];
-    }
-    
-    // Perform FFT
-    audio_fft(fftData, FFT_SIZE);
-    
+// Analyze one STFT frame (currentTime = music time at the end of the frame)
+void analyzeAudioFrame(AudioAnalyzer *analyzer, const float *spectrum, double currentTime) {
     // Calculate magnitude spectrum with smoothing
     for (int i = 0; i < FFT_SIZE/2; i++) {
-        float real = crealf(fftData[i]);
-        float imag = cimagf(fftData[i]);
-        float newMag = sqrtf(real * real + imag * imag) / (FFT_SIZE/4);
+        float newMag = spectrum[i] / (FFT_SIZE/4);
         
         // Apply smoothing to reduce jitter
         analyzer->magnitude[i] = analyzer->magnitude[i] * 0.7f + newMag * 0.3f;
     }
     
     // Update spectrogram history
-    memcpy(analyzer->history[analyzer->historyIndex], analyzer->magnitude, sizeof(float) * (FFT_SIZE/2));
-    analyzer->historyIndex = (analyzer->historyIndex + 1) % HISTORY_SIZE;
+    audio_spectrogramViewPush(&analyzer->spectrogram, analyzer->magnitude);
     
     // Calculate bass energy using shared function
     analyzer->bassEnergy = audio_calculateBassEnergy(analyzer->magnitude, FFT_SIZE/2);
@@ -205,8 +170,6 @@ void analyzeAudioFrame(AudioAnalyzer *analyzer) {
     analyzer->currentBassLevel = audio_getBassLevel(analyzer->bassEnergy, &analyzer->config);
     
     // Detect peaks - only if enabled
-    double currentTime = GetTime();
-    
     if (analyzer->config.peakEnabled) {
         // Peak detection: sudden energy increases
         float energyDelta = analyzer->bassEnergy - analyzer->previousBassEnergy;
@@ -219,7 +182,7 @@ void analyzeAudioFrame(AudioAnalyzer *analyzer) {
             analyzer->lastPeakTime = currentTime;
             analyzer->peakCount++;
             analyzer->peakEnergy = analyzer->bassEnergy;
-            analyzer->peakDisplayTime = currentTime;
+            analyzer->peakDisplayTime = GetTime();
             
             snprintf(analyzer->logBuffer, sizeof(analyzer->logBuffer),
                     "[%.2f] PEAK detected - Energy: %.3f (increase: +%.1f%%)", 
@@ -290,10 +253,6 @@ void analyzeAudioFrame(AudioAnalyzer *analyzer) {
             fflush(analyzer->logFile);
         }
     }
-    
-    // Reset sample counter for next batch
-    analyzer->samplesCollected = 0;
-    analyzer->audioBufferWritePos = 0;
 }
 
 // Draw spectrum analyzer
@@ -302,36 +261,9 @@ void drawSpectrum(AudioAnalyzer *analyzer, int x, int y, int width, int height)
     DrawRectangle(x, y, width, height, (Color){20, 20, 30, 255});
     DrawRectangleLines(x, y, width, height, GRAY);
     
-    // Draw frequency spectrum bars
-    int barCount = width / 4;
-    float binStep = (FFT_SIZE/4.0f) / barCount;  // Show only lower half for better visibility
-    
-    for (int i = 0; i < barCount; i++) {
-        int binIndex = (int)(i * binStep);
-        if (binIndex >= FFT_SIZE/2) break;
-        
-        float magnitude = analyzer->magnitude[binIndex];
-        float barHeight = magnitude * height * 50.0f;  // Scale for visibility
-        if (barHeight > height) barHeight = height;
-        
-        // Color based on frequency range
-        Color barColor;
-        float freq = (binIndex * SAMPLE_RATE) / FFT_SIZE;
-        if (freq < BASS_FREQ_MAX) {
-            // Bass frequencies - red to orange gradient
-            int intensity = (int)(magnitude * 2000);
-            if (intensity > 255) intensity = 255;
-            barColor = (Color){255, intensity, 0, 200};
-        } else if (freq < 2000) {
-            // Mid frequencies - green
-            barColor = (Color){0, 200, 100, 200};
-        } else {
-            // High frequencies - blue
-            barColor = (Color){100, 150, 255, 200};
-        }
-        
-        DrawRectangle(x + i * 4, y + height - (int)barHeight, 3, (int)barHeight, barColor);
-    }
+    // Draw frequency spectrum bars (lower half of the spectrum for better visibility)
+    audio_spectrumViewDraw(&analyzer->spectrum, analyzer->magnitude,
+                           (Rectangle){ (float)x, (float)y, (float)width, (float)height });
     
     // Draw labels
     DrawText("Spectrum Analyzer", x + 5, y + 5, 12, WHITE);
@@ -351,44 +283,8 @@ void drawSpectrogram(AudioAnalyzer *analyzer, int x, int y, int width, int heigh
     DrawRectangleLines(x, y, width, height, GRAY);
     
     // Draw spectrogram history
-    int barWidth = width / HISTORY_SIZE;
-    if (barWidth < 1) barWidth = 1;
-    
-    for (int t = 0; t < HISTORY_SIZE; t++) {
-        int histIndex = (analyzer->historyIndex - t - 1 + HISTORY_SIZE) % HISTORY_SIZE;
-        int xPos = x + width - (t + 1) * barWidth;
-        
-        // Draw frequency bins as vertical lines
-        int binCount = height;
-        float binStep = (FFT_SIZE/4.0f) / binCount;  // Only show lower frequencies
-        
-        for (int f = 0; f < binCount; f++) {
-            int binIndex = (int)(f * binStep);
-            if (binIndex >= FFT_SIZE/2) break;
-            
-            float magnitude = analyzer->history[histIndex][binIndex];
-            
-            // Color intensity based on magnitude
-            int intensity = (int)(magnitude * 3000.0f);
-            if (intensity > 255) intensity = 255;
-            
-            // Color based on frequency range
-            float freq = (binIndex * SAMPLE_RATE) / FFT_SIZE;
-            Color pixelColor;
-            if (freq < BASS_FREQ_MAX) {
-                // Bass - red/orange
-                pixelColor = (Color){intensity, intensity/2, 0, 255};
-            } else if (freq < 2000) {
-                // Mid - green
-                pixelColor = (Color){0, intensity, intensity/2, 255};
-            } else {
-                // High - blue
-                pixelColor = (Color){intensity/2, intensity/2, intensity, 255};
-            }
-            
-            DrawRectangle(xPos, y + height - f - 1, barWidth, 1, pixelColor);
-        }
-    }
+    audio_spectrogramViewDraw(&analyzer->spectrogram,
+                              (Rectangle){ (float)x, (float)y, (float)width, (float)height });
     
     // Draw labels
     DrawText("Spectrogram (Time →)", x + 5, y + 5, 12, WHITE);
@@ -579,6 +475,9 @@ int main(int argc, char *argv[]) {
     printf("Channels: %u\n", music.stream.channels);
     // Initialize audio analyzer
     AudioAnalyzer analyzer = {0};
+    analyzer.stft = audio_stftCreate(NULL);
+    audio_spectrumViewInit(&analyzer.spectrum, SPECTRUM_WIDTH / 4, FFT_SIZE/4);
+    audio_spectrogramViewInit(&analyzer.spectrogram, HISTORY_SIZE, SPECTROGRAM_HEIGHT, FFT_SIZE/4);
     g_analyzer = &analyzer;
     
     // Load configuration (with custom path if specified)
@@ -651,15 +550,18 @@ int main(int argc, char *argv[]) {
         // Update music
         UpdateMusicStream(music);
         
-        // Analyze audio if we have enough samples
-        if (analyzer.samplesCollected >= FFT_SIZE) {
-            analyzeAudioFrame(&analyzer);
+        // Analyze every frame the audio callback has completed
+        float spectrum[FFT_SIZE/2];
+        double frameTime;
+        while (audio_stftNextFrame(analyzer.stft, spectrum, &frameTime)) {
+            analyzeAudioFrame(&analyzer, spectrum, frameTime);
         }
         
         // Restart music if it ends (but not if manually paused)
         if (!isPaused && !IsMusicStreamPlaying(music)) {
             StopMusicStream(music);
             PlayMusicStream(music);
+            audio_stftReset(analyzer.stft, 0.0);
             printf("\n=== Music Restarted ===\n\n");
         }
         
@@ -693,11 +595,9 @@ int main(int argc, char *argv[]) {
             analyzer.bassEndTime = 0;
             analyzer.currentBassLevel = BASS_NONE;
             analyzer.previousBassLevel = BASS_NONE;
-            analyzer.historyIndex = 0;
-            memset(analyzer.history, 0, sizeof(analyzer.history));
+            audio_spectrogramViewClear(&analyzer.spectrogram);
             memset(analyzer.magnitude, 0, sizeof(analyzer.magnitude));
-            analyzer.samplesCollected = 0;
-            analyzer.audioBufferWritePos = 0;
+            audio_stftReset(analyzer.stft, 0.0);
             // Reset peak detection
             analyzer.peakCount = 0;
             analyzer.previousBassEnergy = 0.0f;
@@ -863,6 +763,9 @@ int main(int argc, char *argv[]) {
     
     DetachAudioStreamProcessor(music.stream, AudioProcessorCallback);
     g_analyzer = NULL;
+    audio_stftDestroy(analyzer.stft);
+    audio_spectrumViewUnload(&analyzer.spectrum);
+    audio_spectrogramViewUnload(&analyzer.spectrogram);
     UnloadMusicStream(music);
     CloseAudioDevice();
     CloseWindow();
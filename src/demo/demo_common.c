@@ -21,11 +21,6 @@ Camera2D DemoCommon_InitCamera(float width, float height) {
 // Game System Initialization
 // ============================================================================
 
-void DemoCommon_InitGameTypes(void) {
-    InitEnemyTypes();
-    InitProjectileTypes();
-}
-
 void DemoCommon_InitBulletsArray(Bullet* bullets, int count) {
     if (!bullets) return;
     
@@ -59,8 +54,9 @@ void DemoCommon_InitProjectilesArray(Projectile* projectiles, int count) {
 
 ExplosionSystem* DemoCommon_CreateExplosionSystem(void) {
     ExplosionSystem* system = (ExplosionSystem*)malloc(sizeof(ExplosionSystem));
-    if (system) {
-        InitExplosionSystem(system);
+    if (system && !InitExplosionSystem(system, MAX_EXPLOSIONS)) {
+        free(system);
+        system = NULL;
     }
     return system;
 }
@@ -69,10 +69,6 @@ typedef struct {
 
 // Initialize grid selection mode
 void InitGridState(GridState* state) {
-    // Initialize enemy types and projectile types
-    InitEnemyTypes();
-    InitProjectileTypes();
-    
     // Create one enemy of each type for display
     for (int i = 0; i < ENEMY_TYPE_COUNT; i++) {
         int row = i / ENEMIES_PER_ROW;
@@ -109,7 +105,7 @@ void InitArenaState(ArenaState* state, EnemyType enemyType, InputManager* inputM
     
     // Initialize bullets array
     state->bullets = (Bullet*)malloc(sizeof(Bullet) * MAX_BULLETS);
-    InitBullets(state->bullets);
+    InitBullets(state->bullets, MAX_BULLETS);
     
     // Initialize enemies array
     state->enemies = (EnemyEx*)malloc(sizeof(EnemyEx) * MAX_ENEMIES);
@@ -127,7 +123,7 @@ void InitArenaState(ArenaState* state, EnemyType enemyType, InputManager* inputM
     
     // Initialize explosion system (reused from main game)
     state->explosionSystem = (ExplosionSystem*)malloc(sizeof(ExplosionSystem));
-    InitExplosionSystem(state->explosionSystem);
+    InitExplosionSystem(state->explosionSystem, MAX_EXPLOSIONS);
     
     state->activeEnemyCount = 0;
     state->spawnTimer = 0.0f;
@@ -155,6 +151,7 @@ void CleanupArenaState(ArenaState* state) {
         state->projectiles = NULL;
     }
     if (state->explosionSystem) {
+        CleanupExplosionSystem(state->explosionSystem);
         free(state->explosionSystem);
         state->explosionSystem = NULL;
     }
@@ -528,7 +525,7 @@ void DrawArenaState(const ArenaState* state) {
     DrawEngineTrail(state->playerShip);
     
     // Draw bullets
-    DrawBullets(state->bullets);
+    DrawBullets(state->bullets, MAX_BULLETS);
     
     // Draw enemies
     for (int i = 0; i < MAX_ENEMIES; i++) {
@@ -40,9 +40,6 @@ typedef struct {
 } ShowcaseState;
 
 void InitShowcase(ShowcaseState* state) {
-    // Initialize enemy types
-    InitEnemyTypes();
-    
     // Try to load sprites
     state->spritesLoaded = false;
     state->spaceshipSpritesLoaded = false;
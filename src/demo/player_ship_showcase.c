@@ -30,7 +30,6 @@ void InitShowcase(ShowcaseState* state) {
     state->ship.position = (Vector2){SCREEN_WIDTH/4, SCREEN_HEIGHT/2};
     
     // Initialize projectiles
-    InitProjectileTypes();
     for (int i = 0; i < MAX_PROJECTILES; i++) {
         state->projectiles[i].active = false;
     }
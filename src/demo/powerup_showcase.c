@@ -5,6 +5,7 @@
 #include "enemy_types.h"
 #include "input_config.h"
 #include "input_manager.h"
+#include "game_random.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -14,7 +15,7 @@
 
 int main(void) {
     // Initialize random seed
-    srand(time(NULL));
+    GameRandom_Seed((unsigned int)time(NULL));
     
     // Initialize window
     InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Powerup System Showcase");
@@ -28,7 +29,7 @@ int main(void) {
     
     // Initialize systems
     PowerupSystem powerupSystem;
-    InitPowerupSystem(&powerupSystem);
+    InitPowerupSystem(&powerupSystem, MAX_POWERUPS);
     
     PlayerShip player;
     InitPlayerShip(&player);
@@ -178,7 +179,7 @@ int main(void) {
         infoY += 30;
         
         DrawText(TextFormat("Active Powerups: %d / %d", 
-                           powerupSystem.activePowerupCount, MAX_POWERUPS), 
+                           powerupSystem.activePowerupCount, powerupSystem.capacity), 
                 infoX, infoY, 16, WHITE);
         infoY += 20;
         
@@ -29,10 +29,6 @@ typedef struct {
 } ShowcaseState;
 
 void InitShowcase(ShowcaseState* state) {
-    // Initialize projectile types
-    InitProjectileTypes();
-    InitEnemyTypes();
-    
     // Clear projectiles
     for (int i = 0; i < MAX_PROJECTILES; i++) {
         state->projectiles[i].active = false;
@@ -1,12 +1,14 @@
 #include "explosion.h"
 #include "constants.h"
+#include "game_random.h"
 #include <math.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 // Helper function to get random float between min and max
 static float RandomFloat(float min, float max) {
-    return min + (max - min) * ((float)rand() / RAND_MAX);
+    return min + (max - min) * GameRandom_Float();
 }
 
 // Helper function to get random direction vector
@@ -15,20 +17,37 @@ static Vector2 RandomDirection(void) {
     return (Vector2){cosf(angle), sinf(angle)};
 }
 
-void InitExplosionSystem(ExplosionSystem* system) {
+bool InitExplosionSystem(ExplosionSystem* system, int capacity) {
     memset(system, 0, sizeof(ExplosionSystem));
     
-    for (int i = 0; i < MAX_EXPLOSIONS; i++) {
-        system->explosions[i].active = false;
+    system->explosions = (Explosion*)calloc(capacity, sizeof(Explosion));
+    if (!system->explosions) {
+        fprintf(stderr, "Failed to allocate %d explosions\n", capacity);
+        return false;
     }
+    system->capacity = capacity;
     
     system->activeCount = 0;
     system->screenShakeIntensity = 0.0f;
     system->screenShakeDuration = 0.0f;
     system->screenShakeOffset = (Vector2){0, 0};
+    return true;
+}
+
+void CleanupExplosionSystem(ExplosionSystem* system) {
+    free(system->explosions);
+    system->explosions = NULL;
+    system->capacity = 0;
+    system->activeCount = 0;
 }
 
 void UpdateExplosionSystem(ExplosionSystem* system, float deltaTime) {
+    UpdateExplosionShake(system, deltaTime);
+    int ended = UpdateExplosionRange(system, 0, system->capacity, deltaTime);
+    FinishExplosionUpdate(system, ended, deltaTime);
+}
+
+void UpdateExplosionShake(ExplosionSystem* system, float deltaTime) {
     // Update screen shake
     if (system->screenShakeDuration > 0) {
         system->screenShakeDuration -= deltaTime;
@@ -44,9 +63,13 @@ void UpdateExplosionSystem(ExplosionSystem* system, float deltaTime) {
             system->screenShakeIntensity *= 0.95f;
         }
     }
+}
+
+int UpdateExplosionRange(ExplosionSystem* system, int begin, int end, float deltaTime) {
+    int ended = 0;
     
     // Update each explosion
-    for (int i = 0; i < MAX_EXPLOSIONS; i++) {
+    for (int i = begin; i < end; i++) {
         Explosion* exp = &system->explosions[i];
         if (!exp->active) continue;
         
@@ -54,7 +77,7 @@ void UpdateExplosionSystem(ExplosionSystem* system, float deltaTime) {
         exp->life -= deltaTime * 2.0f; // Fade rate
         if (exp->life <= 0) {
             exp->active = false;
-            system->activeCount--;
+            ended++;
             continue;
         }
         
@@ -128,17 +151,22 @@ void UpdateExplosionSystem(ExplosionSystem* system, float deltaTime) {
         }
     }
     
+    return ended;
+}
+
+void FinishExplosionUpdate(ExplosionSystem* system, int ended, float deltaTime) {
+    system->activeCount -= ended;
+    
     // Cleanup inactive explosions periodically
-    static float cleanupTimer = 0;
-    cleanupTimer += deltaTime;
-    if (cleanupTimer > 1.0f) {
+    system->cleanupTimer += deltaTime;
+    if (system->cleanupTimer > 1.0f) {
         CleanupInactiveExplosions(system);
-        cleanupTimer = 0;
+        system->cleanupTimer = 0;
     }
 }
 
 void DrawExplosions(const ExplosionSystem* system) {
-    for (int i = 0; i < MAX_EXPLOSIONS; i++) {
+    for (int i = 0; i < system->capacity; i++) {
         const Explosion* exp = &system->explosions[i];
         if (!exp->active) continue;
         
@@ -229,7 +257,7 @@ void DrawExplosions(const ExplosionSystem* system) {
 void CreateExplosion(ExplosionSystem* system, Vector2 position, ExplosionType type) {
     // Find an inactive explosion slot
     Explosion* exp = NULL;
-    for (int i = 0; i < MAX_EXPLOSIONS; i++) {
+    for (int i = 0; i < system->capacity; i++) {
         if (!system->explosions[i].active) {
             exp = &system->explosions[i];
             break;
@@ -333,11 +361,11 @@ void CreateExplosion(ExplosionSystem* system, Vector2 position, ExplosionType ty
         
         // Color based on explosion type
         if (type == EXPLOSION_PLAYER) {
-            p->color = (rand() % 2) ? SKYBLUE : WHITE;
+            p->color = GameRandom_Int(0, 1) ? SKYBLUE : WHITE;
         } else if (type == EXPLOSION_PLASMA) {
-            p->color = (rand() % 2) ? PURPLE : VIOLET;
+            p->color = GameRandom_Int(0, 1) ? PURPLE : VIOLET;
         } else {
-            p->color = (rand() % 3) ? YELLOW : (rand() % 2) ? ORANGE : RED;
+            p->color = GameRandom_Int(0, 2) ? YELLOW : GameRandom_Int(0, 1) ? ORANGE : RED;
         }
     }
     
@@ -358,7 +386,7 @@ void CreateExplosion(ExplosionSystem* system, Vector2 position, ExplosionType ty
             d->rotationSpeed = RandomFloat(-10, 10);
             d->size = RandomFloat(5, 15);
             d->life = 1.0f;
-            d->color = (rand() % 2) ? DARKBLUE : DARKGRAY;
+            d->color = GameRandom_Int(0, 1) ? DARKBLUE : DARKGRAY;
         }
     }
 }
@@ -405,7 +433,7 @@ void CreateEnemyExplosion(ExplosionSystem* system, Vector2 position, Color enemy
     
     // Find an inactive explosion slot
     Explosion* exp = NULL;
-    for (int i = 0; i < MAX_EXPLOSIONS; i++) {
+    for (int i = 0; i < system->capacity; i++) {
         if (!system->explosions[i].active) {
             exp = &system->explosions[i];
             break;
@@ -471,7 +499,7 @@ void CreateShockwaveExplosion(ExplosionSystem* system, Vector2 position, float f
     CreateExplosion(system, position, EXPLOSION_SHOCKWAVE);
     
     // Find the explosion we just created and customize it
-    for (int i = 0; i < MAX_EXPLOSIONS; i++) {
+    for (int i = 0; i < system->capacity; i++) {
         if (system->explosions[i].active && 
             system->explosions[i].position.x == position.x &&
             system->explosions[i].position.y == position.y) {
@@ -488,7 +516,7 @@ void CreateBossExplosion(ExplosionSystem* system, Vector2 position, Color bossCo
     
     // Main explosion - very large with extended lifetime
     Explosion* mainExp = NULL;
-    for (int i = 0; i < MAX_EXPLOSIONS; i++) {
+    for (int i = 0; i < system->capacity; i++) {
         if (!system->explosions[i].active) {
             mainExp = &system->explosions[i];
             break;
@@ -531,7 +559,7 @@ void CreateBossExplosion(ExplosionSystem* system, Vector2 position, Color bossCo
     // Create 8 secondary explosions in a circle around boss (chain reaction!)
     for (int sec = 0; sec < 8; sec++) {
         Explosion* secExp = NULL;
-        for (int i = 0; i < MAX_EXPLOSIONS; i++) {
+        for (int i = 0; i < system->capacity; i++) {
             if (!system->explosions[i].active) {
                 secExp = &system->explosions[i];
                 break;
@@ -601,7 +629,7 @@ void CleanupInactiveExplosions(ExplosionSystem* system) {
     // Currently, explosions are already cleaned up when they become inactive
     // This is here for future expansion if needed
     system->activeCount = 0;
-    for (int i = 0; i < MAX_EXPLOSIONS; i++) {
+    for (int i = 0; i < system->capacity; i++) {
         if (system->explosions[i].active) {
             system->activeCount++;
         }
@@ -2,220 +2,12 @@
 #include <math.h>
 #include <string.h>
 
-// Global projectile type definitions
-ProjectileDefinition projectileTypes[PROJECTILE_TYPE_COUNT];
-EnemyWeaponConfig enemyWeapons[ENEMY_TYPE_COUNT];
-
-void InitProjectileTypes(void) {
-    // LASER - Fast, straight, basic projectile
-    projectileTypes[PROJECTILE_LASER] = (ProjectileDefinition){
-        .type = PROJECTILE_LASER,
-        .name = "Laser",
-        .speed = 500.0f,
-        .damage = 10,
-        .size = 12.0f,
-        .hitboxRadius = 4.0f,
-        .primaryColor = (Color){255, 50, 50, 255},      // Red
-        .secondaryColor = (Color){255, 150, 150, 200},  // Light red
-        .glowColor = (Color){255, 200, 200, 100},       // White-red glow
-        .pattern = PATTERN_STRAIGHT,
-        .homingStrength = 0.0f,
-        .lifetime = 3.0f,
-        .piercing = false,
-        .explosive = false,
-        .explosionRadius = 0.0f
-    };
-    
-    // PLASMA - Medium speed, slight homing
-    projectileTypes[PROJECTILE_PLASMA] = (ProjectileDefinition){
-        .type = PROJECTILE_PLASMA,
-        .name = "Plasma",
-        .speed = 300.0f,
-        .damage = 20,
-        .size = 16.0f,
-        .hitboxRadius = 6.0f,
-        .primaryColor = (Color){100, 200, 255, 255},    // Cyan
-        .secondaryColor = (Color){150, 220, 255, 200},  // Light cyan
-        .glowColor = (Color){200, 240, 255, 150},       // Bright cyan glow
-        .pattern = PATTERN_HOMING,
-        .homingStrength = 0.3f,
-        .lifetime = 4.0f,
-        .piercing = false,
-        .explosive = false,
-        .explosionRadius = 0.0f
-    };
-    
-    // MISSILE - Medium-fast, high damage, strong homing
-    projectileTypes[PROJECTILE_MISSILE] = (ProjectileDefinition){
-        .type = PROJECTILE_MISSILE,
-        .name = "Missile",
-        .speed = 280.0f,  // Balanced speed - faster than original 200, slower than 380
-        .damage = 50,
-        .size = 20.0f,
-        .hitboxRadius = 8.0f,
-        .primaryColor = (Color){100, 100, 100, 255},    // Gray
-        .secondaryColor = (Color){255, 150, 0, 255},    // Orange (exhaust)
-        .glowColor = (Color){255, 200, 0, 150},         // Yellow-orange glow
-        .pattern = PATTERN_HOMING,
-        .homingStrength = 0.7f,
-        .lifetime = 999.0f,  // Long lifetime to reach screen edge
-        .piercing = false,
-        .explosive = true,
-        .explosionRadius = 30.0f
-    };
-    
-    // ENERGY ORB - Slow, area damage, infinite range
-    projectileTypes[PROJECTILE_ENERGY_ORB] = (ProjectileDefinition){
-        .type = PROJECTILE_ENERGY_ORB,
-        .name = "Energy Orb",
-        .speed = 150.0f,
-        .damage = 35,
-        .size = 24.0f,
-        .hitboxRadius = 10.0f,
-        .primaryColor = (Color){200, 50, 255, 255},     // Purple
-        .secondaryColor = (Color){150, 100, 255, 200},  // Light purple
-        .glowColor = (Color){255, 150, 255, 150},       // Pink glow
-        .pattern = PATTERN_WAVE,
-        .homingStrength = 0.0f,
-        .lifetime = 999.0f,  // Effectively infinite - will despawn at screen edge instead
-        .piercing = true,
-        .explosive = true,
-        .explosionRadius = 40.0f
-    };
-    
-    // PLAYER BULLET - Player's basic projectile with damage = 1
-    projectileTypes[PROJECTILE_PLAYER_BULLET] = (ProjectileDefinition){
-        .type = PROJECTILE_PLAYER_BULLET,
-        .name = "Player Bullet",
-        .speed = 600.0f,  // Fast bullets for responsive gameplay
-        .damage = 1,      // Exactly 1 damage as required
-        .size = 8.0f,     // Small bullet
-        .hitboxRadius = 3.0f,
-        .primaryColor = (Color){255, 255, 0, 255},      // Yellow
-        .secondaryColor = (Color){255, 200, 0, 200},    // Orange-yellow
-        .glowColor = (Color){255, 255, 150, 100},       // Light yellow glow
-        .pattern = PATTERN_STRAIGHT,
-        .homingStrength = 0.0f,
-        .lifetime = 2.0f,
-        .piercing = false,
-        .explosive = false,
-        .explosionRadius = 0.0f
-    };
-    
-    // Map projectiles to enemy types
-    // GRUNT - Basic laser shots
-    enemyWeapons[ENEMY_GRUNT] = (EnemyWeaponConfig){
-        .enemyType = ENEMY_GRUNT,
-        .primaryProjectile = PROJECTILE_LASER,
-        .secondaryProjectile = PROJECTILE_LASER,
-        .fireRate = 1.0f,
-        .burstCount = 1,
-        .spreadAngle = 0.0f
-    };
-    
-    // TANK - Powerful missile barrage
-    enemyWeapons[ENEMY_TANK] = (EnemyWeaponConfig){
-        .enemyType = ENEMY_TANK,
-        .primaryProjectile = PROJECTILE_MISSILE,
-        .secondaryProjectile = PROJECTILE_ENERGY_ORB,
-        .fireRate = 0.6f,   // Reduced from 0.75 for better balance
-        .burstCount = 3,    // Reduced from 4 to 3 missiles (less overwhelming)
-        .spreadAngle = 20.0f  // Reduced spread from 25° to 20°
-    };
-    
-    // SPEEDER - Rapid laser fire
-    enemyWeapons[ENEMY_SPEEDER] = (EnemyWeaponConfig){
-        .enemyType = ENEMY_SPEEDER,
-        .primaryProjectile = PROJECTILE_LASER,
-        .secondaryProjectile = PROJECTILE_LASER,
-        .fireRate = 3.0f,
-        .burstCount = 3,
-        .spreadAngle = 15.0f
-    };
-    
-    // ZIGZAG - Plasma shots with spread
-    enemyWeapons[ENEMY_ZIGZAG] = (EnemyWeaponConfig){
-        .enemyType = ENEMY_ZIGZAG,
-        .primaryProjectile = PROJECTILE_PLASMA,
-        .secondaryProjectile = PROJECTILE_LASER,
-        .fireRate = 1.5f,
-        .burstCount = 2,
-        .spreadAngle = 30.0f
-    };
-    
-    // BOMBER - Energy orbs
-    enemyWeapons[ENEMY_BOMBER] = (EnemyWeaponConfig){
-        .enemyType = ENEMY_BOMBER,
-        .primaryProjectile = PROJECTILE_ENERGY_ORB,
-        .secondaryProjectile = PROJECTILE_MISSILE,
-        .fireRate = 0.8f,
-        .burstCount = 1,
-        .spreadAngle = 0.0f
-    };
-    
-    // SHIELD - Defensive plasma bursts
-    enemyWeapons[ENEMY_SHIELD] = (EnemyWeaponConfig){
-        .enemyType = ENEMY_SHIELD,
-        .primaryProjectile = PROJECTILE_PLASMA,
-        .secondaryProjectile = PROJECTILE_PLASMA,
-        .fireRate = 1.2f,
-        .burstCount = 6,  // Fires in all directions
-        .spreadAngle = 360.0f
-    };
-    
-    // SWARM - Rapid weak lasers
-    enemyWeapons[ENEMY_SWARM] = (EnemyWeaponConfig){
-        .enemyType = ENEMY_SWARM,
-        .primaryProjectile = PROJECTILE_LASER,
-        .secondaryProjectile = PROJECTILE_LASER,
-        .fireRate = 2.0f,
-        .burstCount = 1,
-        .spreadAngle = 0.0f
-    };
-    
-    // ELITE - Mixed arsenal
-    enemyWeapons[ENEMY_ELITE] = (EnemyWeaponConfig){
-        .enemyType = ENEMY_ELITE,
-        .primaryProjectile = PROJECTILE_PLASMA,
-        .secondaryProjectile = PROJECTILE_MISSILE,
-        .fireRate = 2.0f,
-        .burstCount = 4,
-        .spreadAngle = 45.0f
-    };
-    
-    // GHOST - Phasing plasma shots
-    enemyWeapons[ENEMY_GHOST] = (EnemyWeaponConfig){
-        .enemyType = ENEMY_GHOST,
-        .primaryProjectile = PROJECTILE_PLASMA,
-        .secondaryProjectile = PROJECTILE_ENERGY_ORB,
-        .fireRate = 1.0f,
-        .burstCount = 2,
-        .spreadAngle = 20.0f
-    };
-    
-    // BOSS - Everything!
-    enemyWeapons[ENEMY_BOSS] = (EnemyWeaponConfig){
-        .enemyType = ENEMY_BOSS,
-        .primaryProjectile = PROJECTILE_MISSILE,
-        .secondaryProjectile = PROJECTILE_ENERGY_ORB,
-        .fireRate = 2.5f,
-        .burstCount = 8,
-        .spreadAngle = 360.0f
-    };
-}
-
-const ProjectileDefinition* GetProjectileDefinition(ProjectileType type) {
-    if (type < 0 || type >= PROJECTILE_TYPE_COUNT) {
-        return &projectileTypes[PROJECTILE_LASER];  // Default to laser
-    }
-    return &projectileTypes[type];
-}
-
 void InitializeProjectile(Projectile* projectile, ProjectileType type, Vector2 position, Vector2 target, bool isPlayer) {
     const ProjectileDefinition* def = GetProjectileDefinition(type);
     
     projectile->type = type;
     projectile->position = position;
+    projectile->previousPosition = position;
     projectile->active = true;
     projectile->lifetime = def->lifetime;
     projectile->animationTimer = 0;
@@ -469,19 +261,3 @@ void DrawProjectile(const Projectile* projectile) {
     // Draw glow effect
     DrawCircleV(projectile->position, def->size * 1.5f, Fade(def->glowColor, 0.2f));
 }
-
-const EnemyWeaponConfig* GetEnemyWeaponConfig(EnemyType enemyType) {
-    if (enemyType < 0 || enemyType >= ENEMY_TYPE_COUNT) {
-        return &enemyWeapons[ENEMY_GRUNT];  // Default to grunt
-    }
-    return &enemyWeapons[enemyType];
-}
-
-ProjectileType GetEnemyPrimaryProjectile(EnemyType enemyType) {
-    return GetEnemyWeaponConfig(enemyType)->primaryProjectile;
-}
-
-ProjectileType GetEnemySecondaryProjectile(EnemyType enemyType) {
-    return GetEnemyWeaponConfig(enemyType)->secondaryProjectile;
-}
-
@@ -4,174 +4,13 @@
 #include <math.h>
 #include <string.h>
 
-// Global enemy type definitions
-EnemyTypeDefinition enemyTypes[ENEMY_TYPE_COUNT];
-
-void InitEnemyTypes(void) {
-    // GRUNT - Basic enemy, small and weak but fast
-    enemyTypes[ENEMY_GRUNT] = (EnemyTypeDefinition){
-        .type = ENEMY_GRUNT,
-        .name = "Grunt",
-        .size = 0.8f,
-        .health = 1,
-        .speed = 1.2f,
-        .power = 10,
-        .primaryColor = (Color){200, 50, 50, 255},    // Dark Red
-        .secondaryColor = (Color){150, 30, 30, 255},  // Darker Red
-        .glowColor = (Color){255, 100, 100, 128},     // Light Red glow
-        .resistance = 0.0f,
-        .symbol = "▲"
-    };
-    
-    // TANK - Large, slow, very high health (20 hits - heavy assault platform)
-    enemyTypes[ENEMY_TANK] = (EnemyTypeDefinition){
-        .type = ENEMY_TANK,
-        .name = "Tank",
-        .size = 2.0f,
-        .health = 20,  // Increased from 7 to 20 for sustained combat
-        .speed = 0.5f,
-        .power = 30,
-        .primaryColor = (Color){80, 80, 100, 255},    // Dark Gray-Blue
-        .secondaryColor = (Color){60, 60, 80, 255},   // Darker Gray
-        .glowColor = (Color){120, 120, 150, 128},     // Light Gray glow
-        .resistance = 0.2f,  // Reduced from 0.5 to ensure damage is taken
-        .symbol = "■"
-    };
-    
-    // SPEEDER - Very fast, low health
-    enemyTypes[ENEMY_SPEEDER] = (EnemyTypeDefinition){
-        .type = ENEMY_SPEEDER,
-        .name = "Speeder",
-        .size = 0.6f,
-        .health = 1,
-        .speed = 2.5f,
-        .power = 15,
-        .primaryColor = (Color){255, 200, 0, 255},    // Yellow
-        .secondaryColor = (Color){255, 150, 0, 255},  // Orange
-        .glowColor = (Color){255, 255, 100, 128},     // Light Yellow glow
-        .resistance = 0.0f,
-        .symbol = "»"
-    };
-    
-    // ZIGZAG - Medium stats, erratic movement
-    enemyTypes[ENEMY_ZIGZAG] = (EnemyTypeDefinition){
-        .type = ENEMY_ZIGZAG,
-        .name = "Zigzag",
-        .size = 1.0f,
-        .health = 2,
-        .speed = 1.0f,
-        .power = 20,
-        .primaryColor = (Color){0, 200, 100, 255},    // Green
-        .secondaryColor = (Color){0, 150, 75, 255},   // Dark Green
-        .glowColor = (Color){100, 255, 150, 128},     // Light Green glow
-        .resistance = 0.1f,
-        .symbol = "◊"
-    };
-    
-    // BOMBER - Large, dangerous (6 hits per flight plan)
-    enemyTypes[ENEMY_BOMBER] = (EnemyTypeDefinition){
-        .type = ENEMY_BOMBER,
-        .name = "Bomber",
-        .size = 1.5f,
-        .health = 6,
-        .speed = 0.8f,
-        .power = 40,
-        .primaryColor = (Color){150, 50, 200, 255},   // Purple
-        .secondaryColor = (Color){100, 30, 150, 255}, // Dark Purple
-        .glowColor = (Color){200, 100, 255, 128},     // Light Purple glow
-        .resistance = 0.1f,  // Reduced to ensure proper damage
-        .symbol = "◉"
-    };
-    
-    // SHIELD - Has protective shield (7 hits total per flight plan)
-    enemyTypes[ENEMY_SHIELD] = (EnemyTypeDefinition){
-        .type = ENEMY_SHIELD,
-        .name = "Shield",
-        .size = 1.2f,
-        .health = 7,  // 3 for shield + 4 for enemy = 7 total
-        .speed = 0.9f,
-        .power = 25,
-        .primaryColor = (Color){0, 150, 200, 255},    // Cyan
-        .secondaryColor = (Color){0, 100, 150, 255},  // Dark Cyan
-        .glowColor = (Color){100, 200, 255, 128},     // Light Cyan glow
-        .resistance = 0.3f,  // Reduced from 0.7 to ensure damage
-        .symbol = "◎"
-    };
-    
-    // SWARM - Small, appears in groups
-    enemyTypes[ENEMY_SWARM] = (EnemyTypeDefinition){
-        .type = ENEMY_SWARM,
-        .name = "Swarm",
-        .size = 0.5f,
-        .health = 1,
-        .speed = 1.5f,
-        .power = 8,
-        .primaryColor = (Color){255, 100, 0, 255},    // Orange
-        .secondaryColor = (Color){200, 80, 0, 255},   // Dark Orange
-        .glowColor = (Color){255, 150, 50, 128},      // Light Orange glow
-        .resistance = 0.0f,
-        .symbol = "•"
-    };
-    
-    // ELITE - Strong all-around (5 hits - balanced challenge)
-    enemyTypes[ENEMY_ELITE] = (EnemyTypeDefinition){
-        .type = ENEMY_ELITE,
-        .name = "Elite",
-        .size = 1.3f,
-        .health = 5,
-        .speed = 1.3f,
-        .power = 35,
-        .primaryColor = (Color){200, 200, 0, 255},    // Gold
-        .secondaryColor = (Color){150, 150, 0, 255},  // Dark Gold
-        .glowColor = (Color){255, 255, 200, 128},     // Light Gold glow
-        .resistance = 0.2f,  // Reduced to ensure proper damage
-        .symbol = "★"
-    };
-    
-    // GHOST - Phases in and out
-    enemyTypes[ENEMY_GHOST] = (EnemyTypeDefinition){
-        .type = ENEMY_GHOST,
-        .name = "Ghost",
-        .size = 1.1f,
-        .health = 2,
-        .speed = 1.1f,
-        .power = 22,
-        .primaryColor = (Color){150, 150, 255, 180},  // Semi-transparent Blue
-        .secondaryColor = (Color){100, 100, 200, 180},// Dark Blue
-        .glowColor = (Color){200, 200, 255, 100},     // Light Blue glow
-        .resistance = 0.4f,
-        .symbol = "◈"
-    };
-    
-    // BOSS - Very large and powerful (no shield, just lots of health)
-    enemyTypes[ENEMY_BOSS] = (EnemyTypeDefinition){
-        .type = ENEMY_BOSS,
-        .name = "Boss",
-        .size = 3.0f,
-        .health = 1000,  // Massive health pool for epic boss battles
-        .speed = 0.6f,
-        .power = 50,
-        .primaryColor = (Color){150, 0, 0, 255},      // Dark Red
-        .secondaryColor = (Color){100, 0, 0, 255},    // Very Dark Red
-        .glowColor = (Color){255, 50, 50, 128},       // Red glow
-        .resistance = 0.3f,  // 30% damage reduction
-        .symbol = "✦"
-    };
-}
-
-const EnemyTypeDefinition* GetEnemyTypeDefinition(EnemyType type) {
-    if (type < 0 || type >= ENEMY_TYPE_COUNT) {
-        return &enemyTypes[ENEMY_GRUNT];  // Default to grunt
-    }
-    return &enemyTypes[type];
-}
-
 void InitializeEnemyFromType(EnemyEx* enemy, EnemyType type, float x, float y) {
     const EnemyTypeDefinition* def = GetEnemyTypeDefinition(type);
     
     // Basic properties
     enemy->position.x = x;
     enemy->position.y = y;
+    enemy->previousPosition = enemy->position;
     enemy->active = true;
     enemy->type = type;
     
@@ -219,7 +58,7 @@ void InitializeEnemyFromType(EnemyEx* enemy, EnemyType type, float x, float y) {
     
     // Firing properties
     enemy->fireTimer = 0;
-    enemy->nextFireTime = 1.0f / GetEnemyWeaponConfig(type)->fireRate;
+    enemy->nextFireTime = GetEnemyWeaponConfig(type)->fireInterval;
     enemy->can_fire = true;  // Default to true, will be overridden by wave system if needed
     
     // Hit tracking
@@ -385,13 +224,3 @@ void DrawEnemyEx(const EnemyEx* enemy) {
                      barWidth * healthPercent, barHeight, Fade(GREEN, alpha * 0.8f));
     }
 }
-
-const char* GetEnemyTypeName(EnemyType type) {
-    const EnemyTypeDefinition* def = GetEnemyTypeDefinition(type);
-    return def->name;
-}
-
-Color GetEnemyTypeColor(EnemyType type) {
-    const EnemyTypeDefinition* def = GetEnemyTypeDefinition(type);
-    return def->primaryColor;
-}
@@ -21,6 +21,7 @@ static const ShipConfig DEFAULT_SHIP_CONFIG = {
 void InitPlayerShip(PlayerShip* ship) {
     // Position and physics (centered in play zone, not full screen)
     ship->position = (Vector2){150, PLAY_ZONE_TOP + PLAY_ZONE_HEIGHT/2};
+    ship->previousPosition = ship->position;
     ship->velocity = (Vector2){0, 0};
     ship->bounds = (Rectangle){
         ship->position.x - 25,
@@ -47,6 +48,8 @@ void InitPlayerShip(PlayerShip* ship) {
     // Weapon system (simplified - no heat, no charging)
     ship->weaponMode = WEAPON_MODE_SINGLE;
     ship->fireTimer = 0.0f;
+    ship->shootTimer = 0.0f;
+    ship->devastatingFireTimer = 0.0f;
     
     // Movement (simplified - no boost)
     ship->baseSpeed = DEFAULT_SHIP_CONFIG.baseSpeed;
@@ -157,13 +160,13 @@ void UpdatePlayerShip(PlayerShip* ship, float deltaTime, const InputManager* inp
         if (ship->energy <= 0) {
             ship->energy = 0;
             ship->specialAbilityActive = false;
-            ship->lastEnergyDepletionTime = GetTime();  // Mark when energy was depleted
+            ship->lastEnergyDepletionTime = ship->animTime;  // Mark when energy was depleted
         }
     }
     
     // Shield regeneration (affected by energy mode)
     if (ship->shield < ship->maxShield) {
-        float timeSinceDamage = GetTime() - ship->lastDamageTime;
+        float timeSinceDamage = ship->animTime - ship->lastDamageTime;
         if (timeSinceDamage > ship->shieldRegenDelay) {
             float regenRate = ship->shieldRegenRate;
             
@@ -182,7 +185,7 @@ void UpdatePlayerShip(PlayerShip* ship, float deltaTime, const InputManager* inp
     
     // Energy regeneration with delay after depletion
     if (ship->energy < ship->maxEnergy) {
-        float timeSinceDepletion = GetTime() - ship->lastEnergyDepletionTime;
+        float timeSinceDepletion = ship->animTime - ship->lastEnergyDepletionTime;
         
         // Only regenerate if 5 seconds have passed since last depletion
         if (timeSinceDepletion > ship->energyRegenDelay) {
@@ -207,17 +210,18 @@ void HandlePlayerInput(PlayerShip* ship, const InputManager* inputManager) {
     }
     
     // Weapon mode switching with number keys 1-6
-    if (IsKeyPressed(KEY_ONE)) {
+    int hotkey = InputManager_GetWeaponHotkey(inputManager);
+    if (hotkey == 1) {
         ship->weaponMode = WEAPON_MODE_SINGLE;
-    } else if (IsKeyPressed(KEY_TWO)) {
+    } else if (hotkey == 2) {
         ship->weaponMode = WEAPON_MODE_DOUBLE;
-    } else if (IsKeyPressed(KEY_THREE)) {
+    } else if (hotkey == 3) {
         ship->weaponMode = WEAPON_MODE_SPREAD;
-    } else if (IsKeyPressed(KEY_FOUR)) {
+    } else if (hotkey == 4) {
         ship->weaponMode = WEAPON_MODE_RAPID;
-    } else if (IsKeyPressed(KEY_FIVE)) {
+    } else if (hotkey == 5) {
         ship->weaponMode = WEAPON_MODE_CHARGE;
-    } else if (IsKeyPressed(KEY_SIX)) {
+    } else if (hotkey == 6) {
         ship->weaponMode = WEAPON_MODE_DUAL;
     } else if (InputManager_IsActionPressed(inputManager, ACTION_SWITCH_WEAPON_MODE)) {
         // Cycle through weapon modes in order with R key or gamepad button
@@ -540,7 +544,7 @@ void DrawShipHUD(const PlayerShip* ship) {
     DrawRectangleLines(hudX + 50, hudY + spacing * 2, barWidth, barHeight, WHITE);
     
     // Energy status indicator (compact)
-    float timeSinceDepletion = GetTime() - ship->lastEnergyDepletionTime;
+    float timeSinceDepletion = ship->animTime - ship->lastEnergyDepletionTime;
     if (ship->energy <= 0 && timeSinceDepletion < ship->energyRegenDelay) {
         float remainingDelay = ship->energyRegenDelay - timeSinceDepletion;
         DrawText(TextFormat("%.1fs", remainingDelay), hudX + 235, hudY + spacing * 2, 10, RED);
@@ -659,7 +663,7 @@ void DamagePlayerShip(PlayerShip* ship, int damage) {
         ship->reviveEffectTimer = 2.0f;  // 2 second revive effect
     }
     
-    ship->lastDamageTime = GetTime();
+    ship->lastDamageTime = ship->animTime;
 }
 
 void RepairPlayerShip(PlayerShip* ship, int amount) {
@@ -1,6 +1,9 @@
 #include "level_system.h"
 #include "json_loader.h"
 #include "constants.h"
+#include "asset_pack.h"
+#include "powerup.h"
+#include "explosion.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -45,6 +48,17 @@ void InitLevelManager(LevelManager* manager) {
             
             // Free the temporary config structure (strings were already copied)
             free(config);
+            
+            // Optional bass envelope written by the audio analyzers
+            LevelConfig* level = &manager->levels[i];
+            if (AssetPack_FileExists(level->bassEnvelopePath)) {
+                level->bassEnvelope = BassEnvelope_Load(level->bassEnvelopePath);
+                if (level->bassEnvelope) {
+                    printf("[LEVEL SYSTEM] Level %d bass envelope: %d frames at %d Hz (%.2fs)\n",
+                           level->levelNumber, level->bassEnvelope->frameCount,
+                           level->bassEnvelope->frameRate, BassEnvelope_GetDuration(level->bassEnvelope));
+                }
+            }
         } else {
             printf("[LEVEL SYSTEM] ERROR: Failed to load level %d from %s\n", 
                    meta->levels[i].id, filepath);
@@ -52,11 +66,13 @@ void InitLevelManager(LevelManager* manager) {
             manager->levels[i].levelNumber = i + 1;
             manager->levels[i].name = strdup("Unknown Level");
             manager->levels[i].audioPath = strdup("");
-            manager->levels[i].bassLogPath = NULL;
+            manager->levels[i].bassEnvelopePath = NULL;
+            manager->levels[i].bassEnvelope = NULL;
             manager->levels[i].duration = 0.0f;
             manager->levels[i].targetScore = 0;
             manager->levels[i].description = strdup("");
             manager->levels[i].jsonFilePath = strdup(filepath);
+            memset(&manager->levels[i].capacity, 0, sizeof(PoolCapacity));
         }
     }
     
@@ -91,7 +107,8 @@ void CleanupLevelManager(LevelManager* manager) {
             if (manager->levels[i].name) free((void*)manager->levels[i].name);
             if (manager->levels[i].description) free((void*)manager->levels[i].description);
             if (manager->levels[i].audioPath) free((void*)manager->levels[i].audioPath);
-            if (manager->levels[i].bassLogPath) free((void*)manager->levels[i].bassLogPath);
+            if (manager->levels[i].bassEnvelopePath) free((void*)manager->levels[i].bassEnvelopePath);
+            BassEnvelope_Unload(manager->levels[i].bassEnvelope);
             if (manager->levels[i].jsonFilePath) free((void*)manager->levels[i].jsonFilePath);
         }
         free(manager->levels);
@@ -144,3 +161,35 @@ void ResetToLevel(LevelManager* manager, int levelNumber) {
 int GetTotalLevels(const LevelManager* manager) {
     return manager->levelCount;
 }
+
+// Larger of the current size and a level's request, capped at MAX_POOL_CAPACITY
+static int RaiseCapacity(int current, int requested) {
+    if (requested > MAX_POOL_CAPACITY) {
+        requested = MAX_POOL_CAPACITY;
+    }
+    return requested > current ? requested : current;
+}
+
+PoolCapacity GetRunPoolCapacity(const LevelManager* manager) {
+    PoolCapacity capacity = {
+        .bullets = MAX_BULLETS,
+        .enemies = MAX_ENEMIES,
+        .projectiles = MAX_PROJECTILES,
+        .powerups = MAX_POWERUPS,
+        .explosions = MAX_EXPLOSIONS
+    };
+    
+    for (int i = 0; manager && i < manager->levelCount; i++) {
+        const PoolCapacity* level = &manager->levels[i].capacity;
+        capacity.bullets = RaiseCapacity(capacity.bullets, level->bullets);
+        capacity.enemies = RaiseCapacity(capacity.enemies, level->enemies);
+        capacity.projectiles = RaiseCapacity(capacity.projectiles, level->projectiles);
+        capacity.powerups = RaiseCapacity(capacity.powerups, level->powerups);
+        capacity.explosions = RaiseCapacity(capacity.explosions, level->explosions);
+    }
+    return capacity;
+}
+
+BassSample GetLevelBassSample(const LevelConfig* level, float musicTime) {
+    return BassEnvelope_Sample(level ? level->bassEnvelope : NULL, musicTime);
+}
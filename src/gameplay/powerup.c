@@ -1,6 +1,7 @@
 #include "powerup.h"
 #include "constants.h"
 #include "utils.h"
+#include "game_random.h"
 #include <stdlib.h>
 #include <math.h>
 #include <stdio.h>
@@ -111,18 +112,26 @@ static const PowerupDropRate DROP_RATES[] = {
     }
 };
 
-void InitPowerupSystem(PowerupSystem* system) {
-    for (int i = 0; i < MAX_POWERUPS; i++) {
-        system->powerups[i].active = false;
+bool InitPowerupSystem(PowerupSystem* system, int capacity) {
+    system->powerups = (Powerup*)calloc(capacity, sizeof(Powerup));
+    if (!system->powerups) {
+        fprintf(stderr, "Failed to allocate %d powerups\n", capacity);
+        system->capacity = 0;
+        return false;
     }
+    system->capacity = capacity;
     system->activePowerupCount = 0;
     system->totalPowerupsSpawned = 0;
     system->totalPowerupsCollected = 0;
+    for (int i = 0; i < POWERUP_TYPE_COUNT; i++) {
+        system->collectedByType[i] = 0;
+    }
+    return true;
 }
 
 void SpawnPowerup(PowerupSystem* system, PowerupType type, Vector2 position) {
     // Find an inactive powerup slot
-    for (int i = 0; i < MAX_POWERUPS; i++) {
+    for (int i = 0; i < system->capacity; i++) {
         if (!system->powerups[i].active) {
             Powerup* powerup = &system->powerups[i];
             
@@ -132,7 +141,7 @@ void SpawnPowerup(PowerupSystem* system, PowerupType type, Vector2 position) {
             powerup->active = true;
             powerup->lifetime = 0.0f;
             powerup->animationTime = 0.0f;
-            powerup->pulsePhase = (float)rand() / RAND_MAX * 2.0f * PI;
+            powerup->pulsePhase = GameRandom_Float() * 2.0f * PI;
             powerup->rotationAngle = 0.0f;
             powerup->magnetRange = POWERUP_MAGNET_RANGE;
             powerup->isBeingMagneted = false;
@@ -186,7 +195,7 @@ PowerupDropRate GetDropRateForEnemy(EnemyType enemyType) {
 }
 
 PowerupType GetRandomPowerupFromRates(PowerupDropRate rates) {
-    float roll = (float)rand() / RAND_MAX * 100.0f;
+    float roll = GameRandom_Float() * 100.0f;
     float cumulative = 0.0f;
     
     // Check each powerup type in order
@@ -212,20 +221,20 @@ void DropPowerupFromEnemy(PowerupSystem* system, const EnemyEx* enemy) {
     // Special handling for BOSS - drop multiple powerups!
     if (enemy->type == ENEMY_BOSS) {
         // Boss drops 4-5 powerups in a spread pattern for recovery
-        int numDrops = 4 + (rand() % 2);  // 4 or 5 powerups
+        int numDrops = GameRandom_Int(4, 5);  // 4 or 5 powerups
         PowerupDropRate rates = GetDropRateForEnemy(enemy->type);
         
         for (int i = 0; i < numDrops; i++) {
             // Spread powerups in a circular pattern around boss death position
             float angle = (2.0f * PI * i) / numDrops;
-            float spreadRadius = 40.0f + (rand() % 40);  // 40-80 pixels spread
+            float spreadRadius = 40.0f + GameRandom_Int(0, 39);  // 40-80 pixels spread
             Vector2 dropPos = {
                 enemy->position.x + cosf(angle) * spreadRadius,
                 enemy->position.y + sinf(angle) * spreadRadius
             };
             
             // Each drop has a chance based on boss drop rates
-            float dropRoll = (float)rand() / RAND_MAX * 100.0f;
+            float dropRoll = GameRandom_Float() * 100.0f;
             if (dropRoll < rates.nothingChance) {
                 continue;  // This particular slot drops nothing
             }
@@ -240,7 +249,7 @@ void DropPowerupFromEnemy(PowerupSystem* system, const EnemyEx* enemy) {
     PowerupDropRate rates = GetDropRateForEnemy(enemy->type);
     
     // Roll to see if anything drops
-    float dropRoll = (float)rand() / RAND_MAX * 100.0f;
+    float dropRoll = GameRandom_Float() * 100.0f;
     if (dropRoll < rates.nothingChance) {
         return;  // No drop
     }
@@ -253,7 +262,7 @@ void DropPowerupFromEnemy(PowerupSystem* system, const EnemyEx* enemy) {
 }
 
 void UpdatePowerups(PowerupSystem* system, PlayerShip* player, float deltaTime) {
-    for (int i = 0; i < MAX_POWERUPS; i++) {
+    for (int i = 0; i < system->capacity; i++) {
         if (!system->powerups[i].active) continue;
         
         Powerup* powerup = &system->powerups[i];
@@ -457,7 +466,7 @@ void DrawPowerup(const Powerup* powerup) {
 }
 
 void DrawPowerups(const PowerupSystem* system) {
-    for (int i = 0; i < MAX_POWERUPS; i++) {
+    for (int i = 0; i < system->capacity; i++) {
         if (system->powerups[i].active) {
             DrawPowerup(&system->powerups[i]);
         }
@@ -513,24 +522,31 @@ void ApplyPowerupEffect(PlayerShip* player, PowerupType type, int* score) {
 void CheckPowerupCollisions(PowerupSystem* system, PlayerShip* player, int* score) {
     if (!player || !player->isVisible) return;
     
-    for (int i = 0; i < MAX_POWERUPS; i++) {
+    for (int i = 0; i < system->capacity; i++) {
         if (!system->powerups[i].active) continue;
         
         Powerup* powerup = &system->powerups[i];
         
         // Check collision with player
         if (CheckCollisionRecs(player->bounds, powerup->bounds)) {
-            // Apply powerup effect
-            ApplyPowerupEffect(player, powerup->type, score);
-            
-            // Deactivate powerup
-            powerup->active = false;
-            system->activePowerupCount--;
-            system->totalPowerupsCollected++;
+            CollectPowerup(system, i, player, score);
         }
     }
 }
 
+void CollectPowerup(PowerupSystem* system, int index, PlayerShip* player, int* score) {
+    Powerup* powerup = &system->powerups[index];
+    
+    // Apply powerup effect
+    ApplyPowerupEffect(player, powerup->type, score);
+    
+    // Deactivate powerup
+    powerup->active = false;
+    system->activePowerupCount--;
+    system->totalPowerupsCollected++;
+    system->collectedByType[powerup->type]++;
+}
+
 const char* GetPowerupName(PowerupType type) {
     switch (type) {
         case POWERUP_ENERGY: return "Energy Cell";
@@ -552,11 +568,10 @@ const char* GetPowerupDescription(PowerupType type) {
 }
 
 void CleanupPowerupSystem(PowerupSystem* system) {
-    // Nothing to cleanup - powerups are stack-allocated within the struct
-    // Just mark all as inactive
     if (system) {
-        for (int i = 0; i < MAX_POWERUPS; i++) {
-            system->powerups[i].active = false;
-        }
+        free(system->powerups);
+        system->powerups = NULL;
+        system->capacity = 0;
+        system->activePowerupCount = 0;
     }
 }
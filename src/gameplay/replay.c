@@ -0,0 +1,148 @@
+#include "replay.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+void Replay_InitRecorder(ReplayRecorder* recorder) {
+    memset(recorder, 0, sizeof(ReplayRecorder));
+}
+
+static void WriteByte(ReplayRecorder* recorder, unsigned char value) {
+    if (recorder->failed) {
+        return;
+    }
+
+    if (recorder->size >= recorder->capacity) {
+        int capacity = recorder->capacity > 0 ? recorder->capacity * 2 : 1024;
+        unsigned char* data = (unsigned char*)realloc(recorder->data, capacity);
+        if (!data) {
+            recorder->failed = true;
+            return;
+        }
+        recorder->data = data;
+        recorder->capacity = capacity;
+    }
+    recorder->data[recorder->size++] = value;
+}
+
+static void WriteVarint(ReplayRecorder* recorder, unsigned int value) {
+    while (value >= 0x80) {
+        WriteByte(recorder, (unsigned char)(value | 0x80));
+        value >>= 7;
+    }
+    WriteByte(recorder, (unsigned char)value);
+}
+
+// Encode the run being counted
+static void FlushRun(ReplayRecorder* recorder) {
+    if (recorder->runLength == 0) {
+        return;
+    }
+
+    WriteVarint(recorder, recorder->runState ^ recorder->previousState);
+    WriteVarint(recorder, (unsigned int)recorder->runLength);
+    recorder->previousState = recorder->runState;
+    recorder->runLength = 0;
+}
+
+void Replay_RecordTick(ReplayRecorder* recorder, InputTickState state) {
+    if (recorder->runLength > 0 && state != recorder->runState) {
+        FlushRun(recorder);
+    }
+
+    recorder->runState = state;
+    recorder->runLength++;
+    recorder->tickCount++;
+}
+
+bool Replay_FinishRecorder(ReplayRecorder* recorder, unsigned char** outData, int* outSize) {
+    FlushRun(recorder);
+
+    bool ok = !recorder->failed && recorder->tickCount > 0;
+    if (ok) {
+        *outData = recorder->data;
+        *outSize = recorder->size;
+        recorder->data = NULL;
+    }
+
+    Replay_FreeRecorder(recorder);
+    return ok;
+}
+
+void Replay_FreeRecorder(ReplayRecorder* recorder) {
+    free(recorder->data);
+    Replay_InitRecorder(recorder);
+}
+
+bool Replay_OpenReader(ReplayReader* reader, int replayId) {
+    memset(reader, 0, sizeof(ReplayReader));
+
+    if (!DB_GetReplayInfo(replayId, &reader->info)) {
+        printf("[REPLAY] Replay %d not found\n", replayId);
+        return false;
+    }
+    if (reader->info.formatVersion != REPLAY_FORMAT_VERSION) {
+        printf("[REPLAY] Replay %d has unsupported format %d\n", replayId, reader->info.formatVersion);
+        return false;
+    }
+    return true;
+}
+
+// Next encoded byte, fetching the following chunk of the blob when the buffer is used up
+static bool ReadByte(ReplayReader* reader, unsigned char* value) {
+    if (reader->bufferPos >= reader->bufferSize) {
+        if (reader->nextOffset >= reader->info.dataSize) {
+            return false;
+        }
+
+        int count = 0;
+        if (!DB_ReadReplayData(reader->info.id, reader->nextOffset, reader->buffer, REPLAY_READ_CHUNK, &count) ||
+            count == 0) {
+            reader->failed = true;
+            return false;
+        }
+        reader->bufferSize = count;
+        reader->bufferPos = 0;
+        reader->nextOffset += count;
+    }
+
+    *value = reader->buffer[reader->bufferPos++];
+    return true;
+}
+
+static bool ReadVarint(ReplayReader* reader, unsigned int* value) {
+    *value = 0;
+    for (int shift = 0; shift < 32; shift += 7) {
+        unsigned char byte;
+        if (!ReadByte(reader, &byte)) {
+            return false;
+        }
+        *value |= (unsigned int)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+
+    reader->failed = true;  // Longer than any value the recorder writes
+    return false;
+}
+
+bool Replay_NextInput(ReplayReader* reader, InputTickState* outState) {
+    if (reader->remaining == 0) {
+        unsigned int delta, length;
+        if (!ReadVarint(reader, &delta)) {
+            return false;
+        }
+        if (!ReadVarint(reader, &length) || length == 0) {
+            reader->failed = true;
+            return false;
+        }
+        reader->state ^= delta;
+        reader->remaining = (int)length;
+    }
+
+    reader->remaining--;
+    reader->ticksRead++;
+    *outState = reader->state;
+    return true;
+}
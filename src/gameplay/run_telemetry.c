@@ -0,0 +1,140 @@
+#include "run_telemetry.h"
+#include "level_system.h"
+#include "player_ship.h"
+#include <stdio.h>
+#include <string.h>
+
+void RunTelemetry_Init(RunTelemetry* telemetry) {
+    memset(telemetry, 0, sizeof(RunTelemetry));
+}
+
+// Fill the current phase's totals up to now (safe to call repeatedly)
+static void ClosePhase(RunTelemetry* telemetry, float gameTime, int score) {
+    if (telemetry->phaseCount == 0) {
+        return;
+    }
+
+    DBRunPhase* phase = &telemetry->phases[telemetry->phaseCount - 1];
+    phase->duration = gameTime - phase->startTime;
+    phase->score = score - telemetry->phaseStartScore;
+    phase->kills = telemetry->totalKills - telemetry->phaseStartKills;
+}
+
+void RunTelemetry_BeginPhase(RunTelemetry* telemetry, int level, float gameTime, int score) {
+    ClosePhase(telemetry, gameTime, score);
+
+    // Out of phases: the last one keeps running
+    if (telemetry->phaseCount >= DB_RUN_MAX_PHASES) {
+        return;
+    }
+
+    DBRunPhase* phase = &telemetry->phases[telemetry->phaseCount++];
+    memset(phase, 0, sizeof(DBRunPhase));
+    phase->level = level;
+    phase->startTime = gameTime;
+    telemetry->phaseStartScore = score;
+    telemetry->phaseStartKills = telemetry->totalKills;
+}
+
+void RunTelemetry_RecordFrame(RunTelemetry* telemetry, float frameTime) {
+    float milliseconds = frameTime * 1000.0f;
+    int bucket = (int)(milliseconds / RUN_TELEMETRY_FRAME_BUCKET_MS);
+    if (bucket < 0) bucket = 0;
+    if (bucket >= RUN_TELEMETRY_FRAME_BUCKETS) bucket = RUN_TELEMETRY_FRAME_BUCKETS - 1;
+
+    telemetry->frameBuckets[bucket]++;
+    telemetry->frameCount++;
+    if (milliseconds > telemetry->frameTimeMax) {
+        telemetry->frameTimeMax = milliseconds;
+    }
+}
+
+// Frame time below which the given fraction of frames fall (upper edge of the bucket)
+static float FrameTimePercentile(const RunTelemetry* telemetry, float fraction) {
+    if (telemetry->frameCount == 0) {
+        return 0.0f;
+    }
+
+    int target = (int)(fraction * telemetry->frameCount + 0.999f);
+    if (target < 1) target = 1;
+
+    int seen = 0;
+    for (int i = 0; i < RUN_TELEMETRY_FRAME_BUCKETS; i++) {
+        seen += telemetry->frameBuckets[i];
+        if (seen >= target) {
+            float edge = (i + 1) * RUN_TELEMETRY_FRAME_BUCKET_MS;
+            return edge < telemetry->frameTimeMax ? edge : telemetry->frameTimeMax;
+        }
+    }
+
+    return telemetry->frameTimeMax;
+}
+
+void RunTelemetry_Finish(RunTelemetry* telemetry, const Game* game, DBRunRecord* record) {
+    memset(record, 0, sizeof(DBRunRecord));
+
+    ClosePhase(telemetry, game->gameTime, game->score);
+
+    const LevelConfig* level = game->levelManager ? GetCurrentLevel(game->levelManager) : NULL;
+    record->difficulty = DIFFICULTY_NORMAL;  // The game has no difficulty selection yet
+    record->score = game->score;
+    record->duration = game->gameTime;
+    record->levelReached = level ? level->levelNumber : 1;
+
+    // Victory ends the game with the ship intact; the boss escape zeroes its health
+    if (!game->gameOver) {
+        record->outcome = DB_RUN_ABANDONED;
+        strcpy(record->deathCause, "Abandoned");
+    } else {
+        record->outcome = (game->playerShip && game->playerShip->health > 0) ? DB_RUN_VICTORY : DB_RUN_DEATH;
+        strncpy(record->deathCause, game->deathCause, sizeof(record->deathCause) - 1);
+    }
+
+    record->frameCount = telemetry->frameCount;
+    record->frameTimeP50 = FrameTimePercentile(telemetry, 0.50f);
+    record->frameTimeP90 = FrameTimePercentile(telemetry, 0.90f);
+    record->frameTimeP99 = FrameTimePercentile(telemetry, 0.99f);
+    record->frameTimeMax = telemetry->frameTimeMax;
+
+    memcpy(record->phases, telemetry->phases, sizeof(DBRunPhase) * telemetry->phaseCount);
+    record->phaseCount = telemetry->phaseCount;
+
+    // Only types that occurred get a row
+    for (int i = 0; i < ENEMY_TYPE_COUNT; i++) {
+        if (telemetry->kills[i] == 0 && telemetry->damage[i] == 0) {
+            continue;
+        }
+        DBRunEnemyStats* enemy = &record->enemies[record->enemyTypeCount++];
+        strncpy(enemy->name, GetEnemyTypeName((EnemyType)i), sizeof(enemy->name) - 1);
+        enemy->kills = telemetry->kills[i];
+        enemy->damage = telemetry->damage[i];
+    }
+
+    if (game->powerupSystem) {
+        for (int i = 0; i < POWERUP_TYPE_COUNT; i++) {
+            int collected = game->powerupSystem->collectedByType[i];
+            if (collected == 0) {
+                continue;
+            }
+            DBRunPowerupStats* powerup = &record->powerups[record->powerupTypeCount++];
+            strncpy(powerup->name, GetPowerupName((PowerupType)i), sizeof(powerup->name) - 1);
+            powerup->collected = collected;
+        }
+    }
+}
+
+bool RunTelemetry_Submit(RunTelemetry* telemetry, const Game* game) {
+    if (telemetry->submitted || telemetry->frameCount == 0) {
+        return false;
+    }
+    telemetry->submitted = true;
+
+    DBRunRecord record;
+    RunTelemetry_Finish(telemetry, game, &record);
+
+    if (!DB_RecordRun(&record)) {
+        printf("[GAME] WARNING: Run telemetry was not recorded\n");
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,180 @@
+#include "stress_test.h"
+#include "constants.h"
+#include "combat_system.h"
+#include "game.h"
+#include "enemy_types.h"
+#include "player_ship.h"
+#include "projectile_types.h"
+#include "wave_system.h"
+#include "job_system.h"
+#include "game_random.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char* stageNames[STRESS_STAGE_COUNT] = {
+    "tick", "bullets", "waves", "enemy move", "enemy fire", "projectiles",
+    "explosions", "powerups", "starfield", "job graph", "collisions"
+};
+
+void StressTest_Init(StressTest* stress, int enemies, int projectiles) {
+    memset(stress, 0, sizeof(StressTest));
+
+    // The projectile pool gets a quarter on top for the shots enemies fire on their own
+    stress->targetEnemies = enemies > 0 ? enemies : STRESS_DEFAULT_ENEMIES;
+    stress->targetProjectiles = projectiles > 0 ? projectiles : STRESS_DEFAULT_PROJECTILES;
+    if (stress->targetEnemies > MAX_POOL_CAPACITY) {
+        stress->targetEnemies = MAX_POOL_CAPACITY;
+    }
+    if (stress->targetProjectiles > MAX_POOL_CAPACITY / 5 * 4) {
+        stress->targetProjectiles = MAX_POOL_CAPACITY / 5 * 4;
+    }
+    stress->nextReport = STRESS_REPORT_INTERVAL;
+}
+
+static int RaiseTo(int current, int needed) {
+    if (needed > MAX_POOL_CAPACITY) {
+        needed = MAX_POOL_CAPACITY;
+    }
+    return needed > current ? needed : current;
+}
+
+void StressTest_RaiseCapacity(const StressTest* stress, PoolCapacity* capacity) {
+    capacity->enemies = RaiseTo(capacity->enemies, stress->targetEnemies);
+    capacity->projectiles = RaiseTo(capacity->projectiles, stress->targetProjectiles + stress->targetProjectiles / 4);
+    capacity->explosions = RaiseTo(capacity->explosions, stress->targetEnemies / 2);
+    capacity->powerups = RaiseTo(capacity->powerups, stress->targetEnemies / 4);
+}
+
+void StressTest_Populate(StressTest* stress, Game* game) {
+    EnemyEx* enemies = game->enemies;
+    int enemyCapacity = game->capacity.enemies;
+
+    // Enemies: spawned on the right half of the play zone (wave enemies count toward the target)
+    int activeEnemies = CountActiveEnemies(game);
+    for (int spawned = 0; activeEnemies < stress->targetEnemies && spawned < STRESS_ENEMY_SPAWNS_PER_TICK; spawned++) {
+        EnemyType type = (EnemyType)GameRandom_Int(0, ENEMY_BOSS - 1);
+        float x = (float)GameRandom_Int(SCREEN_WIDTH / 2, SCREEN_WIDTH - 40);
+        float y = (float)GameRandom_Int(PLAY_ZONE_TOP + 20, PLAY_ZONE_BOTTOM - 20);
+        if (!SpawnWaveEnemy(game, type, x, y, NULL)) {
+            break;
+        }
+        activeEnemies++;
+    }
+
+    // Every enemy fires from the start
+    for (int i = 0; i < enemyCapacity; i++) {
+        if (enemies[i].active) {
+            enemies[i].can_fire = true;
+        }
+    }
+
+    // Projectiles: fired by the enemies in turn, filling the pool within about a second
+    Projectile* projectiles = (Projectile*)game->projectiles;
+    int projectileCapacity = game->capacity.projectiles;
+    int inFlight = 0;
+    for (int i = 0; i < projectileCapacity; i++) {
+        if (projectiles[i].active && !projectiles[i].isPlayerProjectile) {
+            inFlight++;
+        }
+    }
+
+    CombatContext ctx = {
+        .playerPosition = game->playerShip->position,
+        .screenWidth = SCREEN_WIDTH,
+        .screenHeight = SCREEN_HEIGHT
+    };
+    int budget = stress->targetProjectiles / SIM_TICK_RATE + 1;
+    int freeSlot = 0;
+    while (inFlight < stress->targetProjectiles && budget > 0 && activeEnemies > 0) {
+        // Free slots are searched from where the last shot went, not from the start of the pool
+        while (freeSlot < projectileCapacity && projectiles[freeSlot].active) {
+            freeSlot++;
+        }
+        if (freeSlot >= projectileCapacity) {
+            break;
+        }
+
+        int shooter = stress->nextShooter % enemyCapacity;
+        for (int tries = 0; !enemies[shooter].active && tries < enemyCapacity; tries++) {
+            shooter = (shooter + 1) % enemyCapacity;
+        }
+        if (!enemies[shooter].active) {
+            break;
+        }
+        stress->nextShooter = shooter + 1;
+
+        ctx.projectiles = projectiles + freeSlot;
+        ctx.maxProjectiles = projectileCapacity - freeSlot;
+        Combat_FireEnemyProjectile(&ctx, &enemies[shooter]);
+
+        int shots = GetEnemyWeaponConfig(enemies[shooter].type)->burstCount;
+        inFlight += shots;
+        budget -= shots;
+    }
+
+    // The player can not die, so the run lasts the full STRESS_DURATION
+    PlayerShip* player = game->playerShip;
+    player->health = player->maxHealth;
+    player->shield = player->maxShield;
+
+    stress->activeEnemies = activeEnemies;
+    stress->activeProjectiles = inFlight;
+    if (activeEnemies > stress->peakEnemies) {
+        stress->peakEnemies = activeEnemies;
+    }
+    if (inFlight > stress->peakProjectiles) {
+        stress->peakProjectiles = inFlight;
+    }
+}
+
+void StressTest_BeginTick(StressTest* stress) {
+    memset(stress->stageMs, 0, sizeof(stress->stageMs));
+}
+
+static void PrintTimings(const StressTiming* timings, int ticks) {
+    printf("[STRESS]   %-12s %9s %9s\n", "stage", "avg ms", "max ms");
+    for (int s = 0; s < STRESS_STAGE_COUNT; s++) {
+        printf("[STRESS]   %-12s %9.3f %9.3f\n", stageNames[s],
+               ticks > 0 ? timings[s].totalMs / ticks : 0.0, timings[s].maxMs);
+    }
+}
+
+static void AddTiming(StressTiming* timing, double ms) {
+    timing->totalMs += ms;
+    if (ms > timing->maxMs) {
+        timing->maxMs = ms;
+    }
+}
+
+void StressTest_EndTick(StressTest* stress, Game* game, float deltaTime) {
+    if (stress->finished) {
+        return;
+    }
+
+    for (int s = 0; s < STRESS_STAGE_COUNT; s++) {
+        AddTiming(&stress->window[s], stress->stageMs[s]);
+        AddTiming(&stress->run[s], stress->stageMs[s]);
+    }
+    stress->windowTicks++;
+    stress->runTicks++;
+    stress->elapsed += deltaTime;
+
+    if (stress->elapsed >= stress->nextReport) {
+        printf("[STRESS] %.0fs: %d enemies, %d enemy projectiles (pools %d / %d, %d job threads)\n",
+               stress->elapsed, stress->activeEnemies, stress->activeProjectiles,
+               game->capacity.enemies, game->capacity.projectiles, JobSystem_GetWorkerCount());
+        PrintTimings(stress->window, stress->windowTicks);
+        memset(stress->window, 0, sizeof(stress->window));
+        stress->windowTicks = 0;
+        stress->nextReport += STRESS_REPORT_INTERVAL;
+    }
+
+    if (stress->elapsed >= STRESS_DURATION) {
+        printf("[STRESS] Finished: %d ticks, peak %d enemies and %d enemy projectiles\n",
+               stress->runTicks, stress->peakEnemies, stress->peakProjectiles);
+        PrintTimings(stress->run, stress->runTicks);
+        stress->finished = true;
+        game->gameOver = true;
+        strcpy(game->deathCause, "Stress test finished");
+    }
+}
@@ -4,19 +4,47 @@
 #include "enemy_types.h"
 #include "constants.h"
 #include "utils.h"
+#include "game_random.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include <stdio.h>
 
-void InitWaveSystem(WaveSystem* waveSystem, const LevelConfig* levelConfig, bool applyDebugPhase) {
-    // Initialize enemy types first
-    InitEnemyTypes();
+// Build the time-bucket index so seeks don't scan the whole event list
+static void BuildSpawnEventIndex(WaveSystem* waveSystem) {
+    waveSystem->eventBuckets = NULL;
+    waveSystem->bucketCount = 0;
     
+    float lastTime = waveSystem->spawnEvents[waveSystem->eventCount - 1].time;
+    if (waveSystem->totalDuration > lastTime) lastTime = waveSystem->totalDuration;
+    int bucketCount = (int)(lastTime / WAVE_INDEX_BUCKET_SIZE) + 2;
+    
+    waveSystem->eventBuckets = (int*)malloc(sizeof(int) * bucketCount);
+    if (!waveSystem->eventBuckets) {
+        printf("[WAVE SYSTEM] WARNING: Failed to allocate spawn index, seeking will scan\n");
+        return;
+    }
+    
+    // Events are sorted by time, so one forward pass fills every bucket
+    int eventIndex = 0;
+    for (int b = 0; b < bucketCount; b++) {
+        float bucketStart = b * WAVE_INDEX_BUCKET_SIZE;
+        while (eventIndex < waveSystem->eventCount &&
+               waveSystem->spawnEvents[eventIndex].time < bucketStart) {
+            eventIndex++;
+        }
+        waveSystem->eventBuckets[b] = eventIndex;
+    }
+    waveSystem->bucketCount = bucketCount;
+}
+
+void InitWaveSystem(WaveSystem* waveSystem, const LevelConfig* levelConfig) {
     // No predefined phases - tracking is based on spawn events
     waveSystem->phaseCount = 0;
     waveSystem->phases = NULL;
     waveSystem->currentPhase = 0;
+    waveSystem->eventBuckets = NULL;
+    waveSystem->bucketCount = 0;
     
     // Load spawn events from JSON file
     if (levelConfig->jsonFilePath) {
@@ -40,56 +68,50 @@ void InitWaveSystem(WaveSystem* waveSystem, const LevelConfig* levelConfig, bool
     printf("[WAVE SYSTEM] Loaded %d spawn events for level %d: %s\n", 
            waveSystem->eventCount, levelConfig->levelNumber, levelConfig->name);
     
-    // Apply DEBUG_START_PHASE to set starting time (only if applyDebugPhase is true)
-    float startTime = 0.0f;
-    if (applyDebugPhase && DEBUG_START_PHASE > 0 && DEBUG_START_PHASE <= 17) {
-        // Phase timing mapping based on documentation
-        const float phaseTimes[] = {
-            0.0f,    // Phase 0: Normal start
-            0.0f,    // Phase 1: Warm-Up (0-5s)
-            5.0f,    // Phase 2: First Wave (5-35s)
-            35.0f,   // Phase 3: Tank Squadron (35-55s)
-            55.0f,   // Phase 4: Swarm Attack (55-85s)
-            85.0f,   // Phase 5: Mixed Assault (85-120s)
-            120.0f,  // Phase 6: Elite Squadron (120-150s)
-            150.0f,  // Phase 7: Zigzag Chaos (150-180s)
-            180.0f,  // Phase 8: Shield Wall (180-220s)
-            220.0f,  // Phase 9: Bomber Run (220-260s)
-            260.0f,  // Phase 10: Ghost Ambush (260-300s)
-            300.0f,  // Phase 11: Combined Arms (300-345s)
-            345.0f,  // Phase 12: Mini-Boss (345-390s)
-            390.0f,  // Phase 13: Recovery (390-420s)
-            420.0f,  // Phase 14: Elite & Shield (420-460s)
-            460.0f,  // Phase 15: Evasive Maneuvers (460-500s)
-            500.0f,  // Phase 16: Heavy Assault (500-540s)
-            540.0f   // Phase 17: Final Wave (540-590s)
-        };
-        startTime = phaseTimes[DEBUG_START_PHASE];
-    }
-    
-    // Initialize state with debug start time
-    waveSystem->waveTimer = startTime;
+    // Initialize state at the start of the level (use SeekWaveSystem to jump ahead)
+    waveSystem->waveTimer = 0.0f;
     waveSystem->totalDuration = levelConfig->duration; // Level duration from config
     waveSystem->isComplete = false;
-    waveSystem->lastSpawnTime = startTime;
+    waveSystem->lastSpawnTime = 0.0f;
     waveSystem->totalEnemiesSpawned = 0;
     waveSystem->totalEnemiesKilled = 0;
+    waveSystem->totalSpawnsDropped = 0;
     
-    // Skip spawn events that are before the debug start time
-    if (startTime > 0) {
-        while (waveSystem->nextEventIndex < waveSystem->eventCount &&
-               waveSystem->spawnEvents[waveSystem->nextEventIndex].time < startTime) {
-            waveSystem->nextEventIndex++;
-        }
-        printf("[WAVE SYSTEM] DEBUG: Starting at phase %d (%.1f seconds), skipped %d events\n", 
-               DEBUG_START_PHASE, startTime, waveSystem->nextEventIndex);
-    }
+    BuildSpawnEventIndex(waveSystem);
     
     printf("[WAVE SYSTEM] Initialized STATIC wave system (%.1f seconds)\n", 
             waveSystem->totalDuration);
     printf("[WAVE SYSTEM] Total spawn events: %d\n", waveSystem->eventCount);
 }
 
+int FindSpawnEventIndex(const WaveSystem* waveSystem, float time) {
+    if (time <= 0.0f) return 0;
+    
+    int eventIndex = 0;
+    int bucket = (int)(time / WAVE_INDEX_BUCKET_SIZE);
+    if (waveSystem->eventBuckets && bucket < waveSystem->bucketCount) {
+        eventIndex = waveSystem->eventBuckets[bucket];
+    } else if (waveSystem->eventBuckets) {
+        return waveSystem->eventCount;
+    }
+    
+    // At most one bucket's worth of events left to step over
+    while (eventIndex < waveSystem->eventCount &&
+           waveSystem->spawnEvents[eventIndex].time < time) {
+        eventIndex++;
+    }
+    return eventIndex;
+}
+
+void SeekWaveSystem(WaveSystem* waveSystem, float time) {
+    if (time < 0.0f) time = 0.0f;
+    
+    waveSystem->waveTimer = time;
+    waveSystem->lastSpawnTime = time;
+    waveSystem->nextEventIndex = FindSpawnEventIndex(waveSystem, time);
+    waveSystem->isComplete = (time >= waveSystem->totalDuration);
+}
+
 void UpdateWaveSystem(WaveSystem* waveSystem, struct Game* game, float deltaTime) {
     if (waveSystem->isComplete) return;
     
@@ -105,8 +127,11 @@ void UpdateWaveSystem(WaveSystem* waveSystem, struct Game* game, float deltaTime
         // Handle spawn event based on count
         if (event->count == 1) {
             // Single enemy spawn
-            SpawnWaveEnemy(game, event->type, event->x, event->y, event->pattern);
-            waveSystem->totalEnemiesSpawned++;
+            if (SpawnWaveEnemy(game, event->type, event->x, event->y, event->pattern)) {
+                waveSystem->totalEnemiesSpawned++;
+            } else {
+                waveSystem->totalSpawnsDropped++;
+            }
             
             LogEvent(game, "[%.2f] Spawn: %s at (%.0f, %.0f)", 
                     waveSystem->waveTimer, GetEnemyTypeName(event->type),
@@ -125,8 +150,11 @@ void UpdateWaveSystem(WaveSystem* waveSystem, struct Game* game, float deltaTime
                 if (spawnY < 80) spawnY = 80;
                 if (spawnY > SCREEN_HEIGHT - 80) spawnY = SCREEN_HEIGHT - 80;
                 
-                SpawnWaveEnemy(game, event->type, event->x, spawnY, event->pattern);
-                waveSystem->totalEnemiesSpawned++;
+                if (SpawnWaveEnemy(game, event->type, event->x, spawnY, event->pattern)) {
+                    waveSystem->totalEnemiesSpawned++;
+                } else {
+                    waveSystem->totalSpawnsDropped++;
+                }
             }
             
             LogEvent(game, "[%.2f] Spawn: %d x %s in formation", 
@@ -145,9 +173,9 @@ void UpdateWaveSystem(WaveSystem* waveSystem, struct Game* game, float deltaTime
     }
 }
 
-void SpawnWaveEnemy(struct Game* game, EnemyType type, float x, float y, const char* pattern) {
+bool SpawnWaveEnemy(struct Game* game, EnemyType type, float x, float y, const char* pattern) {
     // Find an inactive enemy slot
-    for (int i = 0; i < MAX_ENEMIES; i++) {
+    for (int i = 0; i < game->capacity.enemies; i++) {
         if (!game->enemies[i].active) {
             InitializeEnemyFromType(&game->enemies[i], type, x, y);
             game->enemies[i].id = game->nextEnemyId++;
@@ -173,9 +201,14 @@ void SpawnWaveEnemy(struct Game* game, EnemyType type, float x, float y, const c
             LogEvent(game, "[%.2f] Enemy spawned - Type:%s ID:%d Pattern:%s Pos:(%.0f,%.0f)", 
                     game->gameTime, GetEnemyTypeName(type), game->enemies[i].id, 
                     pattern ? pattern : "default", x, y);
-            break;
+            return true;
         }
     }
+    
+    // Pool exhausted - the spawn is lost
+    LogEvent(game, "[%.2f] Spawn DROPPED - Type:%s (all %d enemy slots active)", 
+            game->gameTime, GetEnemyTypeName(type), game->capacity.enemies);
+    return false;
 }
 
 void ApplyMovementPattern(EnemyEx* enemy, const char* pattern) {
@@ -189,7 +222,7 @@ void ApplyMovementPattern(EnemyEx* enemy, const char* pattern) {
         enemy->speedY = sinf(enemy->position.x * 0.05f) * 3.0f;
     } else if (strcmp(pattern, "erratic") == 0) {
         enemy->speedX = enemy->speed * 0.8f;
-        enemy->speedY = GetRandomValue(-3, 3);
+        enemy->speedY = GameRandom_Int(-3, 3);
     } else if (strcmp(pattern, "slow_advance") == 0) {
         enemy->speedX = enemy->speed * 0.5f;
         enemy->speedY = 0;
@@ -205,7 +238,7 @@ void ApplyMovementPattern(EnemyEx* enemy, const char* pattern) {
         enemy->speedY = 0;
     } else if (strcmp(pattern, "phasing") == 0) {
         enemy->speedX = enemy->speed * 0.9f;
-        enemy->speedY = GetRandomValue(-2, 2);
+        enemy->speedY = GameRandom_Int(-2, 2);
         enemy->specialTimer = 0;
     } else if (strcmp(pattern, "formation") == 0) {
         enemy->speedX = enemy->speed * 0.6f;
@@ -219,24 +252,24 @@ void ApplyMovementPattern(EnemyEx* enemy, const char* pattern) {
         enemy->targetY = PLAY_ZONE_HEIGHT/2;
     } else if (strcmp(pattern, "minion") == 0) {
         enemy->speedX = enemy->speed * 1.2f;
-        enemy->speedY = GetRandomValue(-2, 2);
+        enemy->speedY = GameRandom_Int(-2, 2);
     } else if (strcmp(pattern, "rush") == 0) {
         enemy->speedX = enemy->speed * 2.0f;
-        enemy->speedY = GetRandomValue(-1, 1);
+        enemy->speedY = GameRandom_Int(-1, 1);
     } else if (strcmp(pattern, "tank_assault") == 0) {
         // Tank assault pattern: advance, pause, retreat
         // Each tank has different speed and pause timing
-        float speedVariation = 0.5f + (GetRandomValue(0, 50) / 100.0f);  // 0.5x to 1.0x speed
+        float speedVariation = 0.5f + (GameRandom_Int(0, 50) / 100.0f);  // 0.5x to 1.0x speed
         enemy->speedX = enemy->speed * speedVariation;  // Speed for advancing (positive value)
         enemy->speedY = 0;
         
         // Set random stop position (not reaching last left third of screen)
         // Screen is 1200 wide, last third is 400, so stop between 400 and 900
-        float stopX = GetRandomValue(450, 900);
+        float stopX = GameRandom_Int(450, 900);
         enemy->targetY = stopX;  // Using targetY to store stop X position
         
         // Set random pause duration (5-10 seconds)
-        enemy->specialTimer = 5.0f + (GetRandomValue(0, 50) / 10.0f);  // 5.0 to 10.0 seconds
+        enemy->specialTimer = 5.0f + (GameRandom_Int(0, 50) / 10.0f);  // 5.0 to 10.0 seconds
         
         // Use moveTimer to track state: 0=advancing, 1=paused, 2=retreating
         enemy->moveTimer = 0;  // Start in advancing state
@@ -250,7 +283,7 @@ void ApplyMovementPattern(EnemyEx* enemy, const char* pattern) {
         enemy->targetY = stopX;  // Using targetY to store stop X position
         
         // Set pause duration (3-5 seconds, shorter than tanks)
-        enemy->specialTimer = 3.0f + (GetRandomValue(0, 20) / 10.0f);  // 3.0 to 5.0 seconds
+        enemy->specialTimer = 3.0f + (GameRandom_Int(0, 20) / 10.0f);  // 3.0 to 5.0 seconds
         
         // Use moveTimer to track state: 0=advancing, 1=paused, 2=retreating
         enemy->moveTimer = 0;  // Start in advancing state
@@ -429,8 +462,8 @@ void UpdateEnemyMovement(EnemyEx* enemy, float deltaTime) {
                         enemy->moveTimer = 1;  // Switch to hovering state
                         enemy->specialTimer = 0;  // Reset for movement timer
                         // Set initial target in safe zone (play zone only)
-                        enemy->targetY = GetRandomValue(PLAY_ZONE_TOP + 100, PLAY_ZONE_BOTTOM - 100);
-                        enemy->speedX = GetRandomValue(minBossX + 30, maxBossX - 30);  // Initial target X
+                        enemy->targetY = GameRandom_Int(PLAY_ZONE_TOP + 100, PLAY_ZONE_BOTTOM - 100);
+                        enemy->speedX = GameRandom_Int(minBossX + 30, maxBossX - 30);  // Initial target X
                     }
                 } else {
                     // State 1: Boss hovering in last third with controlled random movement
@@ -443,9 +476,9 @@ void UpdateEnemyMovement(EnemyEx* enemy, float deltaTime) {
                         enemy->specialTimer = 0;
                         
                         // Set new random target within play zone bounds
-                        enemy->targetY = GetRandomValue(PLAY_ZONE_TOP + 100, PLAY_ZONE_BOTTOM - 100);
+                        enemy->targetY = GameRandom_Int(PLAY_ZONE_TOP + 100, PLAY_ZONE_BOTTOM - 100);
                         // speedX repurposed for horizontal target position in this mode
-                        enemy->speedX = GetRandomValue(minBossX, maxBossX);
+                        enemy->speedX = GameRandom_Int(minBossX, maxBossX);
                     }
                     
                     // Smooth movement toward target Y (up/down)
@@ -524,6 +557,12 @@ void CleanupWaveSystem(WaveSystem* waveSystem) {
         waveSystem->spawnEvents = NULL;
     }
     
+    if (waveSystem->eventBuckets) {
+        free(waveSystem->eventBuckets);
+        waveSystem->eventBuckets = NULL;
+    }
+    waveSystem->bucketCount = 0;
+    
     waveSystem->eventCount = 0;
     waveSystem->nextEventIndex = 0;
 }
@@ -563,7 +602,6 @@ bool IsWaveComplete(const WaveSystem* waveSystem) {
 
 int GetCurrentPhaseNumber(const WaveSystem* waveSystem) {
     // Return the phase number based on current time
-    // This maps to DEBUG_START_PHASE values
     float time = waveSystem->waveTimer;
     
     if (time < 5.0f) return 1;
@@ -0,0 +1,238 @@
+#include "wave_timeline.h"
+#include "wave_system.h"
+#include "level_system.h"
+#include "player_ship.h"
+#include "combat_system.h"
+#include "projectile_manager.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+void WaveTimeline_Step(Game* game, Vector2 playerPosition, float deltaTime) {
+    game->gameTime += deltaTime;
+
+    ProjectileManager mgr = {
+        .projectiles = (Projectile*)game->projectiles,
+        .maxProjectiles = game->capacity.projectiles,
+        .minX = -100, .maxX = SCREEN_WIDTH + 100,
+        .minY = -100, .maxY = SCREEN_HEIGHT + 100
+    };
+    ProjectileManager_UpdateAll(&mgr, deltaTime);
+
+    UpdateWaveSystem(game->waveSystem, game, deltaTime);
+
+    CombatContext ctx = {
+        .playerPosition = playerPosition,
+        .projectiles = (Projectile*)game->projectiles,
+        .maxProjectiles = game->capacity.projectiles,
+        .screenWidth = SCREEN_WIDTH,
+        .screenHeight = SCREEN_HEIGHT
+    };
+
+    for (int i = 0; i < game->capacity.enemies; i++) {
+        if (game->enemies[i].active) {
+            UpdateEnemyMovement(&game->enemies[i], deltaTime);
+            Combat_UpdateEnemyFiring(&game->enemies[i], &ctx, deltaTime,
+                                     0, SCREEN_WIDTH, 0, SCREEN_HEIGHT);
+        }
+    }
+
+    // Drop boss tracking once it has left, as the game update does
+    if (game->bossEnemyIndex >= 0 && game->bossEnemyIndex < game->capacity.enemies &&
+        !game->enemies[game->bossEnemyIndex].active) {
+        game->bossEnemyIndex = -1;
+    }
+}
+
+static void CaptureCheckpoint(WaveCheckpoint* checkpoint, const Game* game) {
+    const WaveSystem* waveSystem = game->waveSystem;
+
+    checkpoint->levelTime = waveSystem->waveTimer;
+    memcpy(checkpoint->enemies, game->enemies, sizeof(EnemyEx) * game->capacity.enemies);
+    memcpy(checkpoint->projectiles, game->projectiles, sizeof(Projectile) * game->capacity.projectiles);
+    checkpoint->nextEventIndex = waveSystem->nextEventIndex;
+    checkpoint->waveTimer = waveSystem->waveTimer;
+    checkpoint->totalEnemiesSpawned = waveSystem->totalEnemiesSpawned;
+    checkpoint->totalSpawnsDropped = waveSystem->totalSpawnsDropped;
+    checkpoint->isComplete = waveSystem->isComplete;
+    checkpoint->nextEnemyId = game->nextEnemyId;
+    checkpoint->bossEnemyIndex = game->bossEnemyIndex;
+    checkpoint->bossSpawnTime = game->bossSpawnTime;
+}
+
+static void RestoreCheckpoint(const WaveCheckpoint* checkpoint, Game* game) {
+    WaveSystem* waveSystem = game->waveSystem;
+
+    memcpy(game->enemies, checkpoint->enemies, sizeof(EnemyEx) * game->capacity.enemies);
+    memcpy(game->projectiles, checkpoint->projectiles, sizeof(Projectile) * game->capacity.projectiles);
+    waveSystem->nextEventIndex = checkpoint->nextEventIndex;
+    waveSystem->waveTimer = checkpoint->waveTimer;
+    waveSystem->lastSpawnTime = checkpoint->waveTimer;
+    waveSystem->totalEnemiesSpawned = checkpoint->totalEnemiesSpawned;
+    waveSystem->totalSpawnsDropped = checkpoint->totalSpawnsDropped;
+    waveSystem->isComplete = checkpoint->isComplete;
+    game->nextEnemyId = checkpoint->nextEnemyId;
+    game->bossEnemyIndex = checkpoint->bossEnemyIndex;
+    game->bossSpawnTime = checkpoint->bossSpawnTime;
+    game->gameTime = game->levelStartTime + checkpoint->levelTime;
+}
+
+bool WaveTimeline_Build(WaveTimeline* timeline, const Game* game) {
+    WaveTimeline_Cleanup(timeline);
+
+    const LevelConfig* level = GetCurrentLevel(game->levelManager);
+    if (!level || !game->waveSystem || !game->waveSystem->spawnEvents) {
+        printf("[WAVE TIMELINE] ERROR: No wave plan loaded, cannot build timeline\n");
+        return false;
+    }
+
+    float duration = game->waveSystem->totalDuration;
+    int capacity = (int)(duration / WAVE_CHECKPOINT_INTERVAL) + 1;
+    int enemyCapacity = game->capacity.enemies;
+    int projectileCapacity = game->capacity.projectiles;
+    timeline->checkpoints = (WaveCheckpoint*)malloc(sizeof(WaveCheckpoint) * capacity);
+    timeline->enemySlots = (EnemyEx*)malloc(sizeof(EnemyEx) * enemyCapacity * capacity);
+    timeline->projectileSlots = (Projectile*)malloc(sizeof(Projectile) * projectileCapacity * capacity);
+    if (!timeline->checkpoints || !timeline->enemySlots || !timeline->projectileSlots) {
+        printf("[WAVE TIMELINE] ERROR: Failed to allocate %d checkpoints\n", capacity);
+        WaveTimeline_Cleanup(timeline);
+        return false;
+    }
+    timeline->enemyCapacity = enemyCapacity;
+    timeline->projectileCapacity = projectileCapacity;
+    for (int i = 0; i < capacity; i++) {
+        timeline->checkpoints[i].enemies = timeline->enemySlots + (size_t)i * enemyCapacity;
+        timeline->checkpoints[i].projectiles = timeline->projectileSlots + (size_t)i * projectileCapacity;
+    }
+
+    // Scratch game sharing the level's (read-only) spawn events and index
+    WaveSystem scratchWave = *game->waveSystem;
+    scratchWave.totalEnemiesSpawned = 0;
+    scratchWave.totalEnemiesKilled = 0;
+    scratchWave.totalSpawnsDropped = 0;
+    SeekWaveSystem(&scratchWave, 0.0f);
+
+    Game scratch;
+    memset(&scratch, 0, sizeof(Game));
+    scratch.capacity = game->capacity;
+    scratch.enemies = (EnemyEx*)calloc(enemyCapacity, sizeof(EnemyEx));
+    scratch.projectiles = calloc(projectileCapacity, sizeof(Projectile));
+    scratch.levelManager = game->levelManager;
+    scratch.waveSystem = &scratchWave;
+    scratch.logFile = NULL;
+    scratch.nextEnemyId = 1;
+    scratch.bossEnemyIndex = -1;
+    scratch.bossSpawnTime = -1.0f;
+
+    if (!scratch.enemies || !scratch.projectiles) {
+        printf("[WAVE TIMELINE] ERROR: Failed to allocate scratch pools\n");
+        free(scratch.enemies);
+        free(scratch.projectiles);
+        WaveTimeline_Cleanup(timeline);
+        return false;
+    }
+
+    Vector2 playerPosition = game->playerShip ? game->playerShip->position
+                                              : (Vector2){ 100, PLAY_ZONE_TOP + PLAY_ZONE_HEIGHT / 2 };
+    const float dt = 1.0f / WAVE_TIMELINE_FPS;
+    double startTime = GetTime();
+
+    CaptureCheckpoint(&timeline->checkpoints[0], &scratch);
+    timeline->checkpointCount = 1;
+
+    while (timeline->checkpointCount < capacity && !scratchWave.isComplete) {
+        WaveTimeline_Step(&scratch, playerPosition, dt);
+        if (scratchWave.waveTimer >= timeline->checkpointCount * WAVE_CHECKPOINT_INTERVAL) {
+            CaptureCheckpoint(&timeline->checkpoints[timeline->checkpointCount], &scratch);
+            timeline->checkpointCount++;
+        }
+    }
+
+    free(scratch.enemies);
+    free(scratch.projectiles);
+    timeline->levelNumber = level->levelNumber;
+
+    printf("[WAVE TIMELINE] Pre-rolled level %d: %d checkpoints every %.0fs in %.1f ms\n",
+           level->levelNumber, timeline->checkpointCount, WAVE_CHECKPOINT_INTERVAL,
+           (GetTime() - startTime) * 1000.0);
+    return true;
+}
+
+bool WaveTimeline_Seek(WaveTimeline* timeline, Game* game, float levelTime) {
+    const LevelConfig* level = GetCurrentLevel(game->levelManager);
+    if (!level) return false;
+
+    if (!timeline->checkpoints || timeline->levelNumber != level->levelNumber ||
+        timeline->enemyCapacity != game->capacity.enemies ||
+        timeline->projectileCapacity != game->capacity.projectiles) {
+        if (!WaveTimeline_Build(timeline, game)) return false;
+    }
+
+    float duration = game->waveSystem->totalDuration;
+    if (levelTime < 0.0f) levelTime = 0.0f;
+    if (levelTime > duration) levelTime = duration;
+
+    // Nearest checkpoint at or before the target (checkpoints land on frame boundaries)
+    int index = (int)(levelTime / WAVE_CHECKPOINT_INTERVAL);
+    if (index >= timeline->checkpointCount) index = timeline->checkpointCount - 1;
+    while (index > 0 && timeline->checkpoints[index].levelTime > levelTime) index--;
+
+    RestoreCheckpoint(&timeline->checkpoints[index], game);
+
+    // Simulate the remainder (at most one checkpoint interval)
+    Vector2 playerPosition = game->playerShip ? game->playerShip->position
+                                              : (Vector2){ 100, PLAY_ZONE_TOP + PLAY_ZONE_HEIGHT / 2 };
+    const float dt = 1.0f / WAVE_TIMELINE_FPS;
+    while (game->waveSystem->waveTimer + dt * 0.5f < levelTime && !game->waveSystem->isComplete) {
+        WaveTimeline_Step(game, playerPosition, dt);
+    }
+
+    printf("[WAVE TIMELINE] Seek to %.2fs (checkpoint %.2fs, next event %d/%d)\n",
+           levelTime, timeline->checkpoints[index].levelTime,
+           game->waveSystem->nextEventIndex, game->waveSystem->eventCount);
+    return true;
+}
+
+void WaveTimeline_Cleanup(WaveTimeline* timeline) {
+    if (timeline->checkpoints) {
+        free(timeline->checkpoints);
+        timeline->checkpoints = NULL;
+    }
+    free(timeline->enemySlots);
+    free(timeline->projectileSlots);
+    timeline->enemySlots = NULL;
+    timeline->projectileSlots = NULL;
+    timeline->enemyCapacity = 0;
+    timeline->projectileCapacity = 0;
+    timeline->checkpointCount = 0;
+    timeline->levelNumber = 0;
+}
+
+float WaveTimeline_GetPhaseStartTime(int phase) {
+    // Phase timing mapping based on documentation (DEBUG_START_PHASE values)
+    static const float phaseTimes[] = {
+        0.0f,    // Phase 0: Normal start
+        0.0f,    // Phase 1: Warm-Up (0-5s)
+        5.0f,    // Phase 2: First Wave (5-35s)
+        35.0f,   // Phase 3: Tank Squadron (35-55s)
+        55.0f,   // Phase 4: Swarm Attack (55-85s)
+        85.0f,   // Phase 5: Mixed Assault (85-120s)
+        120.0f,  // Phase 6: Elite Squadron (120-150s)
+        150.0f,  // Phase 7: Zigzag Chaos (150-180s)
+        180.0f,  // Phase 8: Shield Wall (180-220s)
+        220.0f,  // Phase 9: Bomber Run (220-260s)
+        260.0f,  // Phase 10: Ghost Ambush (260-300s)
+        300.0f,  // Phase 11: Combined Arms (300-345s)
+        345.0f,  // Phase 12: Mini-Boss (345-390s)
+        390.0f,  // Phase 13: Recovery (390-420s)
+        420.0f,  // Phase 14: Elite & Shield (420-460s)
+        460.0f,  // Phase 15: Evasive Maneuvers (460-500s)
+        500.0f,  // Phase 16: Heavy Assault (500-540s)
+        540.0f   // Phase 17: Final Wave (540-590s)
+    };
+
+    if (phase <= 0 || phase >= (int)(sizeof(phaseTimes) / sizeof(phaseTimes[0]))) {
+        return 0.0f;
+    }
+    return phaseTimes[phase];
+}
@@ -6,8 +6,8 @@
 #include <math.h>
 #include <stdio.h>
 
-void InitBullets(Bullet* bullets) {
-    for (int i = 0; i < MAX_BULLETS; i++) {
+void InitBullets(Bullet* bullets, int count) {
+    for (int i = 0; i < count; i++) {
         bullets[i].active = false;
         bullets[i].speed = BULLET_SPEED;
         bullets[i].damage = 1.0f;
@@ -23,7 +23,7 @@ void ShootBullet(Bullet* bullets, Vector2 position) {
 }
 
 // Fire bullets according to weapon mode with balanced damage
-void ShootBulletsForMode(Bullet* bullets, PlayerShip* playerShip) {
+void ShootBulletsForMode(Bullet* bullets, int count, PlayerShip* playerShip) {
     Vector2 position = playerShip->position;
     WeaponMode mode = playerShip->weaponMode;
     
@@ -78,7 +78,7 @@ void ShootBulletsForMode(Bullet* bullets, PlayerShip* playerShip) {
     
     // Fire the bullets
     int bulletsFired = 0;
-    for (int i = 0; i < MAX_BULLETS && bulletsFired < bulletCount; i++) {
+    for (int i = 0; i < count && bulletsFired < bulletCount; i++) {
         if (!bullets[i].active) {
             bullets[i].position = position;
             bullets[i].damage = damagePerBullet;
@@ -140,6 +140,7 @@ void ShootBulletsForMode(Bullet* bullets, PlayerShip* playerShip) {
                 bullets[i].position.y - 2,
                 10, 4
             };
+            bullets[i].previousPosition = bullets[i].position;
             bullets[i].active = true;
             bulletsFired++;
         }
@@ -182,8 +183,9 @@ static bool IsFireActionDown(Game* game) {
 
 void UpdateBullets(Game* game) {
     Bullet *bullets = game->bullets;
+    int bulletCapacity = game->capacity.bullets;
     PlayerShip *playerShip = game->playerShip;
-    float deltaTime = GetFrameTime();
+    float deltaTime = SIM_TICK_TIME;
     
     // Update weapon heat system only if enabled
     if (WEAPON_OVERHEATING) {
@@ -201,11 +203,10 @@ void UpdateBullets(Game* game) {
     // Fire continuously during devastating attack in offensive mode
     if (playerShip->energyMode == ENERGY_MODE_OFFENSIVE && playerShip->specialAbilityActive) {
         // Fire continuous spread of bullets during the 2 second duration
-        static float devastatingFireTimer = 0;
-        devastatingFireTimer -= deltaTime;
+        playerShip->devastatingFireTimer -= deltaTime;
         
-        if (devastatingFireTimer <= 0) {
-            devastatingFireTimer = 0.05f;  // Fire every 0.05 seconds
+        if (playerShip->devastatingFireTimer <= 0) {
+            playerShip->devastatingFireTimer = 0.05f;  // Fire every 0.05 seconds
             
             // Fire bullets in spread pattern
             int bulletsFired = 0;
@@ -222,7 +223,7 @@ void UpdateBullets(Game* game) {
             }
             
             for (int angle = -60; angle <= 60; angle += 20) {
-                for (int i = 0; i < MAX_BULLETS && bulletsFired < 7; i++) {
+                for (int i = 0; i < bulletCapacity && bulletsFired < 7; i++) {
                     if (!bullets[i].active) {
                         bullets[i].position = playerShip->position;
                         bullets[i].position.x += 25;
@@ -241,6 +242,7 @@ void UpdateBullets(Game* game) {
                         bullets[i].velocityY = 0.0f;
                         
                         bullets[i].bounds = (Rectangle){bullets[i].position.x - 5, bullets[i].position.y - 2, 10, 4};
+                        bullets[i].previousPosition = bullets[i].position;
                         bullets[i].active = true;
                         bulletsFired++;
                         break;
@@ -279,7 +281,7 @@ void UpdateBullets(Game* game) {
             float angleStep = totalSpreadAngle / (bulletCount - 1);
             float startAngle = -totalSpreadAngle / 2.0f;
             
-            for (int i = 0; i < MAX_BULLETS && bulletsFired < bulletCount; i++) {
+            for (int i = 0; i < bulletCapacity && bulletsFired < bulletCount; i++) {
                 if (!bullets[i].active) {
                     bullets[i].position = playerShip->position;
                     bullets[i].position.x += 25;
@@ -296,6 +298,7 @@ void UpdateBullets(Game* game) {
                     bullets[i].damage = 1.0f * powerMultiplier;  // Apply power multiplier
                     bullets[i].powerLevel = powerLevel;
                     bullets[i].bounds = (Rectangle){bullets[i].position.x - 5, bullets[i].position.y - 2, 10, 4};
+                    bullets[i].previousPosition = bullets[i].position;
                     bullets[i].active = true;
                     bulletsFired++;
                 }
@@ -310,8 +313,7 @@ void UpdateBullets(Game* game) {
         }
     } else {
         // Normal firing modes
-        static float shootTimer = 0;
-        shootTimer -= deltaTime;
+        playerShip->shootTimer -= deltaTime;
         
         // Fire rate depends on weapon mode
         float fireRate = WEAPON_FIRE_RATE;
@@ -323,13 +325,13 @@ void UpdateBullets(Game* game) {
         bool canFire = !(playerShip->energyMode == ENERGY_MODE_DEFENSIVE && playerShip->specialAbilityActive);
         
         if (IsFireActionDown(game) && 
-            (!WEAPON_OVERHEATING || !playerShip->overheated) && shootTimer <= 0 && canFire) {
+            (!WEAPON_OVERHEATING || !playerShip->overheated) && playerShip->shootTimer <= 0 && canFire) {
             // Use new weapon mode system
-            ShootBulletsForMode(bullets, playerShip);
-            shootTimer = fireRate;
+            ShootBulletsForMode(bullets, bulletCapacity, playerShip);
+            playerShip->shootTimer = fireRate;
             
             // Offensive mode with full energy: more damage (handled in collision system)
-            // The damage multiplier is applied in CheckBulletEnemyCollisions
+            // The damage multiplier is applied when bullet hits are resolved (collision.c)
             
             // Only manage heat if overheating is enabled
             if (WEAPON_OVERHEATING) {
@@ -349,7 +351,7 @@ void UpdateBullets(Game* game) {
     }
     
     // Update bullets
-    for (int i = 0; i < MAX_BULLETS; i++) {
+    for (int i = 0; i < bulletCapacity; i++) {
         if (bullets[i].active) {
             bullets[i].position.x += bullets[i].speed;
             bullets[i].position.y += bullets[i].velocityY;
@@ -367,8 +369,8 @@ void UpdateBullets(Game* game) {
     }
 }
 
-void DrawBullets(const Bullet* bullets) {
-    for (int i = 0; i < MAX_BULLETS; i++) {
+void DrawBullets(const Bullet* bullets, int count) {
+    for (int i = 0; i < count; i++) {
         if (bullets[i].active) {
             float x = bullets[i].position.x;
             float y = bullets[i].position.y;
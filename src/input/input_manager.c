@@ -10,6 +10,9 @@ void InputManager_Init(InputManager* manager, InputConfig* config) {
     manager->gamepadId = 0;  // Use first gamepad
     manager->gamepadAvailable = false;
     manager->activeInputMethod = INPUT_METHOD_KEYBOARD;  // Default to keyboard
+    manager->tickActive = false;
+    manager->tickState = 0;
+    manager->previousTickState = 0;
 }
 
 // Update input manager state (call each frame)
@@ -98,6 +101,11 @@ static bool IsBindingReleased(const InputBinding* binding, int gamepadId, bool g
 bool InputManager_IsActionPressed(const InputManager* manager, GameAction action) {
     if (action >= ACTION_COUNT) return false;
     
+    if (manager->tickActive) {
+        unsigned int bit = 1u << action;
+        return (manager->tickState & bit) && !(manager->previousTickState & bit);
+    }
+    
     // Check all bindings (up to 4 per action)
     for (int i = 0; i < MAX_BINDINGS_PER_ACTION; i++) {
         const InputBinding* binding = &manager->config->bindings[action][i];
@@ -141,6 +149,10 @@ bool InputManager_IsActionPressed(const InputManager* manager, GameAction action
 bool InputManager_IsActionDown(const InputManager* manager, GameAction action) {
     if (action >= ACTION_COUNT) return false;
     
+    if (manager->tickActive) {
+        return (manager->tickState & (1u << action)) != 0;
+    }
+    
     // Check all bindings (up to 4 per action)
     for (int i = 0; i < MAX_BINDINGS_PER_ACTION; i++) {
         const InputBinding* binding = &manager->config->bindings[action][i];
@@ -240,6 +252,11 @@ bool InputManager_IsActionDown(const InputManager* manager, GameAction action) {
 bool InputManager_IsActionReleased(const InputManager* manager, GameAction action) {
     if (action >= ACTION_COUNT) return false;
     
+    if (manager->tickActive) {
+        unsigned int bit = 1u << action;
+        return !(manager->tickState & bit) && (manager->previousTickState & bit);
+    }
+    
     // Check all bindings (up to 4 per action)
     for (int i = 0; i < MAX_BINDINGS_PER_ACTION; i++) {
         const InputBinding* binding = &manager->config->bindings[action][i];
@@ -263,6 +280,46 @@ bool InputManager_IsActionReleased(const InputManager* manager, GameAction actio
     return false;
 }
 
+// Weapon hotkey pressed (1-6), 0 if none
+int InputManager_GetWeaponHotkey(const InputManager* manager) {
+    if (manager->tickActive) {
+        return (int)((manager->tickState & INPUT_TICK_HOTKEY_MASK) >> INPUT_TICK_HOTKEY_SHIFT);
+    }
+    
+    static const int hotkeys[] = { KEY_ONE, KEY_TWO, KEY_THREE, KEY_FOUR, KEY_FIVE, KEY_SIX };
+    for (int i = 0; i < 6; i++) {
+        if (IsKeyPressed(hotkeys[i])) {
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+// Read the devices into a tick state (call outside a tick)
+InputTickState InputManager_SampleTick(const InputManager* manager) {
+    InputTickState state = 0;
+    
+    for (int action = 0; action < ACTION_COUNT; action++) {
+        if (InputManager_IsActionDown(manager, (GameAction)action)) {
+            state |= 1u << action;
+        }
+    }
+    state |= (unsigned int)InputManager_GetWeaponHotkey(manager) << INPUT_TICK_HOTKEY_SHIFT;
+    
+    return state;
+}
+
+// Answer the IsAction* queries from a tick state until InputManager_EndTick
+void InputManager_BeginTick(InputManager* manager, InputTickState state, InputTickState previous) {
+    manager->tickActive = true;
+    manager->tickState = state;
+    manager->previousTickState = previous;
+}
+
+void InputManager_EndTick(InputManager* manager) {
+    manager->tickActive = false;
+}
+
 // Detect any input and return the binding (for rebinding controls)
 // Note: Mouse support has been removed - only keyboard and gamepad
 // ESC and B button ARE bindable (cancel is handled before this function in menu.c)
@@ -6,336 +6,654 @@
 #include "explosion.h"
 #include "powerup.h"
 #include "utils.h"
+#include "run_telemetry.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <math.h>
 
-void CheckBulletEnemyCollisions(Game* game) {
-    // Use generic collision system
-    CollisionContext ctx = {
-        .bullets = game->bullets,
-        .maxBullets = MAX_BULLETS,
-        .enemies = game->enemies,
-        .maxEnemies = MAX_ENEMIES,
-        .explosionSystem = game->explosionSystem,
-        .score = &game->score,
-        .enemiesKilled = NULL,  // Game doesn't track this separately
-        .logContext = game,
-        .onEnemyHit = NULL,
-        .onEnemyDestroyed = NULL
-    };
+#define PLAYER_HIT_RADIUS 25.0f     // Approximate player ship radius for projectile hits
+#define SWEEP_SAMPLE_SPACING 2.0f   // Largest step between shape tests along a swept path
+
+void Collision_InitEventQueue(CollisionEventQueue* queue) {
+    queue->events = NULL;
+    queue->count = 0;
+    queue->capacity = 0;
+}
+
+void Collision_CleanupEventQueue(CollisionEventQueue* queue) {
+    free(queue->events);
+    Collision_InitEventQueue(queue);
+}
+
+static void PushEvent(CollisionEventQueue* queue, CollisionEventType type, int a, int b) {
+    if (queue->count == queue->capacity) {
+        int capacity = queue->capacity > 0 ? queue->capacity * 2 : 256;
+        CollisionEvent* events = (CollisionEvent*)realloc(queue->events, capacity * sizeof(CollisionEvent));
+        if (!events) {
+            fprintf(stderr, "Warning: Out of memory for collision events, contact ignored\n");
+            return;
+        }
+        queue->events = events;
+        queue->capacity = capacity;
+    }
     
-    // Pass player ship for damage calculation
-    Collision_CheckBulletEnemyGeneric(&ctx);
+    CollisionEvent* event = &queue->events[queue->count++];
+    event->type = (unsigned short)type;
+    event->a = (unsigned short)a;
+    event->b = (unsigned short)b;
 }
 
-void Collision_CheckBulletEnemyGeneric(CollisionContext* ctx) {
-    for (int b = 0; b < ctx->maxBullets; b++) {
-        if (ctx->bullets[b].active) {
-            for (int e = 0; e < ctx->maxEnemies; e++) {
-                if (ctx->enemies[e].active) {
-                    // Skip ghost enemies when they're not visible
-                    if (ctx->enemies[e].type == ENEMY_GHOST && !ctx->enemies[e].isVisible) {
-                        continue;
-                    }
-                    
-                    if (CheckCollisionRecs(ctx->bullets[b].bounds, ctx->enemies[e].bounds)) {
-                        // Calculate damage with resistance
-                        float baseDamage = ctx->bullets[b].damage;  // Use bullet's damage value
-                        
-                        // Offensive mode with FULL energy: double damage bonus
-                        if (ctx->logContext) {
-                            Game* game = (Game*)ctx->logContext;
-                            if (game->playerShip->energyMode == ENERGY_MODE_OFFENSIVE && 
-                                game->playerShip->energyFull) {
-                                baseDamage *= 2.0f;  // 2x damage bonus only when energy is FULL
-                            }
-                        }
-                        
-                        float effectiveDamage = baseDamage * (1.0f - ctx->enemies[e].resistance);
-                        int damageDealt = (int)fmaxf(1.0f, effectiveDamage);  // At least 1 damage
-                        
-                        // Deactivate bullet
-                        ctx->bullets[b].active = false;
-                        
-                        // Boss shield handling (if applicable)
-                        if (ctx->enemies[e].type == ENEMY_BOSS && ctx->enemies[e].shieldAngle > 0) {
-                            ctx->enemies[e].shieldAngle -= damageDealt;
-                            ctx->enemies[e].specialTimer = 0;  // Reset shield regen timer
-                            
-                            if (ctx->enemies[e].shieldAngle <= 0) {
-                                ctx->enemies[e].shieldAngle = 0;
-                                // Log if logging is enabled
-                                if (ctx->logContext) {
-                                    Game* game = (Game*)ctx->logContext;
-                                    LogEvent(game, "[%.2f] Boss shield BROKEN!", game->gameTime);
-                                }
-                            }
-                        } else {
-                            // Apply damage to health
-                            ctx->enemies[e].health -= damageDealt;
-                        }
-                        
-                        ctx->enemies[e].hitsTaken++;
-                        
-                        // Call hit callback if provided
-                        if (ctx->onEnemyHit) {
-                            ctx->onEnemyHit(ctx->logContext, &ctx->enemies[e], damageDealt);
-                        }
-                        
-                        // Log hit if logging is enabled
-                        if (ctx->logContext) {
-                            Game* game = (Game*)ctx->logContext;
-                            LogEvent(game, "[%.2f] Enemy hit - Type:%s ID:%d Health:%d/%d Hits:%d Damage:%d",
-                                    game->gameTime, GetEnemyTypeName(ctx->enemies[e].type),
-                                    ctx->enemies[e].id, ctx->enemies[e].health, ctx->enemies[e].maxHealth,
-                                    ctx->enemies[e].hitsTaken, damageDealt);
-                        }
-                        
-                        // Check if enemy is destroyed
-                        if (ctx->enemies[e].health <= 0) {
-                            // Create explosion if system is provided
-                            if (ctx->explosionSystem) {
-                                Color enemyColor = GetEnemyTypeColor(ctx->enemies[e].type);
-                                float enemySize = ctx->enemies[e].bounds.width;
-                                CreateEnemyExplosion(ctx->explosionSystem, ctx->enemies[e].position, 
-                                                   enemyColor, enemySize);
-                            }
-                            
-                            // Drop powerup from defeated enemy
-                            if (ctx->logContext) {
-                                Game* game = (Game*)ctx->logContext;
-                                if (game->powerupSystem) {
-                                    DropPowerupFromEnemy(game->powerupSystem, &ctx->enemies[e]);
-                                }
-                            }
-                            
-                            // Add score if score pointer is provided
-                            if (ctx->score) {
-                                *ctx->score += ctx->enemies[e].power * 2;
-                            }
-                            
-                            // Track kills if counter is provided
-                            if (ctx->enemiesKilled) {
-                                (*ctx->enemiesKilled)++;
-                            }
-                            
-                            // Deactivate enemy
-                            ctx->enemies[e].active = false;
-                            
-                            // Call destroyed callback if provided
-                            if (ctx->onEnemyDestroyed) {
-                                ctx->onEnemyDestroyed(ctx->logContext, &ctx->enemies[e]);
-                            }
-                          
-                            // Log destruction if logging is enabled
-                            if (ctx->logContext) {
-                                Game* game = (Game*)ctx->logContext;
-                                
-                                // Clear boss tracking if this was the boss
-                                if (ctx->enemies[e].type == ENEMY_BOSS && game->bossEnemyIndex == e) {
-                                    game->bossEnemyIndex = -1;
-                                    LogEvent(game, "[%.2f] BOSS DEFEATED!", game->gameTime);
-                                }
-                                
-                                LogEvent(game, "[%.2f] Enemy DESTROYED - Type:%s ID:%d TotalHits:%d Score:+%d",
-                                        game->gameTime, GetEnemyTypeName(ctx->enemies[e].type),
-                                        ctx->enemies[e].id, ctx->enemies[e].hitsTaken, 
-                                        ctx->enemies[e].power * 2);
-                            }
-                        }
-                    }
-                }
-            }
+// Ghost enemies can only be hit while visible
+static inline bool IsEnemyHittable(const EnemyEx* enemy) {
+    return enemy->active && (enemy->type != ENEMY_GHOST || enemy->isVisible);
+}
+
+// ---------------------------------------------------------------------------
+// Narrowphase: enemy shapes, after the bounding boxes overlap
+// ---------------------------------------------------------------------------
+
+// Enemies are drawn as circles of their radius (DrawEnemyEx), so that is their hit shape. The
+// sprite sheet masks (collision_mask.h) would only match once enemies are drawn from the sheet.
+
+// Does a box touch the enemy's circle?
+static bool BoxHitsEnemy(Rectangle box, const EnemyEx* enemy, Vector2 enemyPosition) {
+    return CheckCollisionCircleRec(enemyPosition, enemy->radius, box);
+}
+
+// Does a circle touch the enemy's circle?
+static bool CircleHitsEnemy(Vector2 center, float radius, const EnemyEx* enemy, Vector2 enemyPosition) {
+    float dx = center.x - enemyPosition.x;
+    float dy = center.y - enemyPosition.y;
+    float reach = radius + enemy->radius;
+    return dx * dx + dy * dy < reach * reach;
+}
+
+static inline Rectangle CircleBounds(Vector2 center, float radius) {
+    return (Rectangle){ center.x - radius, center.y - radius, radius * 2, radius * 2 };
+}
+
+// ---------------------------------------------------------------------------
+// Swept tests: where along the tick's motion two objects first touch
+// ---------------------------------------------------------------------------
+
+// Time (0..1) at which a box moving by motion starts to overlap a fixed box, -1 if it never does
+// (exitTime: when it stops overlapping, at most 1)
+static float SweepRecs(Rectangle moving, Vector2 motion, Rectangle target, float* exitTime) {
+    float enter = 0.0f;
+    float exit = 1.0f;
+    float from[2] = { moving.x, moving.y };
+    float delta[2] = { motion.x, motion.y };
+    float low[2] = { target.x - moving.width, target.y - moving.height };
+    float high[2] = { target.x + target.width, target.y + target.height };
+    
+    // Per axis, the moving corner has to be strictly inside (low, high), as in CheckCollisionRecs
+    for (int axis = 0; axis < 2; axis++) {
+        if (delta[axis] == 0.0f) {
+            if (from[axis] <= low[axis] || from[axis] >= high[axis]) return -1.0f;
+            continue;
         }
+        
+        float t1 = (low[axis] - from[axis]) / delta[axis];
+        float t2 = (high[axis] - from[axis]) / delta[axis];
+        if (t1 > t2) {
+            float swap = t1;
+            t1 = t2;
+            t2 = swap;
+        }
+        if (t1 > enter) enter = t1;
+        if (t2 < exit) exit = t2;
+    }
+    
+    *exitTime = exit;
+    return enter < exit && enter < 1.0f ? enter : -1.0f;
+}
+
+// Time (0..1) at which a point moving from start by motion comes within radius of the origin, -1 if it never does
+static float SweepCircle(Vector2 start, Vector2 motion, float radius) {
+    float c = start.x * start.x + start.y * start.y - radius * radius;
+    if (c < 0.0f) return 0.0f;
+    
+    float a = motion.x * motion.x + motion.y * motion.y;
+    float b = start.x * motion.x + start.y * motion.y;
+    float discriminant = b * b - a * c;
+    if (a == 0.0f || b >= 0.0f || discriminant <= 0.0f) return -1.0f;
+    
+    float t = (-b - sqrtf(discriminant)) / a;
+    return t < 1.0f ? t : -1.0f;
+}
+
+static inline Vector2 Displacement(Vector2 from, Vector2 to) {
+    return (Vector2){ to.x - from.x, to.y - from.y };
+}
+
+// Narrowphase samples for the part [enter, exit] of a swept path (at most SWEEP_SAMPLE_SPACING apart)
+static int SweepSampleCount(Vector2 motion, float enter, float exit) {
+    float length = sqrtf(motion.x * motion.x + motion.y * motion.y) * (exit - enter);
+    int samples = (int)ceilf(length / SWEEP_SAMPLE_SPACING);
+    return samples > 0 ? samples : 1;
+}
+
+// First contact of a box with an enemy during the tick, both moving from their previous positions
+// (box: where the box is at the end of the tick, boxMotion: how far it moved)
+static float SweepBoxEnemy(Rectangle box, Vector2 boxMotion, const EnemyEx* enemy) {
+    Vector2 enemyMotion = Displacement(enemy->previousPosition, enemy->position);
+    
+    // Seen from the enemy: the box starts where both were and moves by the difference
+    Rectangle start = box;
+    start.x -= boxMotion.x;
+    start.y -= boxMotion.y;
+    Rectangle target = enemy->bounds;
+    target.x -= enemyMotion.x;
+    target.y -= enemyMotion.y;
+    Vector2 motion = { boxMotion.x - enemyMotion.x, boxMotion.y - enemyMotion.y };
+    if (motion.x == 0.0f && motion.y == 0.0f) return -1.0f;
+    
+    float exit;
+    float enter = SweepRecs(start, motion, target, &exit);
+    if (enter < 0.0f) return -1.0f;
+    
+    // Shape test at the middle of each step through the enemy's box
+    int samples = SweepSampleCount(motion, enter, exit);
+    for (int k = 0; k < samples; k++) {
+        float t = enter + (exit - enter) * (k + 0.5f) / samples;
+        Rectangle sample = { start.x + motion.x * t, start.y + motion.y * t, start.width, start.height };
+        if (BoxHitsEnemy(sample, enemy, enemy->previousPosition)) return t;
     }
+    return -1.0f;
 }
 
-void CheckPlayerEnemyCollisions(Game* game) {
-    for (int e = 0; e < MAX_ENEMIES; e++) {
-        if (game->enemies[e].active) {
-            // Skip ghost enemies when they're not visible
-            if (game->enemies[e].type == ENEMY_GHOST && !game->enemies[e].isVisible) {
-                continue;
+// First contact of a circle with an enemy during the tick, both moving from their previous positions
+static float SweepCircleEnemy(Vector2 previous, Vector2 position, float radius, const EnemyEx* enemy) {
+    Vector2 circleMotion = Displacement(previous, position);
+    Vector2 enemyMotion = Displacement(enemy->previousPosition, enemy->position);
+    Vector2 motion = { circleMotion.x - enemyMotion.x, circleMotion.y - enemyMotion.y };
+    if (motion.x == 0.0f && motion.y == 0.0f) return -1.0f;
+    
+    Rectangle target = enemy->bounds;
+    target.x -= enemyMotion.x;
+    target.y -= enemyMotion.y;
+    float exit;
+    float enter = SweepRecs(CircleBounds(previous, radius), motion, target, &exit);
+    if (enter < 0.0f) return -1.0f;
+    
+    int samples = SweepSampleCount(motion, enter, exit);
+    for (int k = 0; k < samples; k++) {
+        float t = enter + (exit - enter) * (k + 0.5f) / samples;
+        Vector2 sample = { previous.x + motion.x * t, previous.y + motion.y * t };
+        if (CircleHitsEnemy(sample, radius, enemy, enemy->previousPosition)) return t;
+    }
+    return -1.0f;
+}
+
+// First contact of two circles during the tick, both moving from their previous positions
+static float SweepCircles(Vector2 previousA, Vector2 positionA, Vector2 previousB, Vector2 positionB, float reach) {
+    Vector2 start = Displacement(previousB, previousA);
+    Vector2 end = Displacement(positionB, positionA);
+    return SweepCircle(start, Displacement(start, end), reach);
+}
+
+// ---------------------------------------------------------------------------
+// Detection: read-only scans that only append events
+// ---------------------------------------------------------------------------
+
+static void DetectBulletEnemy(const Bullet* bullets, int maxBullets, const EnemyEx* enemies, int maxEnemies,
+                              bool swept, CollisionEventQueue* queue) {
+    for (int b = 0; b < maxBullets; b++) {
+        if (!bullets[b].active) continue;
+        
+        Rectangle bounds = bullets[b].bounds;
+        bool hit = false;
+        for (int e = 0; e < maxEnemies; e++) {
+            if (IsEnemyHittable(&enemies[e]) && CheckCollisionRecs(bounds, enemies[e].bounds) &&
+                BoxHitsEnemy(bounds, &enemies[e], enemies[e].position)) {
+                PushEvent(queue, COLLISION_BULLET_ENEMY, b, e);
+                hit = true;
             }
+        }
+        if (hit || !swept) continue;
+        
+        // Nothing overlaps now: the bullet hits the first enemy it passed through, if any
+        Vector2 motion = Displacement(bullets[b].previousPosition, bullets[b].position);
+        int first = -1;
+        float firstTime = 1.0f;
+        for (int e = 0; e < maxEnemies; e++) {
+            if (!IsEnemyHittable(&enemies[e])) continue;
             
-            if (CheckCollisionRecs(game->playerShip->bounds, game->enemies[e].bounds)) {
-                LogCollision(game, "Enemy", game->enemies[e].id, 
-                           game->playerShip->bounds, game->enemies[e].bounds);
-                
-                snprintf(game->deathCause, sizeof(game->deathCause), 
-                        "Collision with %s Enemy #%d at position (%.0f, %.0f)", 
-                        GetEnemyTypeName(game->enemies[e].type),
-                        game->enemies[e].id, 
-                        game->enemies[e].position.x, 
-                        game->enemies[e].position.y);
-                
-                // Apply damage only if not invulnerable (ability system removed)
-                if (!DEBUG_INVULNERABILITY) {
-                    // Damage based on enemy power
-                    int damage = (game->enemies[e].power / 20) + 1;  // 1-3 damage based on power
-                    DamagePlayerShip(game->playerShip, damage * 10);  // Scale up damage
-                }
-                
-                // Destroy enemy on collision (except bosses)
-                if (game->enemies[e].type != ENEMY_BOSS) {
-                    // Create explosion for destroyed enemy
-                    Color enemyColor = GetEnemyTypeColor(game->enemies[e].type);
-                    float enemySize = game->enemies[e].bounds.width;
-                    CreateEnemyExplosion(game->explosionSystem, game->enemies[e].position, enemyColor, enemySize);
-                    
-                    // Drop powerup from defeated enemy
-                    if (game->powerupSystem) {
-                        DropPowerupFromEnemy(game->powerupSystem, &game->enemies[e]);
-                    }
-                    
-                    game->enemies[e].active = false;
-                } else {
-                    // Boss takes damage from collision
-                    game->enemies[e].health -= 2;
-                    if (game->enemies[e].health <= 0) {
-                        // Large explosion for boss
-                        CreateExplosion(game->explosionSystem, game->enemies[e].position, EXPLOSION_LARGE);
-                        
-                        // Drop powerup from defeated boss
-                        if (game->powerupSystem) {
-                            DropPowerupFromEnemy(game->powerupSystem, &game->enemies[e]);
-                        }
-                        
-                        game->enemies[e].active = false;
-                        game->score += game->enemies[e].power * 10;  // Big score for boss
-                    }
-                }
+            float t = SweepBoxEnemy(bounds, motion, &enemies[e]);
+            if (t >= 0.0f && t < firstTime) {
+                first = e;
+                firstTime = t;
             }
         }
+        if (first >= 0) {
+            PushEvent(queue, COLLISION_BULLET_ENEMY, b, first);
+        }
     }
 }
 
-
-void CheckProjectilePlayerCollision(Game* game) {
-    Projectile* projectiles = (Projectile*)game->projectiles;
-    for (int i = 0; i < MAX_PROJECTILES; i++) {
-        if (projectiles[i].active && !projectiles[i].isPlayerProjectile) {
-            const ProjectileDefinition* def = GetProjectileDefinition(projectiles[i].type);
+static void DetectProjectileEnemy(const Projectile* projectiles, int maxProjectiles,
+                                  const EnemyEx* enemies, int maxEnemies, bool swept, CollisionEventQueue* queue) {
+    for (int i = 0; i < maxProjectiles; i++) {
+        if (!projectiles[i].active || !projectiles[i].isPlayerProjectile) continue;
+        
+        Vector2 position = projectiles[i].position;
+        const ProjectileDefinition* def = GetProjectileDefinition(projectiles[i].type);
+        float hitboxRadius = def->hitboxRadius;
+        Rectangle bounds = CircleBounds(position, hitboxRadius);
+        bool hit = false;
+        for (int e = 0; e < maxEnemies; e++) {
+            if (!IsEnemyHittable(&enemies[e])) continue;
             
-            // Check collision with player using circular collision
-            float dx = projectiles[i].position.x - game->playerShip->position.x;
-            float dy = projectiles[i].position.y - game->playerShip->position.y;
-            float distance = sqrtf(dx * dx + dy * dy);
-            float playerRadius = 25.0f;  // Approximate player ship radius
+            // Every overlap is recorded: a non-piercing projectile is spent by the
+            // first one whose enemy is still alive when resolved
+            if (CheckCollisionRecs(bounds, enemies[e].bounds) &&
+                CircleHitsEnemy(position, hitboxRadius, &enemies[e], enemies[e].position)) {
+                PushEvent(queue, COLLISION_PROJECTILE_ENEMY, i, e);
+                hit = true;
+            }
+        }
+        if (hit || !swept) continue;
+        
+        // Nothing overlaps now: a piercing projectile hits every enemy it passed through,
+        // any other one the first of them
+        int first = -1;
+        float firstTime = 1.0f;
+        for (int e = 0; e < maxEnemies; e++) {
+            if (!IsEnemyHittable(&enemies[e])) continue;
             
-            if (distance < (def->hitboxRadius + playerRadius)) {
-                // Apply damage only if not invulnerable (ability system removed)
-                if (!DEBUG_INVULNERABILITY) {
-                    // Hit the player
-                    int damage = fmaxf(1, def->damage / 2);  // Scale damage
-                    DamagePlayerShip(game->playerShip, damage);
-                }
-                
-                snprintf(game->deathCause, sizeof(game->deathCause), 
-                        "Hit by %s projectile from Enemy #%d", 
-                        def->name, projectiles[i].enemyId);
-                
-                LogEvent(game, "[%.2f] Player hit by %s - Damage:%d Health:%d",
-                        game->gameTime, def->name, def->damage / 10, game->playerShip->health);
-                
-                // Destroy projectile unless it's piercing
-                if (!def->piercing) {
-                    projectiles[i].active = false;
-                }
-                
-                // Handle explosion
-                if (def->explosive && def->explosionRadius > 0) {
-                    // Create plasma/energy explosion for explosive projectiles
-                    CreateExplosion(game->explosionSystem, projectiles[i].position, EXPLOSION_PLASMA);
-                }
+            float t = SweepCircleEnemy(projectiles[i].previousPosition, position, hitboxRadius, &enemies[e]);
+            if (t < 0.0f) continue;
+            
+            if (def->piercing) {
+                PushEvent(queue, COLLISION_PROJECTILE_ENEMY, i, e);
+            } else if (t < firstTime) {
+                first = e;
+                firstTime = t;
             }
         }
+        if (first >= 0) {
+            PushEvent(queue, COLLISION_PROJECTILE_ENEMY, i, first);
+        }
     }
 }
 
-void CheckProjectileEnemyCollision(Game* game) {
-    Projectile* projectiles = (Projectile*)game->projectiles;
-    for (int i = 0; i < MAX_PROJECTILES; i++) {
-        if (projectiles[i].active && projectiles[i].isPlayerProjectile) {
-            const ProjectileDefinition* def = GetProjectileDefinition(projectiles[i].type);
+static void DetectProjectilePlayer(const Projectile* projectiles, int maxProjectiles,
+                                   const PlayerShip* player, bool swept, CollisionEventQueue* queue) {
+    for (int i = 0; i < maxProjectiles; i++) {
+        if (!projectiles[i].active || projectiles[i].isPlayerProjectile) continue;
+        
+        float dx = projectiles[i].position.x - player->position.x;
+        float dy = projectiles[i].position.y - player->position.y;
+        float reach = GetProjectileDefinition(projectiles[i].type)->hitboxRadius + PLAYER_HIT_RADIUS;
+        if (dx * dx + dy * dy < reach * reach ||
+            (swept && SweepCircles(projectiles[i].previousPosition, projectiles[i].position,
+                                   player->previousPosition, player->position, reach) >= 0.0f)) {
+            PushEvent(queue, COLLISION_PROJECTILE_PLAYER, i, 0);
+        }
+    }
+}
+
+static void DetectPlayerEnemy(const PlayerShip* player, const EnemyEx* enemies, int maxEnemies,
+                              CollisionEventQueue* queue) {
+    for (int e = 0; e < maxEnemies; e++) {
+        if (IsEnemyHittable(&enemies[e]) && CheckCollisionRecs(player->bounds, enemies[e].bounds) &&
+            BoxHitsEnemy(player->bounds, &enemies[e], enemies[e].position)) {
+            PushEvent(queue, COLLISION_PLAYER_ENEMY, 0, e);
+        }
+    }
+}
+
+static void DetectPlayerPowerups(const PlayerShip* player, const PowerupSystem* system, CollisionEventQueue* queue) {
+    if (!player->isVisible) return;
+    
+    for (int i = 0; i < system->capacity; i++) {
+        if (system->powerups[i].active && CheckCollisionRecs(player->bounds, system->powerups[i].bounds)) {
+            PushEvent(queue, COLLISION_PLAYER_POWERUP, i, 0);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Resolution: side effects, applied in detection order
+// ---------------------------------------------------------------------------
+
+static void ResolveBulletHit(CollisionContext* ctx, int b, int e) {
+    Bullet* bullet = &ctx->bullets[b];
+    EnemyEx* enemy = &ctx->enemies[e];
+    if (!enemy->active) return;  // Destroyed by an earlier event
+    
+    // The bullet is not checked: one overlapping two enemies hits both, as it always has
+    
+    // Calculate damage with resistance
+    float baseDamage = bullet->damage;  // Use bullet's damage value
+    
+    // Offensive mode with FULL energy: double damage bonus
+    Game* game = (Game*)ctx->logContext;
+    if (game && game->playerShip->energyMode == ENERGY_MODE_OFFENSIVE && game->playerShip->energyFull) {
+        baseDamage *= 2.0f;  // 2x damage bonus only when energy is FULL
+    }
+    
+    float effectiveDamage = baseDamage * (1.0f - enemy->resistance);
+    int damageDealt = (int)fmaxf(1.0f, effectiveDamage);  // At least 1 damage
+    
+    // Deactivate bullet
+    bullet->active = false;
+    
+    // Boss shield handling (if applicable)
+    if (enemy->type == ENEMY_BOSS && enemy->shieldAngle > 0) {
+        enemy->shieldAngle -= damageDealt;
+        enemy->specialTimer = 0;  // Reset shield regen timer
+        
+        if (enemy->shieldAngle <= 0) {
+            enemy->shieldAngle = 0;
+            if (game) {
+                LogEvent(game, "[%.2f] Boss shield BROKEN!", game->gameTime);
+            }
+        }
+    } else {
+        // Apply damage to health
+        enemy->health -= damageDealt;
+    }
+    
+    enemy->hitsTaken++;
+    
+    // Call hit callback if provided
+    if (ctx->onEnemyHit) {
+        ctx->onEnemyHit(ctx->logContext, enemy, damageDealt);
+    }
+    
+    if (game) {
+        LogEvent(game, "[%.2f] Enemy hit - Type:%s ID:%d Health:%d/%d Hits:%d Damage:%d",
+                game->gameTime, GetEnemyTypeName(enemy->type),
+                enemy->id, enemy->health, enemy->maxHealth,
+                enemy->hitsTaken, damageDealt);
+    }
+    
+    if (enemy->health > 0) return;
+    
+    // Enemy destroyed: create explosion if system is provided
+    if (ctx->explosionSystem) {
+        CreateEnemyExplosion(ctx->explosionSystem, enemy->position,
+                           GetEnemyTypeColor(enemy->type), enemy->bounds.width);
+    }
+    
+    // Drop powerup from defeated enemy
+    if (game && game->powerupSystem) {
+        DropPowerupFromEnemy(game->powerupSystem, enemy);
+    }
+    
+    // Add score if score pointer is provided
+    if (ctx->score) {
+        *ctx->score += enemy->power * 2;
+    }
+    
+    // Track kills if counter is provided
+    if (ctx->enemiesKilled) {
+        (*ctx->enemiesKilled)++;
+    }
+    
+    // Deactivate enemy
+    enemy->active = false;
+    
+    // Call destroyed callback if provided
+    if (ctx->onEnemyDestroyed) {
+        ctx->onEnemyDestroyed(ctx->logContext, enemy);
+    }
+    
+    if (game) {
+        // Clear boss tracking if this was the boss
+        if (enemy->type == ENEMY_BOSS && game->bossEnemyIndex == e) {
+            game->bossEnemyIndex = -1;
+            LogEvent(game, "[%.2f] BOSS DEFEATED!", game->gameTime);
+        }
+        
+        LogEvent(game, "[%.2f] Enemy DESTROYED - Type:%s ID:%d TotalHits:%d Score:+%d",
+                game->gameTime, GetEnemyTypeName(enemy->type),
+                enemy->id, enemy->hitsTaken, enemy->power * 2);
+    }
+}
+
+static void ResolveProjectileEnemyHit(Game* game, int i, int e) {
+    Projectile* projectile = &((Projectile*)game->projectiles)[i];
+    EnemyEx* enemy = &game->enemies[e];
+    if (!projectile->active || !enemy->active) return;  // Spent or destroyed by an earlier event
+    
+    const ProjectileDefinition* def = GetProjectileDefinition(projectile->type);
+    
+    // Apply damage with resistance - always at least 1 damage
+    float baseDamage = (float)def->damage;
+    float effectiveDamage = baseDamage * (1.0f - enemy->resistance);
+    int damageDealt = (int)fmaxf(1.0f, effectiveDamage);  // Always deal at least 1 damage
+    
+    // Boss shield handling
+    if (enemy->type == ENEMY_BOSS && enemy->shieldAngle > 0) {
+        enemy->shieldAngle -= damageDealt;
+        enemy->specialTimer = 0;  // Reset shield regen timer
+        if (enemy->shieldAngle <= 0) {
+            enemy->shieldAngle = 0;
+            LogEvent(game, "[%.2f] Boss shield BROKEN!", game->gameTime);
+        }
+    } else {
+        enemy->health -= damageDealt;
+    }
+    enemy->hitsTaken++;
+    RunTelemetry_RecordHit(game->telemetry, enemy->type, damageDealt);
+    
+    LogEvent(game, "[%.2f] Enemy hit by %s - Type:%s ID:%d Health:%d/%d Hits:%d Damage:%d",
+            game->gameTime, def->name, GetEnemyTypeName(enemy->type),
+            enemy->id, enemy->health, enemy->maxHealth,
+            enemy->hitsTaken, damageDealt);
+    
+    if (enemy->health <= 0) {
+        // Create explosion effect based on enemy type
+        CreateEnemyExplosion(game->explosionSystem, enemy->position,
+                           GetEnemyTypeColor(enemy->type), enemy->bounds.width);
+        
+        // Drop powerup from defeated enemy
+        if (game->powerupSystem) {
+            DropPowerupFromEnemy(game->powerupSystem, enemy);
+        }
+        
+        enemy->active = false;
+        game->score += enemy->power * 2;
+        RunTelemetry_RecordKill(game->telemetry, enemy->type);
+        
+        // Clear boss tracking if this was the boss
+        if (enemy->type == ENEMY_BOSS && game->bossEnemyIndex == e) {
+            game->bossEnemyIndex = -1;
+            LogEvent(game, "[%.2f] BOSS DEFEATED!", game->gameTime);
+        }
+        
+        LogEvent(game, "[%.2f] Enemy DESTROYED by %s - Type:%s ID:%d TotalHits:%d Score:+%d",
+                game->gameTime, def->name, GetEnemyTypeName(enemy->type),
+                enemy->id, enemy->hitsTaken, enemy->power * 2);
+    }
+    
+    // Destroy projectile unless piercing (its later events are skipped)
+    if (!def->piercing) {
+        projectile->active = false;
+    }
+}
+
+static void ResolveProjectilePlayerHit(Game* game, int i) {
+    Projectile* projectile = &((Projectile*)game->projectiles)[i];
+    if (!projectile->active) return;
+    
+    const ProjectileDefinition* def = GetProjectileDefinition(projectile->type);
+    
+    // Apply damage only if not invulnerable (ability system removed)
+    if (!DEBUG_INVULNERABILITY) {
+        // Hit the player
+        int damage = fmaxf(1, def->damage / 2);  // Scale damage
+        DamagePlayerShip(game->playerShip, damage);
+    }
+    
+    snprintf(game->deathCause, sizeof(game->deathCause),
+            "Hit by %s projectile from Enemy #%d",
+            def->name, projectile->enemyId);
+    
+    LogEvent(game, "[%.2f] Player hit by %s - Damage:%d Health:%d",
+            game->gameTime, def->name, def->damage / 10, game->playerShip->health);
+    
+    // Destroy projectile unless it's piercing
+    if (!def->piercing) {
+        projectile->active = false;
+    }
+    
+    // Handle explosion
+    if (def->explosive && def->explosionRadius > 0) {
+        // Create plasma/energy explosion for explosive projectiles
+        CreateExplosion(game->explosionSystem, projectile->position, EXPLOSION_PLASMA);
+    }
+}
+
+static void ResolvePlayerEnemyContact(Game* game, int e) {
+    EnemyEx* enemy = &game->enemies[e];
+    if (!enemy->active) return;  // Destroyed by an earlier event
+    
+    LogCollision(game, "Enemy", enemy->id, game->playerShip->bounds, enemy->bounds);
+    
+    snprintf(game->deathCause, sizeof(game->deathCause),
+            "Collision with %s Enemy #%d at position (%.0f, %.0f)",
+            GetEnemyTypeName(enemy->type), enemy->id,
+            enemy->position.x, enemy->position.y);
+    
+    // Apply damage only if not invulnerable (ability system removed)
+    if (!DEBUG_INVULNERABILITY) {
+        // Damage based on enemy power
+        int damage = (enemy->power / 20) + 1;  // 1-3 damage based on power
+        DamagePlayerShip(game->playerShip, damage * 10);  // Scale up damage
+    }
+    
+    // Destroy enemy on collision (except bosses)
+    if (enemy->type != ENEMY_BOSS) {
+        // Create explosion for destroyed enemy
+        CreateEnemyExplosion(game->explosionSystem, enemy->position,
+                           GetEnemyTypeColor(enemy->type), enemy->bounds.width);
+        
+        // Drop powerup from defeated enemy
+        if (game->powerupSystem) {
+            DropPowerupFromEnemy(game->powerupSystem, enemy);
+        }
+        
+        RunTelemetry_RecordKill(game->telemetry, enemy->type);
+        enemy->active = false;
+    } else {
+        // Boss takes damage from collision
+        enemy->health -= 2;
+        RunTelemetry_RecordHit(game->telemetry, enemy->type, 2);
+        if (enemy->health <= 0) {
+            // Large explosion for boss
+            CreateExplosion(game->explosionSystem, enemy->position, EXPLOSION_LARGE);
             
-            for (int e = 0; e < MAX_ENEMIES; e++) {
-                if (game->enemies[e].active) {
-                    // Skip ghost enemies when not visible
-                    if (game->enemies[e].type == ENEMY_GHOST && !game->enemies[e].isVisible) {
-                        continue;
-                    }
-                    
-                    // Check circular collision
-                    float dx = projectiles[i].position.x - game->enemies[e].position.x;
-                    float dy = projectiles[i].position.y - game->enemies[e].position.y;
-                    float distance = sqrtf(dx * dx + dy * dy);
-                    
-                    if (distance < (def->hitboxRadius + game->enemies[e].radius)) {
-                        // Apply damage with resistance - always at least 1 damage
-                        float baseDamage = (float)def->damage;
-                        float effectiveDamage = baseDamage * (1.0f - game->enemies[e].resistance);
-                        int damageDealt = (int)fmaxf(1.0f, effectiveDamage);  // Always deal at least 1 damage
-                        
-                        // Boss shield handling
-                        if (game->enemies[e].type == ENEMY_BOSS && game->enemies[e].shieldAngle > 0) {
-                            game->enemies[e].shieldAngle -= damageDealt;
-                            game->enemies[e].specialTimer = 0;  // Reset shield regen timer
-                            if (game->enemies[e].shieldAngle <= 0) {
-                                game->enemies[e].shieldAngle = 0;
-                                LogEvent(game, "[%.2f] Boss shield BROKEN!", game->gameTime);
-                            }
-                        } else {
-                            game->enemies[e].health -= damageDealt;
-                        }
-                        game->enemies[e].hitsTaken++;
-                        
-                        LogEvent(game, "[%.2f] Enemy hit by %s - Type:%s ID:%d Health:%d/%d Hits:%d Damage:%d",
-                                game->gameTime, def->name, GetEnemyTypeName(game->enemies[e].type),
-                                game->enemies[e].id, game->enemies[e].health, game->enemies[e].maxHealth,
-                                game->enemies[e].hitsTaken, damageDealt);
-                        
-                        if (game->enemies[e].health <= 0) {
-                            // Create explosion effect based on enemy type
-                            Color enemyColor = GetEnemyTypeColor(game->enemies[e].type);
-                            float enemySize = game->enemies[e].bounds.width;
-                            CreateEnemyExplosion(game->explosionSystem, game->enemies[e].position, enemyColor, enemySize);
-                            
-                            // Drop powerup from defeated enemy
-                            if (game->powerupSystem) {
-                                DropPowerupFromEnemy(game->powerupSystem, &game->enemies[e]);
-                            }
-                            
-                            game->enemies[e].active = false;
-                            game->score += game->enemies[e].power * 2;
-                            
-                            // Clear boss tracking if this was the boss
-                            if (game->enemies[e].type == ENEMY_BOSS && game->bossEnemyIndex == e) {
-                                game->bossEnemyIndex = -1;
-                                LogEvent(game, "[%.2f] BOSS DEFEATED!", game->gameTime);
-                            }
-                            
-                            LogEvent(game, "[%.2f] Enemy DESTROYED by %s - Type:%s ID:%d TotalHits:%d Score:+%d",
-                                    game->gameTime, def->name, GetEnemyTypeName(game->enemies[e].type),
-                                    game->enemies[e].id, game->enemies[e].hitsTaken, game->enemies[e].power * 2);
-                        }
-                        
-                        // Destroy projectile unless piercing
-                        if (!def->piercing) {
-                            projectiles[i].active = false;
-                            break;  // Stop checking other enemies for this projectile
-                        }
-                    }
-                }
+            // Drop powerup from defeated boss
+            if (game->powerupSystem) {
+                DropPowerupFromEnemy(game->powerupSystem, enemy);
             }
+            
+            enemy->active = false;
+            game->score += enemy->power * 10;  // Big score for boss
+            RunTelemetry_RecordKill(game->telemetry, enemy->type);
+        }
+    }
+}
+
+static void ResolveEvents(Game* game, CollisionContext* bulletCtx, const CollisionEventQueue* queue) {
+    for (int i = 0; i < queue->count; i++) {
+        const CollisionEvent* event = &queue->events[i];
+        switch ((CollisionEventType)event->type) {
+            case COLLISION_BULLET_ENEMY:
+                ResolveBulletHit(bulletCtx, event->a, event->b);
+                break;
+            case COLLISION_PROJECTILE_ENEMY:
+                ResolveProjectileEnemyHit(game, event->a, event->b);
+                break;
+            case COLLISION_PROJECTILE_PLAYER:
+                ResolveProjectilePlayerHit(game, event->a);
+                break;
+            case COLLISION_PLAYER_ENEMY:
+                ResolvePlayerEnemyContact(game, event->b);
+                break;
+            case COLLISION_PLAYER_POWERUP:
+                if (game->powerupSystem->powerups[event->a].active) {
+                    CollectPowerup(game->powerupSystem, event->a, game->playerShip, &game->score);
+                }
+                break;
         }
     }
 }
 
+// Run telemetry for the game's bullets (context is the Game)
+static void RecordBulletHit(void* context, EnemyEx* enemy, int damage) {
+    RunTelemetry_RecordHit(((Game*)context)->telemetry, enemy->type, damage);
+}
+
+static void RecordBulletKill(void* context, EnemyEx* enemy) {
+    RunTelemetry_RecordKill(((Game*)context)->telemetry, enemy->type);
+}
+
+void Collision_CheckBulletEnemyGeneric(CollisionContext* ctx) {
+    CollisionEventQueue temporary;
+    CollisionEventQueue* queue = ctx->events;
+    if (!queue) {
+        Collision_InitEventQueue(&temporary);
+        queue = &temporary;
+    }
+    
+    queue->count = 0;
+    DetectBulletEnemy(ctx->bullets, ctx->maxBullets, ctx->enemies, ctx->maxEnemies, ctx->swept, queue);
+    for (int i = 0; i < queue->count; i++) {
+        ResolveBulletHit(ctx, queue->events[i].a, queue->events[i].b);
+    }
+    
+    if (queue == &temporary) {
+        Collision_CleanupEventQueue(&temporary);
+    }
+}
+
+void Collision_BeginTick(Game* game) {
+    for (int i = 0; i < game->capacity.bullets; i++) {
+        game->bullets[i].previousPosition = game->bullets[i].position;
+    }
+    for (int i = 0; i < game->capacity.enemies; i++) {
+        game->enemies[i].previousPosition = game->enemies[i].position;
+    }
+    Projectile* projectiles = (Projectile*)game->projectiles;
+    for (int i = 0; i < game->capacity.projectiles; i++) {
+        projectiles[i].previousPosition = projectiles[i].position;
+    }
+    game->playerShip->previousPosition = game->playerShip->position;
+}
+
 void CheckCollisions(Game* game) {
-    CheckBulletEnemyCollisions(game);
-    CheckProjectileEnemyCollision(game);
-    CheckProjectilePlayerCollision(game);
-    CheckPlayerEnemyCollisions(game);
+    CollisionEventQueue* queue = game->collisionEvents;
+    CollisionContext bulletCtx = {
+        .bullets = game->bullets,
+        .maxBullets = game->capacity.bullets,
+        .enemies = game->enemies,
+        .maxEnemies = game->capacity.enemies,
+        .explosionSystem = game->explosionSystem,
+        .score = &game->score,
+        .enemiesKilled = NULL,  // Game doesn't track this separately
+        .logContext = game,
+        .events = queue,
+        .swept = true,
+        .onEnemyHit = RecordBulletHit,
+        .onEnemyDestroyed = RecordBulletKill
+    };
+    
+    // Combat: every contact as of the start of the pass, in the order the checks used to run
+    queue->count = 0;
+    const Projectile* projectiles = (const Projectile*)game->projectiles;
+    DetectBulletEnemy(game->bullets, game->capacity.bullets, game->enemies, game->capacity.enemies, true, queue);
+    DetectProjectileEnemy(projectiles, game->capacity.projectiles, game->enemies, game->capacity.enemies, true, queue);
+    DetectProjectilePlayer(projectiles, game->capacity.projectiles, game->playerShip, true, queue);
+    DetectPlayerEnemy(game->playerShip, game->enemies, game->capacity.enemies, queue);
+    ResolveEvents(game, &bulletCtx, queue);
+    
+    // Pickups after combat, so powerups dropped above can be collected this tick
+    queue->count = 0;
+    DetectPlayerPowerups(game->playerShip, game->powerupSystem, queue);
+    ResolveEvents(game, &bulletCtx, queue);
 }
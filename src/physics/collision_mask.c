@@ -0,0 +1,172 @@
+#include "collision_mask.h"
+#include "asset_pack.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+static CollisionMask enemyMasks[ENEMY_TYPE_COUNT];
+static bool enemyMasksLoaded = false;
+
+static bool FitsImage(Image image, Rectangle region) {
+    int x0 = (int)region.x;
+    int y0 = (int)region.y;
+    int width = (int)region.width;
+    int height = (int)region.height;
+    if (width <= 0 || height <= 0 || width > COLLISION_MASK_MAX_SIZE || height > COLLISION_MASK_MAX_SIZE ||
+        x0 < 0 || y0 < 0 || x0 + width > image.width || y0 + height > image.height) {
+        fprintf(stderr, "Collision mask region %dx%d at (%d, %d) does not fit\n", width, height, x0, y0);
+        return false;
+    }
+    return true;
+}
+
+// Threshold the alpha of a region of decoded pixels into mask rows
+static void BuildMask(CollisionMask* mask, const Color* pixels, int imageWidth, Rectangle region, float radius) {
+    int x0 = (int)region.x;
+    int y0 = (int)region.y;
+
+    memset(mask, 0, sizeof(CollisionMask));
+    mask->width = (int)region.width;
+    mask->height = (int)region.height;
+    mask->radius = radius;
+    mask->firstRow = mask->height;
+    mask->lastRow = -1;
+
+    for (int y = 0; y < mask->height; y++) {
+        const Color* row = &pixels[(y0 + y) * imageWidth + x0];
+        uint64_t bits = 0;
+        for (int x = 0; x < mask->width; x++) {
+            if (row[x].a >= COLLISION_MASK_ALPHA_THRESHOLD) {
+                bits |= (uint64_t)1 << x;
+            }
+        }
+        mask->rows[y] = bits;
+        if (bits) {
+            if (y < mask->firstRow) mask->firstRow = y;
+            mask->lastRow = y;
+        }
+    }
+}
+
+bool CollisionMask_FromImage(CollisionMask* mask, Image image, Rectangle region, float radius) {
+    if (!FitsImage(image, region)) {
+        return false;
+    }
+
+    Color* pixels = LoadImageColors(image);
+    if (!pixels) {
+        return false;
+    }
+    BuildMask(mask, pixels, image.width, region, radius);
+    UnloadImageColors(pixels);
+    return true;
+}
+
+// Bits of the pixels [first, last] of a row, clipped to the mask
+static inline uint64_t SpanBits(const CollisionMask* mask, int first, int last) {
+    if (first < 0) first = 0;
+    if (last >= mask->width) last = mask->width - 1;
+    if (first > last) return 0;
+
+    return (~(uint64_t)0 >> (63 - (last - first))) << first;
+}
+
+bool CollisionMask_OverlapsRect(const CollisionMask* mask, Vector2 position, float entityRadius, Rectangle rect) {
+    if (entityRadius <= 0.0f) return false;
+
+    // Rectangle in mask pixels (pixel i covers [i, i + 1), the mask's center is at width / 2)
+    float scale = mask->radius / entityRadius;
+    float left = mask->width * 0.5f + (rect.x - position.x) * scale;
+    float right = left + rect.width * scale;
+    float top = mask->height * 0.5f + (rect.y - position.y) * scale;
+    float bottom = top + rect.height * scale;
+
+    int firstRow = (int)floorf(top);
+    int lastRow = (int)ceilf(bottom) - 1;
+    if (firstRow < mask->firstRow) firstRow = mask->firstRow;
+    if (lastRow > mask->lastRow) lastRow = mask->lastRow;
+
+    uint64_t span = SpanBits(mask, (int)floorf(left), (int)ceilf(right) - 1);
+    if (!span) return false;
+
+    for (int y = firstRow; y <= lastRow; y++) {
+        if (mask->rows[y] & span) return true;
+    }
+    return false;
+}
+
+bool CollisionMask_OverlapsCircle(const CollisionMask* mask, Vector2 position, float entityRadius,
+                                  Vector2 center, float radius) {
+    if (entityRadius <= 0.0f) return false;
+
+    float scale = mask->radius / entityRadius;
+    float cx = mask->width * 0.5f + (center.x - position.x) * scale;
+    float cy = mask->height * 0.5f + (center.y - position.y) * scale;
+    float r = radius * scale;
+
+    int firstRow = (int)floorf(cy - r);
+    int lastRow = (int)ceilf(cy + r) - 1;
+    if (firstRow < mask->firstRow) firstRow = mask->firstRow;
+    if (lastRow > mask->lastRow) lastRow = mask->lastRow;
+
+    for (int y = firstRow; y <= lastRow; y++) {
+        // The circle's widest extent within the row band [y, y + 1)
+        float dy = 0.0f;
+        if (cy < y) {
+            dy = y - cy;
+        } else if (cy > y + 1) {
+            dy = cy - (y + 1);
+        }
+        if (dy >= r) continue;
+
+        float half = sqrtf(r * r - dy * dy);
+        uint64_t span = SpanBits(mask, (int)floorf(cx - half), (int)ceilf(cx + half) - 1);
+        if (mask->rows[y] & span) return true;
+    }
+    return false;
+}
+
+bool CollisionMasks_LoadEnemies(const char* spriteSheetPath) {
+    if (!AssetPack_FileExists(spriteSheetPath)) {
+        fprintf(stderr, "Enemy sprite sheet %s not found\n", spriteSheetPath);
+        return false;
+    }
+
+    Image sheet = LoadImage(spriteSheetPath);
+    Color* pixels = sheet.data ? LoadImageColors(sheet) : NULL;
+    if (!pixels) {
+        UnloadImage(sheet);
+        return false;
+    }
+
+    // One cell per type, in enum order
+    bool loaded = true;
+    for (int type = 0; type < ENEMY_TYPE_COUNT && loaded; type++) {
+        Rectangle cell = {
+            (float)(type % ENEMY_SPRITES_PER_ROW * ENEMY_SPRITE_SIZE),
+            (float)(type / ENEMY_SPRITES_PER_ROW * ENEMY_SPRITE_SIZE),
+            ENEMY_SPRITE_SIZE,
+            ENEMY_SPRITE_SIZE
+        };
+        loaded = FitsImage(sheet, cell);
+        if (loaded) {
+            BuildMask(&enemyMasks[type], pixels, sheet.width, cell, GetEnemySpriteRadius((EnemyType)type));
+        }
+    }
+    UnloadImageColors(pixels);
+    UnloadImage(sheet);
+
+    enemyMasksLoaded = loaded;
+    return loaded;
+}
+
+void CollisionMasks_UnloadEnemies(void) {
+    enemyMasksLoaded = false;
+}
+
+const CollisionMask* CollisionMasks_GetEnemy(EnemyType type) {
+    if (!enemyMasksLoaded || (unsigned int)type >= ENEMY_TYPE_COUNT) {
+        return NULL;
+    }
+    return &enemyMasks[type];
+}
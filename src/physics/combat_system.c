@@ -71,9 +71,8 @@ bool Combat_UpdateEnemyFiring(EnemyEx* enemy, CombatContext* ctx, float deltaTim
     
     // Check if enemy should fire
     const EnemyWeaponConfig* config = GetEnemyWeaponConfig(enemy->type);
-    float fireInterval = 1.0f / config->fireRate;
     
-    if (enemy->fireTimer >= fireInterval && enemy->can_fire) {
+    if (enemy->fireTimer >= config->fireInterval && enemy->can_fire) {
         // Only fire if enemy is on screen and in bounds
         if (enemy->position.x > minX && enemy->position.x < maxX &&
             enemy->position.y > minY && enemy->position.y < maxY) {
@@ -137,7 +137,7 @@ void DrawGameOver(const Game* game) {
 
 void DrawProjectiles(const Game* game, bool showHitbox) {
     Projectile* projectiles = (Projectile*)game->projectiles;
-    for (int i = 0; i < MAX_PROJECTILES; i++) {
+    for (int i = 0; i < game->capacity.projectiles; i++) {
         if (projectiles[i].active) {
             DrawProjectile(&projectiles[i]);
             
@@ -272,7 +272,7 @@ void DrawGame(Game* game) {
     
     // Draw game objects (all in play zone)
     DrawPlayerShip(game->playerShip);
-    DrawBullets(game->bullets);
+    DrawBullets(game->bullets, game->capacity.bullets);
     DrawProjectiles(game, false);  // No hitbox display
     DrawEnemies(game, false);  // No hitbox display
     DrawPowerups(game->powerupSystem);
@@ -0,0 +1,293 @@
+/**
+ * Level Capacity Analyzer
+ *
+ * Replays a level's spawn timeline headlessly through the real wave system,
+ * enemy movement and enemy firing code, and reports how close the wave plan
+ * comes to the enemy and projectile pool limits (the sizes the game would use:
+ * the MAX_ENEMIES / MAX_PROJECTILES defaults raised by any level's "capacity").
+ *
+ * The simulation assumes the player never destroys anything, so the numbers
+ * are an upper bound on pool pressure for the level as authored.
+ *
+ * Usage: analyze_level_capacity [level] [--window seconds] [--csv file] [--seed n]
+ */
+
+#include "types.h"
+#include "constants.h"
+#include "enemy_types.h"
+#include "projectile_types.h"
+#include "wave_system.h"
+#include "wave_timeline.h"
+#include "level_system.h"
+#include "projectile_manager.h"
+#include "game_random.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DEFAULT_WINDOW 5.0f        // Seconds per CSV row
+#define BUSIEST_WINDOW_COUNT 5     // Windows listed in the summary
+#define BOSS_BATTLE_TIME_L1 90.0f  // Mirrors the boss escape timing in UpdateGame
+#define BOSS_BATTLE_TIME_L2 70.0f
+
+// Pool sizes the game runs with (set in main)
+static PoolCapacity pools;
+
+// Per-window statistics
+typedef struct {
+    float startTime;
+    int peakEnemies;
+    int peakProjectiles;
+    double enemySum;
+    double projectileSum;
+    int frames;
+    int spawned;
+    int dropped;
+} CapacityWindow;
+
+static void PrintUsage(const char* prog) {
+    printf("Usage: %s [level] [--window seconds] [--csv file] [--seed n]\n", prog);
+    printf("  level      Level number to analyze (default: 1)\n");
+    printf("  --window   Seconds aggregated per CSV row (default: %.0f)\n", DEFAULT_WINDOW);
+    printf("  --csv      Output CSV path (default: level<N>_capacity.csv)\n");
+    printf("  --seed     Random seed for movement patterns (default: 1)\n");
+}
+
+static int CountActiveEnemies(const EnemyEx* enemies) {
+    int count = 0;
+    for (int i = 0; i < pools.enemies; i++) {
+        if (enemies[i].active) count++;
+    }
+    return count;
+}
+
+// Fraction of the tighter pool used at the window's peak
+static float WindowUtilization(const CapacityWindow* window) {
+    float enemyUse = (float)window->peakEnemies / pools.enemies;
+    float projectileUse = (float)window->peakProjectiles / pools.projectiles;
+    return enemyUse > projectileUse ? enemyUse : projectileUse;
+}
+
+// Rank windows by peak pool utilization, then by average enemy load
+static int CompareWindowLoad(const void* a, const void* b) {
+    const CapacityWindow* wa = (const CapacityWindow*)a;
+    const CapacityWindow* wb = (const CapacityWindow*)b;
+    float useA = WindowUtilization(wa);
+    float useB = WindowUtilization(wb);
+    if (useA != useB) return (useB > useA) - (useB < useA);
+    double avgA = wa->frames ? wa->enemySum / wa->frames : 0.0;
+    double avgB = wb->frames ? wb->enemySum / wb->frames : 0.0;
+    return (avgB > avgA) - (avgB < avgA);
+}
+
+int main(int argc, char* argv[]) {
+    int levelNumber = 1;
+    float windowSize = DEFAULT_WINDOW;
+    const char* csvPath = NULL;
+    unsigned int seed = 1;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--window") == 0 && i + 1 < argc) {
+            windowSize = (float)atof(argv[++i]);
+        } else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            csvPath = argv[++i];
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
+            PrintUsage(argv[0]);
+            return 0;
+        } else {
+            levelNumber = atoi(argv[i]);
+        }
+    }
+
+    if (windowSize <= 0.0f) {
+        fprintf(stderr, "Invalid window size: %.2f\n", windowSize);
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    GameRandom_Seed(seed);
+
+    // Load level configuration
+    LevelManager levelManager;
+    InitLevelManager(&levelManager);
+    const LevelConfig* level = GetLevel(&levelManager, levelNumber);
+    if (!level) {
+        fprintf(stderr, "Level %d not found\n", levelNumber);
+        CleanupLevelManager(&levelManager);
+        return 1;
+    }
+    ResetToLevel(&levelManager, levelNumber);
+
+    // Minimal headless game state - only what the wave and combat code touch
+    Game game;
+    memset(&game, 0, sizeof(Game));
+    WaveSystem waveSystem;
+    memset(&waveSystem, 0, sizeof(WaveSystem));
+    pools = GetRunPoolCapacity(&levelManager);
+    game.capacity = pools;
+    game.enemies = (EnemyEx*)calloc(pools.enemies, sizeof(EnemyEx));
+    game.projectiles = calloc(pools.projectiles, sizeof(Projectile));
+    game.levelManager = &levelManager;
+    game.waveSystem = &waveSystem;
+    game.logFile = NULL;
+    game.bossEnemyIndex = -1;
+    game.bossSpawnTime = -1.0f;
+
+    if (!game.enemies || !game.projectiles) {
+        fprintf(stderr, "Failed to allocate entity pools\n");
+        free(game.enemies);
+        free(game.projectiles);
+        CleanupLevelManager(&levelManager);
+        return 1;
+    }
+
+    InitWaveSystem(&waveSystem, level);
+    if (waveSystem.eventCount == 0) {
+        fprintf(stderr, "Level %d has no spawn events\n", levelNumber);
+        CleanupWaveSystem(&waveSystem);
+        free(game.enemies);
+        free(game.projectiles);
+        CleanupLevelManager(&levelManager);
+        return 1;
+    }
+
+    ProjectileManager projectileMgr = {
+        .projectiles = (Projectile*)game.projectiles,
+        .maxProjectiles = pools.projectiles,
+        .minX = -100, .maxX = SCREEN_WIDTH + 100,
+        .minY = -100, .maxY = SCREEN_HEIGHT + 100
+    };
+    ProjectileManager_InitAll(&projectileMgr);
+
+    // Player parked at the spawn position so aimed weapons behave as in game
+    Vector2 playerPosition = { 100, PLAY_ZONE_TOP + PLAY_ZONE_HEIGHT / 2 };
+
+    float duration = waveSystem.totalDuration;
+    int windowCount = (int)(duration / windowSize) + 1;
+    CapacityWindow* windows = (CapacityWindow*)calloc(windowCount, sizeof(CapacityWindow));
+    if (!windows) {
+        fprintf(stderr, "Failed to allocate %d windows\n", windowCount);
+        CleanupWaveSystem(&waveSystem);
+        free(game.enemies);
+        free(game.projectiles);
+        CleanupLevelManager(&levelManager);
+        return 1;
+    }
+    for (int w = 0; w < windowCount; w++) {
+        windows[w].startTime = w * windowSize;
+    }
+
+    printf("=== Level Capacity Analyzer ===\n");
+    printf("Level %d: %s (%.1f seconds, %d spawn events)\n",
+           level->levelNumber, level->name, duration, waveSystem.eventCount);
+    printf("Pools: %d enemies, %d projectiles\n\n", pools.enemies, pools.projectiles);
+
+    const float dt = 1.0f / WAVE_TIMELINE_FPS;
+    float bossBattleTime = (level->levelNumber == 2) ? BOSS_BATTLE_TIME_L2 : BOSS_BATTLE_TIME_L1;
+    int peakEnemies = 0, peakProjectiles = 0;
+    float peakEnemiesTime = 0.0f, peakProjectilesTime = 0.0f;
+    int framesAtEnemyCap = 0, framesAtProjectileCap = 0;
+
+    while (!waveSystem.isComplete) {
+        int spawnedBefore = waveSystem.totalEnemiesSpawned;
+        int droppedBefore = waveSystem.totalSpawnsDropped;
+
+        WaveTimeline_Step(&game, playerPosition, dt);
+
+        // Boss never dies here, so send it away on the same schedule as the game
+        if (game.bossEnemyIndex >= 0) {
+            EnemyEx* boss = &game.enemies[game.bossEnemyIndex];
+            if (!boss->active) {
+                game.bossEnemyIndex = -1;
+            } else if (!boss->isEscaping && game.gameTime - game.bossSpawnTime >= bossBattleTime) {
+                boss->isEscaping = true;
+            }
+        }
+
+        int enemies = CountActiveEnemies(game.enemies);
+        int projectiles = ProjectileManager_CountActive(&projectileMgr);
+
+        if (enemies > peakEnemies) {
+            peakEnemies = enemies;
+            peakEnemiesTime = waveSystem.waveTimer;
+        }
+        if (projectiles > peakProjectiles) {
+            peakProjectiles = projectiles;
+            peakProjectilesTime = waveSystem.waveTimer;
+        }
+        if (enemies >= pools.enemies) framesAtEnemyCap++;
+        if (projectiles >= pools.projectiles) framesAtProjectileCap++;
+
+        int w = (int)(waveSystem.waveTimer / windowSize);
+        if (w >= windowCount) w = windowCount - 1;
+        CapacityWindow* window = &windows[w];
+        if (enemies > window->peakEnemies) window->peakEnemies = enemies;
+        if (projectiles > window->peakProjectiles) window->peakProjectiles = projectiles;
+        window->enemySum += enemies;
+        window->projectileSum += projectiles;
+        window->frames++;
+        window->spawned += waveSystem.totalEnemiesSpawned - spawnedBefore;
+        window->dropped += waveSystem.totalSpawnsDropped - droppedBefore;
+    }
+
+    // Write per-window CSV
+    char defaultPath[64];
+    if (!csvPath) {
+        snprintf(defaultPath, sizeof(defaultPath), "level%d_capacity.csv", level->levelNumber);
+        csvPath = defaultPath;
+    }
+    FILE* csv = fopen(csvPath, "w");
+    if (csv) {
+        fprintf(csv, "window_start,window_end,peak_enemies,avg_enemies,enemy_headroom,"
+                     "peak_projectiles,avg_projectiles,projectile_headroom,spawned,dropped\n");
+        for (int w = 0; w < windowCount; w++) {
+            const CapacityWindow* window = &windows[w];
+            if (window->frames == 0) continue;
+            fprintf(csv, "%.2f,%.2f,%d,%.2f,%d,%d,%.2f,%d,%d,%d\n",
+                    window->startTime, window->startTime + windowSize,
+                    window->peakEnemies, window->enemySum / window->frames,
+                    pools.enemies - window->peakEnemies,
+                    window->peakProjectiles, window->projectileSum / window->frames,
+                    pools.projectiles - window->peakProjectiles,
+                    window->spawned, window->dropped);
+        }
+        fclose(csv);
+    } else {
+        fprintf(stderr, "Failed to open CSV output: %s\n", csvPath);
+    }
+
+    // Summary
+    printf("=== Capacity Summary ===\n");
+    printf("Enemies spawned:      %d\n", waveSystem.totalEnemiesSpawned);
+    printf("Spawns dropped:       %d\n", waveSystem.totalSpawnsDropped);
+    printf("Peak enemies:         %d / %d at %.2fs (%d frames at cap)\n",
+           peakEnemies, pools.enemies, peakEnemiesTime, framesAtEnemyCap);
+    printf("Peak projectiles:     %d / %d at %.2fs (%d frames at cap)\n",
+           peakProjectiles, pools.projectiles, peakProjectilesTime, framesAtProjectileCap);
+
+    qsort(windows, windowCount, sizeof(CapacityWindow), CompareWindowLoad);
+    int listed = windowCount < BUSIEST_WINDOW_COUNT ? windowCount : BUSIEST_WINDOW_COUNT;
+    printf("\nBusiest %.0fs windows:\n", windowSize);
+    for (int w = 0; w < listed; w++) {
+        const CapacityWindow* window = &windows[w];
+        if (window->frames == 0) break;
+        printf("  [%6.1f - %6.1f] %3.0f%% | enemies peak %2d avg %5.2f | projectiles peak %3d avg %6.2f | dropped %d\n",
+               window->startTime, window->startTime + windowSize, WindowUtilization(window) * 100.0f,
+               window->peakEnemies, window->enemySum / window->frames,
+               window->peakProjectiles, window->projectileSum / window->frames,
+               window->dropped);
+    }
+
+    if (csv) printf("\nPer-window data written to %s\n", csvPath);
+
+    int dropped = waveSystem.totalSpawnsDropped;
+    free(windows);
+    CleanupWaveSystem(&waveSystem);
+    free(game.enemies);
+    free(game.projectiles);
+    CleanupLevelManager(&levelManager);
+
+    return dropped > 0 ? 2 : 0;
+}
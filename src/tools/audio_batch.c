@@ -0,0 +1,552 @@
+/**
+ * Batch Audio Analyzer
+ *
+ * Analyzes every track under a directory tree in parallel and writes the
+ * same bass logs and .benv envelopes (plus .beats grids with --beats) as
+ * `audio_analysis_cli --offline`, next to each track
+ * (audio_getLogFilePath). Each worker thread owns one decoder and one STFT.
+ *
+ * Tracks whose content hash and analysis settings match the cache file from
+ * the previous run (and whose log still exists) are skipped, so re-running
+ * after a threshold change only costs the decode + analysis, and re-running
+ * without changes costs one read of each file.
+ *
+ * Usage: audio_batch [directory] [-j jobs] [--force] [--beats] [CLI threshold/STFT options]
+ */
+
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L   // nanosleep/sysconf under -std=c99
+#endif
+
+#include "raylib.h"
+#include "audio_analysis.h"
+#include "audio_detector.h"
+#include "audio_stft.h"
+#include <ctype.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#ifndef _WIN32
+    #include <unistd.h>
+#endif
+
+#define DEFAULT_DIRECTORY "assets/audio"
+#define CACHE_FILE_NAME ".audio_analysis_cache"
+#define CACHE_VERSION 2              // Bump when the analysis or its outputs change
+#define MAX_JOBS 16
+#define PROGRESS_INTERVAL_MS 250
+#define TRACK_PATH_LENGTH 512
+
+typedef enum {
+    TRACK_PENDING = 0,
+    TRACK_ANALYZED,
+    TRACK_CACHED,
+    TRACK_FAILED
+} TrackStatus;
+
+typedef struct {
+    char path[TRACK_PATH_LENGTH];
+    unsigned long long hash;         // FNV-1a of the file contents
+    TrackStatus status;
+    float duration;
+    int bassEvents;
+    int peaks;
+    const char *error;
+} Track;
+
+typedef struct {
+    char path[TRACK_PATH_LENGTH];
+    unsigned long long hash;
+    unsigned long long settings;
+} CacheEntry;
+
+// Shared by all workers (read-only after setup except the atomic counters)
+static Track *tracks = NULL;
+static int trackCount = 0;
+static CacheEntry *cache = NULL;
+static int cacheCount = 0;
+static BassConfig bassConfig;
+static AudioSTFTConfig stftConfig;
+static unsigned long long settingsHash = 0;
+static bool forceAnalysis = false;
+static bool writeBeats = false;
+static size_t directoryLength = 0;   // Cache paths are relative to the scanned directory
+
+static int nextTrack = 0;
+static int finishedTracks = 0;
+static unsigned long long analyzedMilliseconds = 0;
+
+static void SleepMs(int milliseconds) {
+#ifndef _WIN32
+    struct timespec duration = { milliseconds / 1000, (long)(milliseconds % 1000) * 1000000L };
+    nanosleep(&duration, NULL);
+#else
+    WaitTime(milliseconds / 1000.0);
+#endif
+}
+
+static int CpuCount(void) {
+#ifndef _WIN32
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+#else
+    return 4;
+#endif
+}
+
+static unsigned long long HashBytes(unsigned long long hash, const void *data, size_t size) {
+    const unsigned char *bytes = (const unsigned char *)data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+#define FNV_OFFSET_BASIS 14695981039346656037ULL
+
+static bool HashFile(const char *path, unsigned long long *hash) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) return false;
+
+    unsigned char buffer[65536];
+    unsigned long long value = FNV_OFFSET_BASIS;
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        value = HashBytes(value, buffer, count);
+    }
+    bool ok = !ferror(file);
+    fclose(file);
+
+    *hash = value;
+    return ok;
+}
+
+// Everything that changes the log output goes into the settings hash
+static unsigned long long HashSettings(void) {
+    char text[256];
+    snprintf(text, sizeof(text), "v%d %.3f %.3f %.3f %.3f %d | %d %d %d %d | %d",
+             CACHE_VERSION, bassConfig.thresholdLow, bassConfig.thresholdMedium,
+             bassConfig.thresholdHigh, bassConfig.peakThreshold, bassConfig.peakEnabled,
+             stftConfig.frameSize, stftConfig.hopSize, (int)stftConfig.window, (int)stftConfig.channel,
+             writeBeats);
+    return HashBytes(FNV_OFFSET_BASIS, text, strlen(text));
+}
+
+static bool HasAudioExtension(const char *name) {
+    const char *ext = strrchr(name, '.');
+    if (ext == NULL) return false;
+
+    char lower[8] = {0};
+    for (int i = 0; i < 7 && ext[i]; i++) {
+        lower[i] = (char)tolower((unsigned char)ext[i]);
+    }
+    return strcmp(lower, ".mp3") == 0 || strcmp(lower, ".ogg") == 0 || strcmp(lower, ".wav") == 0;
+}
+
+static bool AddTrack(const char *path, int *capacity) {
+    if (trackCount == *capacity) {
+        int newCapacity = *capacity ? *capacity * 2 : 64;
+        Track *grown = realloc(tracks, sizeof(Track) * newCapacity);
+        if (grown == NULL) return false;
+        tracks = grown;
+        *capacity = newCapacity;
+    }
+
+    Track *track = &tracks[trackCount++];
+    memset(track, 0, sizeof(Track));
+    snprintf(track->path, sizeof(track->path), "%s", path);
+    return true;
+}
+
+// Collect audio files under directory (hidden entries are skipped)
+static void ScanTree(const char *directory, int *capacity) {
+    DIR *dir = opendir(directory);
+    if (dir == NULL) {
+        printf("Warning: Could not open directory: %s\n", directory);
+        return;
+    }
+
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.') continue;
+
+        char path[TRACK_PATH_LENGTH];
+        int length = snprintf(path, sizeof(path), "%s/%s", directory, entry->d_name);
+        if (length < 0 || length >= (int)sizeof(path)) continue;
+
+        struct stat st;
+        if (stat(path, &st) != 0) continue;
+
+        if (S_ISDIR(st.st_mode)) {
+            ScanTree(path, capacity);
+        } else if (S_ISREG(st.st_mode) && HasAudioExtension(entry->d_name)) {
+            if (!AddTrack(path, capacity)) {
+                printf("Warning: Out of memory, skipping %s\n", path);
+            }
+        }
+    }
+
+    closedir(dir);
+}
+
+static int CompareTracks(const void *a, const void *b) {
+    return strcmp(((const Track *)a)->path, ((const Track *)b)->path);
+}
+
+static void LoadCache(const char *cachePath) {
+    FILE *file = fopen(cachePath, "r");
+    if (file == NULL) return;
+
+    int capacity = 0;
+    char line[TRACK_PATH_LENGTH + 64];
+    while (fgets(line, sizeof(line), file)) {
+        CacheEntry entry;
+        int offset = 0;
+        if (sscanf(line, "%llx %llx %n", &entry.hash, &entry.settings, &offset) != 2 || offset == 0) {
+            continue;
+        }
+        line[strcspn(line, "\r\n")] = '\0';
+        snprintf(entry.path, sizeof(entry.path), "%s", line + offset);
+
+        if (cacheCount == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            CacheEntry *grown = realloc(cache, sizeof(CacheEntry) * capacity);
+            if (grown == NULL) break;
+            cache = grown;
+        }
+        cache[cacheCount++] = entry;
+    }
+
+    fclose(file);
+}
+
+static const char* RelativePath(const Track *track) {
+    return track->path + directoryLength + 1;
+}
+
+static bool IsCached(const Track *track) {
+    for (int i = 0; i < cacheCount; i++) {
+        if (cache[i].hash == track->hash && cache[i].settings == settingsHash &&
+            strcmp(cache[i].path, RelativePath(track)) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void SaveCache(const char *cachePath) {
+    FILE *file = fopen(cachePath, "w");
+    if (file == NULL) {
+        printf("Warning: Could not write cache file: %s\n", cachePath);
+        return;
+    }
+
+    for (int i = 0; i < trackCount; i++) {
+        if (tracks[i].status == TRACK_ANALYZED || tracks[i].status == TRACK_CACHED) {
+            fprintf(file, "%016llx %016llx %s\n", tracks[i].hash, settingsHash, RelativePath(&tracks[i]));
+        }
+    }
+    fclose(file);
+}
+
+static void AnalyzeTrack(Track *track, AudioSTFT *stft) {
+    char logPath[TRACK_PATH_LENGTH + 8];
+    char envelopePath[TRACK_PATH_LENGTH + 8];
+    char beatsPath[TRACK_PATH_LENGTH + 8];
+    audio_getLogFilePath(track->path, logPath, sizeof(logPath));
+    BassEnvelope_GetPath(track->path, envelopePath, sizeof(envelopePath));
+    audio_getBeatsFilePath(track->path, beatsPath, sizeof(beatsPath));
+
+    if (!HashFile(track->path, &track->hash)) {
+        track->status = TRACK_FAILED;
+        track->error = "could not read file";
+        return;
+    }
+
+    struct stat st;
+    if (!forceAnalysis && IsCached(track) && stat(logPath, &st) == 0 && stat(envelopePath, &st) == 0 &&
+        (!writeBeats || stat(beatsPath, &st) == 0)) {
+        track->status = TRACK_CACHED;
+        return;
+    }
+
+    Wave wave = LoadWave(track->path);
+    if (wave.frameCount == 0) {
+        track->status = TRACK_FAILED;
+        track->error = "could not decode audio";
+        return;
+    }
+    track->duration = (float)wave.frameCount / wave.sampleRate;
+
+    // Analysis constants assume SAMPLE_RATE float stereo
+    if (wave.sampleRate != (unsigned int)SAMPLE_RATE || wave.sampleSize != 32 || wave.channels != 2) {
+        WaveFormat(&wave, (int)SAMPLE_RATE, 32, 2);
+    }
+
+    FILE *logFile = fopen(logPath, "w");
+    if (logFile == NULL) {
+        UnloadWave(wave);
+        track->status = TRACK_FAILED;
+        track->error = "could not create log file";
+        return;
+    }
+
+    BassDetector detector;
+    BassEnvelopeBuilder envelope;
+    audio_detectorInit(&detector, &bassConfig, logFile, false);
+    if (BassEnvelope_BuilderInit(&envelope, BASS_ENVELOPE_FRAME_RATE)) {
+        detector.envelope = &envelope;
+    }
+    audio_writeLogHeader(logFile, track->path, track->duration, &bassConfig);
+    if (writeBeats) {
+        detector.onsets = audio_onsetCreate(&stftConfig);
+        detector.beatsFile = detector.onsets ? fopen(beatsPath, "w") : NULL;
+        if (detector.beatsFile == NULL) {
+            audio_onsetDestroy(detector.onsets);
+            fclose(logFile);
+            BassEnvelope_BuilderFree(&envelope);
+            UnloadWave(wave);
+            track->status = TRACK_FAILED;
+            track->error = "could not create beat grid";
+            return;
+        }
+        audio_writeBeatsHeader(detector.beatsFile, track->path, track->duration);
+    }
+
+    audio_stftReset(stft, 0.0);
+    float analysisTime = audio_detectorAnalyzePCM(&detector, stft, (const float *)wave.data,
+                                                  wave.frameCount, track->duration);
+
+    audio_writeLogSummary(logFile, &detector, analysisTime);
+    fclose(logFile);
+    UnloadWave(wave);
+    if (detector.beatsFile) {
+        audio_writeBeatsSummary(detector.beatsFile, &detector);
+        fclose(detector.beatsFile);
+    }
+    audio_onsetDestroy(detector.onsets);
+
+    bool saved = BassEnvelope_Save(&envelope, envelopePath);
+    BassEnvelope_BuilderFree(&envelope);
+    if (!saved) {
+        track->status = TRACK_FAILED;
+        track->error = "could not write bass envelope";
+        return;
+    }
+
+    track->bassEvents = detector.bassEventCount;
+    track->peaks = detector.peakCount;
+    track->status = TRACK_ANALYZED;
+    __atomic_add_fetch(&analyzedMilliseconds, (unsigned long long)(analysisTime * 1000.0f), __ATOMIC_RELAXED);
+}
+
+static void* WorkerMain(void *arg) {
+    AudioSTFT *stft = (AudioSTFT *)arg;
+
+    while (true) {
+        int index = __atomic_fetch_add(&nextTrack, 1, __ATOMIC_RELAXED);
+        if (index >= trackCount) break;
+
+        AnalyzeTrack(&tracks[index], stft);
+        __atomic_add_fetch(&finishedTracks, 1, __ATOMIC_RELEASE);
+    }
+    return NULL;
+}
+
+static void PrintUsage(const char *programName) {
+    printf("Usage: %s [directory] [OPTIONS]\n", programName);
+    printf("\nAnalyzes every .mp3/.ogg/.wav under directory (default: %s)\n", DEFAULT_DIRECTORY);
+    printf("and writes a bass log next to each track.\n");
+    printf("\nOptions:\n");
+    printf("  -j, --jobs <n>           Worker threads (default: CPU count, max %d)\n", MAX_JOBS);
+    printf("  -c, --config <path>      Configuration file (default: %s)\n", CONFIG_FILE_DEFAULT);
+    printf("  --force                  Ignore the cache and re-analyze everything\n");
+    printf("  --beats                  Also write a beat grid (.beats) for each track\n");
+    printf("  --low <value>            Set LOW threshold\n");
+    printf("  --medium <value>         Set MEDIUM threshold\n");
+    printf("  --high <value>           Set HIGH threshold\n");
+    printf("  --enable-peak            Enable peak detection\n");
+    printf("  --peak <value>           Set PEAK threshold\n");
+    printf("  --hop <samples>          Samples between analysis frames (default: %d)\n", FFT_SIZE);
+    printf("  --window <type>          hann, hamming or blackman (default: hamming)\n");
+    printf("  --channel <channel>      left, right or mid (default: left)\n");
+    printf("  -h, --help               Show this help message\n");
+    printf("\nCache: %s in the directory (content hash + settings per track)\n", CACHE_FILE_NAME);
+}
+
+int main(int argc, char *argv[]) {
+    const char *directory = DEFAULT_DIRECTORY;
+    const char *configFilePath = NULL;
+    int jobs = CpuCount();
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+            PrintUsage(argv[0]);
+            return 0;
+        }
+        if ((strcmp(argv[i], "-c") == 0 || strcmp(argv[i], "--config") == 0) && i + 1 < argc) {
+            configFilePath = argv[i + 1];
+        }
+    }
+
+    audio_loadConfig(&bassConfig, configFilePath);
+    stftConfig = audio_stftDefaultConfig();
+
+    for (int i = 1; i < argc; i++) {
+        if ((strcmp(argv[i], "-c") == 0 || strcmp(argv[i], "--config") == 0) && i + 1 < argc) {
+            i++;
+        } else if ((strcmp(argv[i], "-j") == 0 || strcmp(argv[i], "--jobs") == 0) && i + 1 < argc) {
+            jobs = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--force") == 0) {
+            forceAnalysis = true;
+        } else if (strcmp(argv[i], "--beats") == 0) {
+            writeBeats = true;
+        } else if (strcmp(argv[i], "--low") == 0 && i + 1 < argc) {
+            bassConfig.thresholdLow = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--medium") == 0 && i + 1 < argc) {
+            bassConfig.thresholdMedium = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--high") == 0 && i + 1 < argc) {
+            bassConfig.thresholdHigh = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--enable-peak") == 0) {
+            bassConfig.peakEnabled = 1;
+        } else if (strcmp(argv[i], "--peak") == 0 && i + 1 < argc) {
+            bassConfig.peakThreshold = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--hop") == 0 && i + 1 < argc) {
+            stftConfig.hopSize = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--window") == 0 && i + 1 < argc) {
+            if (!audio_stftParseWindow(argv[++i], &stftConfig.window)) {
+                printf("Error: Unknown window '%s' (use hann, hamming or blackman)\n", argv[i]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--channel") == 0 && i + 1 < argc) {
+            if (!audio_stftParseChannel(argv[++i], &stftConfig.channel)) {
+                printf("Error: Unknown channel '%s' (use left, right or mid)\n", argv[i]);
+                return 1;
+            }
+        } else if (argv[i][0] == '-') {
+            printf("Error: Unknown option '%s'\n\n", argv[i]);
+            PrintUsage(argv[0]);
+            return 1;
+        } else {
+            directory = argv[i];
+        }
+    }
+
+    if (jobs < 1) jobs = 1;
+    if (jobs > MAX_JOBS) jobs = MAX_JOBS;
+    settingsHash = HashSettings();
+
+    printf("=== Batch Audio Analysis ===\n");
+    printf("Directory: %s\n", directory);
+    printf("Bass Thresholds: LOW=%.3f, MEDIUM=%.3f, HIGH=%.3f\n",
+           bassConfig.thresholdLow, bassConfig.thresholdMedium, bassConfig.thresholdHigh);
+    printf("Peak Detection: %s\n", bassConfig.peakEnabled ? "ENABLED" : "DISABLED");
+    printf("STFT: %d-sample frames, hop %d, %s window, %s channel\n",
+           stftConfig.frameSize, stftConfig.hopSize,
+           audio_stftWindowName(stftConfig.window), audio_stftChannelName(stftConfig.channel));
+
+    int capacity = 0;
+    directoryLength = strlen(directory);
+    ScanTree(directory, &capacity);
+    if (trackCount == 0) {
+        printf("No audio files found in %s\n", directory);
+        free(tracks);
+        return 1;
+    }
+    qsort(tracks, trackCount, sizeof(Track), CompareTracks);
+    if (jobs > trackCount) jobs = trackCount;
+
+    char cachePath[TRACK_PATH_LENGTH];
+    snprintf(cachePath, sizeof(cachePath), "%s/%s", directory, CACHE_FILE_NAME);
+    if (!forceAnalysis) {
+        LoadCache(cachePath);
+    }
+
+    printf("Tracks: %d, workers: %d\n\n", trackCount, jobs);
+    SetTraceLogLevel(LOG_WARNING);   // Keep decoder info lines out of the progress output
+
+    // One STFT per worker, created up front so a failure is reported before any work
+    AudioSTFT *stfts[MAX_JOBS] = {0};
+    pthread_t workers[MAX_JOBS];
+    int started = 0;
+    for (int i = 0; i < jobs; i++) {
+        stfts[i] = audio_stftCreate(&stftConfig);
+        if (stfts[i] == NULL) {
+            printf("Error: Invalid hop size %d (must be 1-%d)\n", stftConfig.hopSize, FFT_SIZE);
+            for (int j = 0; j < i; j++) audio_stftDestroy(stfts[j]);
+            free(tracks);
+            free(cache);
+            return 1;
+        }
+    }
+
+    time_t startWallTime = time(NULL);
+    for (int i = 0; i < jobs; i++) {
+        if (pthread_create(&workers[i], NULL, WorkerMain, stfts[i]) == 0) {
+            started++;
+        }
+    }
+    if (started == 0) {
+        // No threads available: do the work on this one
+        WorkerMain(stfts[0]);
+    }
+
+    // Aggregate progress
+    int finished;
+    while ((finished = __atomic_load_n(&finishedTracks, __ATOMIC_ACQUIRE)) < trackCount) {
+        unsigned long long milliseconds = __atomic_load_n(&analyzedMilliseconds, __ATOMIC_RELAXED);
+        printf("\rProgress: %d/%d tracks (%.1f%%), %.0f seconds of audio analyzed",
+               finished, trackCount, finished * 100.0f / trackCount, milliseconds / 1000.0);
+        fflush(stdout);
+        SleepMs(PROGRESS_INTERVAL_MS);
+    }
+    for (int i = 0; i < started; i++) {
+        pthread_join(workers[i], NULL);
+    }
+    long wallTime = (long)(time(NULL) - startWallTime);
+
+    int analyzed = 0, cached = 0, failed = 0;
+    printf("\rProgress: %d/%d tracks (100.0%%)%40s\n\n", trackCount, trackCount, "");
+    for (int i = 0; i < trackCount; i++) {
+        const Track *track = &tracks[i];
+        switch (track->status) {
+            case TRACK_ANALYZED:
+                analyzed++;
+                printf("  ANALYZED %7.2fs  %4d events", track->duration, track->bassEvents);
+                if (bassConfig.peakEnabled) printf("  %4d peaks", track->peaks);
+                printf("  %s\n", track->path);
+                break;
+            case TRACK_CACHED:
+                cached++;
+                printf("  CACHED                         %s\n", track->path);
+                break;
+            default:
+                failed++;
+                printf("  FAILED   %s: %s\n", track->path, track->error ? track->error : "unknown error");
+                break;
+        }
+    }
+
+    SaveCache(cachePath);
+
+    double audioSeconds = __atomic_load_n(&analyzedMilliseconds, __ATOMIC_RELAXED) / 1000.0;
+    printf("\n=========================================\n");
+    printf("Analyzed: %d, cached: %d, failed: %d\n", analyzed, cached, failed);
+    printf("Audio analyzed: %.1f seconds in %ld seconds wall clock (%d workers)\n",
+           audioSeconds, wallTime, jobs);
+    printf("Cache: %s\n", cachePath);
+
+    for (int i = 0; i < jobs; i++) {
+        audio_stftDestroy(stfts[i]);
+    }
+    free(tracks);
+    free(cache);
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,565 @@
+/**
+ * Audio Analysis Benchmark
+ *
+ * Checks the real-input FFT plans against a double-precision reference DFT
+ * for every power-of-two size the analyzers might use, then measures FFT
+ * throughput for the plan and for the original audio_fft, and STFT +
+ * detector throughput for several hop sizes.
+ *
+ * The golden check runs the bass detector (default thresholds, peaks on)
+ * and the onset engine over synthetic signals generated in-process (kick
+ * pulses, a sine sweep, white noise) and compares the bass level and peak
+ * of every analysis frame with audio_bench_golden.h. A faster kernel must
+ * keep producing the same level-sync data the game's levels were built on.
+ *
+ * Exits with status 1 if any plan exceeds the accuracy tolerance or any
+ * signal differs from its golden output, so it can gate kernel changes.
+ *
+ * Usage: audio_bench [--accuracy] [--throughput] [--golden] [--seconds n]
+ *        audio_bench --print-golden > src/tools/audio_bench_golden.h
+ */
+
+#include "audio_analysis.h"
+#include "audio_detector.h"
+#include "audio_fft.h"
+#include "audio_onset.h"
+#include "audio_stft.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define ACCURACY_MIN_SIZE 4
+#define ACCURACY_MAX_SIZE 8192
+#define ACCURACY_TOLERANCE 1e-5    // Max error relative to the largest reference bin
+#define THROUGHPUT_MIN_SIZE 256
+#define THROUGHPUT_MAX_SIZE 8192
+#define DEFAULT_SECONDS 0.5        // Measuring time per kernel and size
+#define SIGNAL_SECONDS 10          // Length of each synthetic signal
+#define SIGNAL_FRAMES ((unsigned int)(SIGNAL_SECONDS * SAMPLE_RATE))
+#define GOLDEN_ENERGY_TOLERANCE 1e-3   // Relative difference allowed in the summed bass energy
+#define GOLDEN_LINE_LENGTH 64      // Level characters per line in the golden header
+
+static const double TWO_PI = 6.283185307179586476925286766559;
+
+// Expected detector output for one synthetic signal
+typedef struct {
+    const char *name;
+    int bassEvents;
+    int peaks;
+    double energySum;              // Sum of bass energy over all frames
+    int onsets;
+    int beats;
+    const char *levels;            // One character per frame (see LevelChar)
+} BenchGolden;
+
+#include "audio_bench_golden.h"
+
+typedef void (*SignalGenerator)(float *stereo, unsigned int frames);
+
+typedef struct {
+    const char *name;
+    SignalGenerator generate;
+} BenchSignal;
+
+typedef struct {
+    int bassEvents;
+    int peaks;
+    double energySum;
+    int onsets;
+    int beats;
+    char *levels;
+    int frames;
+} BenchResult;
+
+// Deterministic test signal: white noise plus a low sine, like a bass-heavy frame
+static void FillSignal(float *samples, int size, unsigned int seed) {
+    srand(seed);
+    for (int i = 0; i < size; i++) {
+        float noise = (float)rand() / RAND_MAX * 2.0f - 1.0f;
+        samples[i] = 0.5f * noise + 0.5f * (float)sin(TWO_PI * 3.0 * i / size);
+    }
+}
+
+// O(n^2) reference DFT in double precision, bins 0..n/2
+static void ReferenceDFT(const float *samples, int size, double *outRe, double *outIm) {
+    for (int k = 0; k <= size / 2; k++) {
+        double re = 0.0, im = 0.0;
+        for (int t = 0; t < size; t++) {
+            // Reduce k*t mod size first so the angle stays exact
+            double angle = -TWO_PI * (double)(((long long)k * t) % size) / size;
+            re += samples[t] * cos(angle);
+            im += samples[t] * sin(angle);
+        }
+        outRe[k] = re;
+        outIm[k] = im;
+    }
+}
+
+static double RelativeError(const float complex *bins, const double *refRe, const double *refIm, int count) {
+    double maxError = 0.0, maxReference = 0.0;
+    for (int k = 0; k < count; k++) {
+        double error = hypot(crealf(bins[k]) - refRe[k], cimagf(bins[k]) - refIm[k]);
+        double reference = hypot(refRe[k], refIm[k]);
+        if (error > maxError) maxError = error;
+        if (reference > maxReference) maxReference = reference;
+    }
+    return maxReference > 0.0 ? maxError / maxReference : maxError;
+}
+
+// Synthetic signals: mono, duplicated to both channels, deterministic on every platform
+
+// 120 BPM kick drum (pitch drop 120 -> 50 Hz) over a 55 Hz bass line whose
+// level steps through high, medium, low and silence, one bar each
+static void GenerateKicks(float *stereo, unsigned int frames) {
+    static const double barBass[4] = { 3.0, 1.8, 0.8, 0.0 };
+    const double beatLength = 0.5;
+
+    for (unsigned int i = 0; i < frames; i++) {
+        double t = i / (double)SAMPLE_RATE;
+        int beat = (int)(t / beatLength);
+        double local = t - beat * beatLength;
+        // Phase of f(t) = 50 + 70 * exp(-t / 0.03), integrated analytically
+        double phase = TWO_PI * (50.0 * local + 70.0 * 0.03 * (1.0 - exp(-local / 0.03)));
+        double kick = exp(-local / 0.15) * sin(phase);
+        double bass = barBass[(beat / 4) % 4] * sin(TWO_PI * 55.0 * t);
+        float sample = (float)(0.5 * kick + 0.5 * bass);
+        stereo[i * 2] = sample;
+        stereo[i * 2 + 1] = sample;
+    }
+}
+
+// Exponential sine sweep 20 Hz -> 5 kHz: bass at the start, none at the end
+static void GenerateSweep(float *stereo, unsigned int frames) {
+    const double f0 = 20.0, f1 = 5000.0;
+    const double duration = frames / (double)SAMPLE_RATE;
+    const double rate = log(f1 / f0);
+
+    for (unsigned int i = 0; i < frames; i++) {
+        double t = i / (double)SAMPLE_RATE;
+        double phase = TWO_PI * f0 * duration / rate * (exp(t / duration * rate) - 1.0);
+        float sample = (float)(0.5 * sin(phase));
+        stereo[i * 2] = sample;
+        stereo[i * 2 + 1] = sample;
+    }
+}
+
+// White noise (xorshift32, not rand) fading in from silence to full scale
+static void GenerateNoise(float *stereo, unsigned int frames) {
+    uint32_t state = 0x12345678u;
+
+    for (unsigned int i = 0; i < frames; i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        float noise = (float)(state / 4294967295.0 * 2.0 - 1.0);
+        float sample = noise * (float)i / frames;
+        stereo[i * 2] = sample;
+        stereo[i * 2 + 1] = sample;
+    }
+}
+
+static const BenchSignal benchSignals[] = {
+    { "kick", GenerateKicks },
+    { "sweep", GenerateSweep },
+    { "noise", GenerateNoise },
+};
+#define BENCH_SIGNAL_COUNT ((int)(sizeof(benchSignals) / sizeof(benchSignals[0])))
+
+// '.', 'l', 'm', 'h' for NONE..HIGH; uppercase (or '!' at NONE) on a peak frame
+static char LevelChar(BassLevel level, bool peak) {
+    static const char quiet[] = ".lmh";
+    static const char loud[] = "!LMH";
+    return peak ? loud[level] : quiet[level];
+}
+
+static float* CreateSignal(const BenchSignal *signal) {
+    float *stereo = malloc(sizeof(float) * 2 * SIGNAL_FRAMES);
+    if (stereo) signal->generate(stereo, SIGNAL_FRAMES);
+    return stereo;
+}
+
+// Bass detector with the default thresholds and peaks on (ignores the user's config file)
+static BassConfig GoldenConfig(void) {
+    BassConfig config = {
+        BASS_THRESHOLD_LOW_DEFAULT, BASS_THRESHOLD_MEDIUM_DEFAULT, BASS_THRESHOLD_HIGH_DEFAULT,
+        PEAK_THRESHOLD_DEFAULT, 1
+    };
+    return config;
+}
+
+// Run the default analysis pipeline over a signal and record every frame
+static bool AnalyzeSignal(const float *stereo, BenchResult *result) {
+    memset(result, 0, sizeof(BenchResult));
+    AudioSTFTConfig stftConfig = audio_stftDefaultConfig();
+    int maxFrames = (int)(SIGNAL_FRAMES / stftConfig.hopSize) + 1;
+    BassConfig config = GoldenConfig();
+    BassDetector detector;
+    audio_detectorInit(&detector, &config, NULL, false);
+
+    AudioSTFT *stft = audio_stftCreate(&stftConfig);
+    detector.onsets = audio_onsetCreate(&stftConfig);
+    result->levels = malloc(maxFrames + 1);
+    if (!stft || !detector.onsets || !result->levels) {
+        audio_stftDestroy(stft);
+        audio_onsetDestroy(detector.onsets);
+        free(result->levels);
+        result->levels = NULL;
+        return false;
+    }
+
+    float spectrum[FFT_SIZE/2];
+    double frameTime;
+    for (unsigned int frame = 0; frame < SIGNAL_FRAMES; frame += FFT_SIZE) {
+        unsigned int count = SIGNAL_FRAMES - frame < FFT_SIZE ? SIGNAL_FRAMES - frame : FFT_SIZE;
+        audio_stftPush(stft, stereo + (size_t)frame * 2, count, 2);
+
+        while (audio_stftNextFrame(stft, spectrum, &frameTime) && result->frames < maxFrames) {
+            int peaks = detector.peakCount;
+            audio_detectorProcessFrame(&detector, spectrum, frameTime);
+            result->energySum += detector.bassEnergy;
+            result->levels[result->frames++] = LevelChar(detector.currentBassLevel, detector.peakCount > peaks);
+        }
+    }
+    result->levels[result->frames] = '\0';
+    result->bassEvents = detector.bassEventCount;
+    result->peaks = detector.peakCount;
+    result->onsets = detector.onsetCount;
+    result->beats = detector.beatCount;
+
+    audio_stftDestroy(stft);
+    audio_onsetDestroy(detector.onsets);
+    return true;
+}
+
+static const BenchGolden* FindGolden(const char *name) {
+    for (int i = 0; i < (int)(sizeof(benchGolden) / sizeof(benchGolden[0])); i++) {
+        if (benchGolden[i].name != NULL && strcmp(benchGolden[i].name, name) == 0) return &benchGolden[i];
+    }
+    return NULL;
+}
+
+// Compare with the golden output; prints the first differing frame
+static bool CheckGolden(const char *name, const BenchResult *result) {
+    const BenchGolden *golden = FindGolden(name);
+    if (golden == NULL) {
+        printf("%-8s no golden output (run --print-golden)  FAIL\n", name);
+        return false;
+    }
+
+    double energyError = fabs(result->energySum - golden->energySum) /
+                         (golden->energySum > 0.0 ? golden->energySum : 1.0);
+    int firstDifference = -1;
+    int goldenFrames = (int)strlen(golden->levels);
+    for (int i = 0; i < result->frames || i < goldenFrames; i++) {
+        if (i >= result->frames || i >= goldenFrames || result->levels[i] != golden->levels[i]) {
+            firstDifference = i;
+            break;
+        }
+    }
+
+    bool ok = firstDifference < 0 && result->bassEvents == golden->bassEvents &&
+              result->peaks == golden->peaks && result->onsets == golden->onsets &&
+              result->beats == golden->beats && energyError <= GOLDEN_ENERGY_TOLERANCE;
+
+    printf("%-8s %6d %7d/%-4d %5d/%-4d %6d/%-4d %6d/%-4d %10.2e%s\n", name, result->frames,
+           result->bassEvents, golden->bassEvents, result->peaks, golden->peaks,
+           result->onsets, golden->onsets, result->beats, golden->beats, energyError, ok ? "" : "  FAIL");
+
+    if (firstDifference >= 0) {
+        double hopSeconds = audio_stftDefaultConfig().hopSize / (double)SAMPLE_RATE;
+        printf("         first level difference at frame %d (%.2fs): got '%c', expected '%c'\n",
+               firstDifference, (firstDifference + 1) * hopSeconds,
+               firstDifference < result->frames ? result->levels[firstDifference] : '-',
+               firstDifference < goldenFrames ? golden->levels[firstDifference] : '-');
+    }
+    return ok;
+}
+
+static bool RunGolden(void) {
+    bool passed = true;
+
+    printf("\nGolden output (%d s signals, default thresholds, peaks enabled; got/expected)\n", SIGNAL_SECONDS);
+    printf("%-8s %6s %12s %10s %11s %11s %10s\n", "Signal", "Frames", "Bass events", "Peaks", "Onsets", "Beats", "Energy err");
+
+    for (int i = 0; i < BENCH_SIGNAL_COUNT; i++) {
+        float *stereo = CreateSignal(&benchSignals[i]);
+        BenchResult result;
+        if (stereo == NULL || !AnalyzeSignal(stereo, &result)) {
+            printf("Error: Out of memory analyzing %s\n", benchSignals[i].name);
+            free(stereo);
+            passed = false;
+            continue;
+        }
+        if (!CheckGolden(benchSignals[i].name, &result)) passed = false;
+        free(result.levels);
+        free(stereo);
+    }
+    return passed;
+}
+
+// Write audio_bench_golden.h for the current build to stdout
+static bool PrintGolden(void) {
+    printf("// Generated by `audio_bench --print-golden`: expected detector output for the\n");
+    printf("// synthetic signals in audio_bench.c. Only regenerate when a change to the\n");
+    printf("// analysis is meant to alter the level-sync data.\n");
+    printf("// Levels: '.' none, 'l' low, 'm' medium, 'h' high; uppercase / '!' = peak frame\n\n");
+    printf("static const BenchGolden benchGolden[] = {\n");
+
+    for (int i = 0; i < BENCH_SIGNAL_COUNT; i++) {
+        float *stereo = CreateSignal(&benchSignals[i]);
+        BenchResult result;
+        if (stereo == NULL || !AnalyzeSignal(stereo, &result)) {
+            fprintf(stderr, "Error: Out of memory analyzing %s\n", benchSignals[i].name);
+            free(stereo);
+            return false;
+        }
+
+        printf("    { \"%s\", %d, %d, %.6f, %d, %d,\n", benchSignals[i].name, result.bassEvents,
+               result.peaks, result.energySum, result.onsets, result.beats);
+        for (int start = 0; start < result.frames; start += GOLDEN_LINE_LENGTH) {
+            int length = result.frames - start < GOLDEN_LINE_LENGTH ? result.frames - start : GOLDEN_LINE_LENGTH;
+            printf("      \"%.*s\"%s\n", length, result.levels + start,
+                   start + GOLDEN_LINE_LENGTH >= result.frames ? " }," : "");
+        }
+        free(result.levels);
+        free(stereo);
+    }
+
+    printf("};\n");
+    return true;
+}
+
+static bool RunAccuracy(void) {
+    bool passed = true;
+
+    printf("\nAccuracy vs reference DFT (max error / max bin, tolerance %.0e)\n", ACCURACY_TOLERANCE);
+    printf("%8s %14s %14s %14s\n", "Size", "Plan", "Plan |X|", "audio_fft");
+
+    for (int size = ACCURACY_MIN_SIZE; size <= ACCURACY_MAX_SIZE; size *= 2) {
+        float *samples = malloc(sizeof(float) * size);
+        float *magnitude = malloc(sizeof(float) * (size / 2));
+        float complex *bins = malloc(sizeof(float complex) * (size / 2 + 1));
+        float complex *legacy = malloc(sizeof(float complex) * size);
+        double *refRe = malloc(sizeof(double) * (size / 2 + 1));
+        double *refIm = malloc(sizeof(double) * (size / 2 + 1));
+        AudioFFTPlan *plan = audio_fftPlanCreate(size);
+
+        if (!samples || !magnitude || !bins || !legacy || !refRe || !refIm || !plan) {
+            printf("Error: Out of memory at size %d\n", size);
+            passed = false;
+        } else {
+            FillSignal(samples, size, (unsigned int)size);
+            ReferenceDFT(samples, size, refRe, refIm);
+
+            audio_fftForward(plan, samples, bins);
+            double planError = RelativeError(bins, refRe, refIm, size / 2 + 1);
+
+            // Magnitude path: compare |X| only
+            audio_fftMagnitude(plan, samples, magnitude);
+            double maxError = 0.0, maxReference = 0.0;
+            for (int k = 0; k < size / 2; k++) {
+                double reference = hypot(refRe[k], refIm[k]);
+                double error = fabs(magnitude[k] - reference);
+                if (error > maxError) maxError = error;
+                if (reference > maxReference) maxReference = reference;
+            }
+            double magnitudeError = maxError / maxReference;
+
+            for (int i = 0; i < size; i++) legacy[i] = samples[i];
+            audio_fft(legacy, size);
+            double legacyError = RelativeError(legacy, refRe, refIm, size / 2 + 1);
+
+            bool ok = planError <= ACCURACY_TOLERANCE && magnitudeError <= ACCURACY_TOLERANCE;
+            printf("%8d %14.3e %14.3e %14.3e%s\n", size, planError, magnitudeError, legacyError,
+                   ok ? "" : "  FAIL");
+            if (!ok) passed = false;
+        }
+
+        audio_fftPlanDestroy(plan);
+        free(samples);
+        free(magnitude);
+        free(bins);
+        free(legacy);
+        free(refRe);
+        free(refIm);
+    }
+
+    return passed;
+}
+
+// Seconds of CPU time since start
+static double Elapsed(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static void RunThroughput(double seconds) {
+    printf("\nThroughput (kernel: %s, %.1fs per measurement)\n", audio_fftKernelName(), seconds);
+    printf("%8s %16s %16s %16s %9s\n", "Size", "audio_fft/s", "Plan/s", "Plan Msamples/s", "Speedup");
+
+    for (int size = THROUGHPUT_MIN_SIZE; size <= THROUGHPUT_MAX_SIZE; size *= 2) {
+        float *samples = malloc(sizeof(float) * size);
+        float *magnitude = malloc(sizeof(float) * (size / 2));
+        float complex *legacy = malloc(sizeof(float complex) * size);
+        AudioFFTPlan *plan = audio_fftPlanCreate(size);
+
+        if (!samples || !magnitude || !legacy || !plan) {
+            printf("Error: Out of memory at size %d\n", size);
+        } else {
+            FillSignal(samples, size, 1u);
+            volatile float sink = 0.0f;
+
+            // Legacy path includes the real-to-complex copy the analyzers used to do
+            long legacyCount = 0;
+            clock_t start = clock();
+            do {
+                for (int i = 0; i < size; i++) legacy[i] = samples[i];
+                audio_fft(legacy, size);
+                sink += crealf(legacy[1]);
+                legacyCount++;
+            } while (Elapsed(start) < seconds);
+            double legacyRate = legacyCount / Elapsed(start);
+
+            long planCount = 0;
+            start = clock();
+            do {
+                audio_fftMagnitude(plan, samples, magnitude);
+                sink += magnitude[1];
+                planCount++;
+            } while (Elapsed(start) < seconds);
+            double planRate = planCount / Elapsed(start);
+
+            (void)sink;
+            printf("%8d %16.0f %16.0f %16.1f %8.1fx\n", size, legacyRate, planRate,
+                   planRate * size / 1e6, planRate / legacyRate);
+        }
+
+        audio_fftPlanDestroy(plan);
+        free(samples);
+        free(magnitude);
+        free(legacy);
+    }
+}
+
+// STFT alone and STFT + detector over the kick signal, for several hops
+static void RunPipelineThroughput(double seconds) {
+    static const int hops[] = { 2048, 1024, 512, 256 };
+    BenchSignal signal = benchSignals[0];
+    float *stereo = CreateSignal(&signal);
+    if (stereo == NULL) {
+        printf("Error: Out of memory\n");
+        return;
+    }
+
+    printf("\nSTFT throughput (%d-sample frames, %s signal, %.1fs per measurement)\n",
+           FFT_SIZE, signal.name, seconds);
+    printf("%8s %14s %16s %16s %16s\n", "Hop", "Frames/s", "STFT Msamples/s", "+Detector Ms/s", "x realtime");
+
+    BassConfig config = GoldenConfig();
+    for (int h = 0; h < (int)(sizeof(hops) / sizeof(hops[0])); h++) {
+        AudioSTFTConfig stftConfig = audio_stftDefaultConfig();
+        stftConfig.hopSize = hops[h];
+        AudioSTFT *stft = audio_stftCreate(&stftConfig);
+        if (stft == NULL) continue;
+
+        float spectrum[FFT_SIZE/2];
+        double frameTime;
+        volatile float sink = 0.0f;
+        double rates[2];
+        double framesPerSecond = 0.0;
+
+        // Pass 0: STFT only, pass 1: STFT + bass detector (what the analyzers run)
+        for (int pass = 0; pass < 2; pass++) {
+            BassDetector detector;
+            audio_detectorInit(&detector, &config, NULL, false);
+            double samples = 0.0;
+            long frames = 0;
+            clock_t start = clock();
+            do {
+                audio_stftReset(stft, 0.0);
+                for (unsigned int frame = 0; frame < SIGNAL_FRAMES; frame += FFT_SIZE) {
+                    unsigned int count = SIGNAL_FRAMES - frame < FFT_SIZE ? SIGNAL_FRAMES - frame : FFT_SIZE;
+                    audio_stftPush(stft, stereo + (size_t)frame * 2, count, 2);
+                    while (audio_stftNextFrame(stft, spectrum, &frameTime)) {
+                        if (pass == 1) audio_detectorProcessFrame(&detector, spectrum, frameTime);
+                        sink += spectrum[1];
+                        frames++;
+                    }
+                }
+                samples += SIGNAL_FRAMES;
+            } while (Elapsed(start) < seconds);
+            double elapsed = Elapsed(start);
+            rates[pass] = samples / elapsed;
+            if (pass == 0) framesPerSecond = frames / elapsed;
+        }
+        (void)sink;
+
+        printf("%8d %14.0f %16.1f %16.1f %15.0fx\n", hops[h], framesPerSecond,
+               rates[0] / 1e6, rates[1] / 1e6, rates[1] / SAMPLE_RATE);
+        audio_stftDestroy(stft);
+    }
+    free(stereo);
+}
+
+static void PrintUsage(const char *programName) {
+    printf("Usage: %s [--accuracy] [--throughput] [--golden] [--seconds n] [--print-golden]\n", programName);
+    printf("  --accuracy      Only run the FFT accuracy check\n");
+    printf("  --throughput    Only run the FFT and STFT throughput benchmarks\n");
+    printf("  --golden        Only run the golden-output check\n");
+    printf("  --seconds n     Measuring time per kernel and size (default: %.1f)\n", DEFAULT_SECONDS);
+    printf("  --print-golden  Write audio_bench_golden.h for this build to stdout\n");
+}
+
+int main(int argc, char *argv[]) {
+    bool accuracy = true;
+    bool throughput = true;
+    bool golden = true;
+    double seconds = DEFAULT_SECONDS;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--accuracy") == 0) {
+            throughput = false;
+            golden = false;
+        } else if (strcmp(argv[i], "--throughput") == 0) {
+            accuracy = false;
+            golden = false;
+        } else if (strcmp(argv[i], "--golden") == 0) {
+            accuracy = false;
+            throughput = false;
+        } else if (strcmp(argv[i], "--print-golden") == 0) {
+            return PrintGolden() ? 0 : 1;
+        } else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            seconds = atof(argv[++i]);
+        } else {
+            PrintUsage(argv[0]);
+            return (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) ? 0 : 1;
+        }
+    }
+
+    printf("=== Audio Analysis Benchmark ===\n");
+    printf("FFT kernel: %s\n", audio_fftKernelName());
+
+    bool accuracyPassed = true;
+    bool goldenPassed = true;
+    if (accuracy) {
+        accuracyPassed = RunAccuracy();
+    }
+    if (golden) {
+        goldenPassed = RunGolden();
+    }
+    if (throughput) {
+        RunThroughput(seconds);
+        RunPipelineThroughput(seconds);
+    }
+
+    if (accuracy) {
+        printf("\n%s\n", accuracyPassed ? "All accuracy checks passed" : "ACCURACY CHECK FAILED");
+    }
+    if (golden) {
+        printf("%s%s\n", accuracy ? "" : "\n", goldenPassed ? "All golden outputs match" : "GOLDEN OUTPUT CHANGED");
+    }
+    return accuracyPassed && goldenPassed ? 0 : 1;
+}
@@ -0,0 +1,22 @@
+// Generated by `audio_bench --print-golden`: expected detector output for the
+// synthetic signals in audio_bench.c. Only regenerate when a change to the
+// analysis is meant to alter the level-sync data.
+// Levels: '.' none, 'l' low, 'm' medium, 'h' high; uppercase / '!' = peak frame
+
+static const BenchGolden benchGolden[] = {
+    { "kick", 3, 5, 87.013413, 38, 17,
+      "llmmmhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhmmmmmmmmmmmmmmmmmmmm"
+      "mmmmmmmmmmmmmmmmmmmmmmmlllllllllllLlllllllllll.lllllllllllllllll"
+      "lll.........!..........!..........!.........lLmmmhhhhhhhhhhhhhhh"
+      "hhhhhhhhhhhhhhhhhhhhhhh" },
+    { "sweep", 1, 0, 17.853169, 57, 15,
+      "..................llllllllllllllllllllllllllllllllllllllllllllll"
+      "llllllllllllllllllllllllllllll.................................."
+      "................................................................"
+      "......................." },
+    { "noise", 0, 4, 3.061172, 12, 21,
+      "................................................................"
+      "..............................................................!."
+      "..............!..............................!.................."
+      "..........!............" },
+};
@@ -5,8 +5,8 @@
 #include <math.h>
 #include <string.h>
 
-#define SPRITE_SIZE 64
-#define SPRITES_PER_ROW 5
+#define SPRITE_SIZE ENEMY_SPRITE_SIZE
+#define SPRITES_PER_ROW ENEMY_SPRITES_PER_ROW
 #define SHEET_WIDTH (SPRITE_SIZE * SPRITES_PER_ROW)
 #define SHEET_HEIGHT (SPRITE_SIZE * 2)  // 2 rows for 10 enemies
 
@@ -21,8 +21,7 @@ void DrawEnemySprite(RenderTexture2D* target, EnemyType type, int gridX, int gri
     float centerY = gridY * SPRITE_SIZE + SPRITE_SIZE / 2.0f;
     
     // Base radius scaled to fit in sprite
-    float baseRadius = (SPRITE_SIZE * 0.35f) * def->size;
-    if (baseRadius > SPRITE_SIZE * 0.45f) baseRadius = SPRITE_SIZE * 0.45f;
+    float baseRadius = GetEnemySpriteRadius(type);
     
     // Draw based on enemy type
     switch (type) {
@@ -256,9 +255,6 @@ int main(void) {
     InitWindow(SHEET_WIDTH, SHEET_HEIGHT, "Enemy Sprite Generator");
     SetTargetFPS(60);
     
-    // Initialize enemy types
-    InitEnemyTypes();
-    
     // Create render texture for sprite sheet
     RenderTexture2D spriteSheet = LoadRenderTexture(SHEET_WIDTH, SHEET_HEIGHT);
     
@@ -321,8 +317,8 @@ int main(void) {
     // Export the complete sprite sheet
     Image spriteSheetImg = LoadImageFromTexture(spriteSheet.texture);
     ImageFlipVertical(&spriteSheetImg);  // Flip because render textures are upside down
-    ExportImage(spriteSheetImg, "assets/sprites/enemy_spritesheet.png");
-    printf("\nSaved complete sprite sheet to assets/sprites/enemy_spritesheet.png\n");
+    ExportImage(spriteSheetImg, ENEMY_SPRITESHEET_PATH);
+    printf("\nSaved complete sprite sheet to %s\n", ENEMY_SPRITESHEET_PATH);
     printf("Sprite sheet dimensions: %dx%d\n", SHEET_WIDTH, SHEET_HEIGHT);
     printf("Individual sprite size: %dx%d\n", SPRITE_SIZE, SPRITE_SIZE);
     
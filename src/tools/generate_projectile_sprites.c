@@ -203,9 +203,6 @@ int main(void) {
     InitWindow(SHEET_WIDTH, SHEET_HEIGHT, "Projectile Sprite Generator");
     SetTargetFPS(60);
     
-    // Initialize projectile types
-    InitProjectileTypes();
-    
     // Create render texture for sprite sheet
     RenderTexture2D spriteSheet = LoadRenderTexture(SHEET_WIDTH, SHEET_HEIGHT);
     
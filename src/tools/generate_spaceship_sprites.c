@@ -490,9 +490,6 @@ int main(void) {
     InitWindow(SHEET_WIDTH, SHEET_HEIGHT, "Spaceship Enemy Sprite Generator");
     SetTargetFPS(60);
     
-    // Initialize enemy types
-    InitEnemyTypes();
-    
     // Create render texture for sprite sheet
     RenderTexture2D spriteSheet = LoadRenderTexture(SHEET_WIDTH, SHEET_HEIGHT);
     
@@ -0,0 +1,195 @@
+/**
+ * Asset Packer
+ *
+ * Builds a single asset archive (see include/asset_pack.h) from one or more
+ * directories, so the game opens one file at startup instead of every JSON,
+ * sprite and music file individually.
+ *
+ * Usage:
+ *   pack_assets [-o output.pak] [dir ...]   Pack directories (default: assets)
+ *   pack_assets --verify file.pak           Check every entry's hash
+ *   pack_assets --list file.pak             List packed files
+ */
+
+#include "raylib.h"
+#include "asset_pack.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_PACK_DIRS 16
+
+static uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+static int CompareEntryPath(const void* a, const void* b) {
+    return strcmp(((const AssetPackEntry*)a)->path, ((const AssetPackEntry*)b)->path);
+}
+
+// Read a whole file without going through raylib (no pack callbacks involved)
+static unsigned char* ReadWholeFile(const char* path, uint64_t* size) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return NULL;
+
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (length < 0) {
+        fclose(file);
+        return NULL;
+    }
+
+    unsigned char* data = (unsigned char*)malloc(length + 1);
+    if (data) {
+        *size = fread(data, 1, length, file);
+    }
+    fclose(file);
+    return data;
+}
+
+static int ListPack(const char* packPath, bool verify) {
+    if (!AssetPack_Mount(packPath, false)) {
+        fprintf(stderr, "Failed to open pack: %s\n", packPath);
+        return 1;
+    }
+
+    int corrupt = 0;
+    if (verify) {
+        corrupt = AssetPack_Verify();
+        printf("%s: %s\n", packPath, corrupt == 0 ? "OK" : "CORRUPT");
+    } else {
+        for (int i = 0; i < AssetPack_GetEntryCount(); i++) {
+            const AssetPackEntry* entry = AssetPack_GetEntry(i);
+            printf("%10llu  %016llx  %s\n", (unsigned long long)entry->size,
+                   (unsigned long long)entry->hash, entry->path);
+        }
+    }
+
+    AssetPack_Unmount();
+    return corrupt == 0 ? 0 : 2;
+}
+
+int main(int argc, char* argv[]) {
+    const char* outputPath = ASSET_PACK_DEFAULT;
+    const char* dirs[MAX_PACK_DIRS];
+    int dirCount = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            outputPath = argv[++i];
+        } else if (strcmp(argv[i], "--verify") == 0 && i + 1 < argc) {
+            return ListPack(argv[i + 1], true);
+        } else if (strcmp(argv[i], "--list") == 0 && i + 1 < argc) {
+            return ListPack(argv[i + 1], false);
+        } else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
+            printf("Usage: %s [-o output.pak] [dir ...]\n", argv[0]);
+            printf("       %s --verify file.pak\n", argv[0]);
+            printf("       %s --list file.pak\n", argv[0]);
+            return 0;
+        } else if (dirCount < MAX_PACK_DIRS) {
+            dirs[dirCount++] = argv[i];
+        }
+    }
+    if (dirCount == 0) {
+        dirs[dirCount++] = "assets";
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    // Collect files
+    int capacity = 0;
+    for (int d = 0; d < dirCount; d++) {
+        FilePathList files = LoadDirectoryFilesEx(dirs[d], NULL, true);
+        capacity += files.count;
+        UnloadDirectoryFiles(files);
+    }
+
+    AssetPackEntry* entries = (AssetPackEntry*)calloc(capacity > 0 ? capacity : 1, sizeof(AssetPackEntry));
+    if (!entries) {
+        fprintf(stderr, "Failed to allocate index for %d files\n", capacity);
+        return 1;
+    }
+
+    int entryCount = 0;
+    for (int d = 0; d < dirCount; d++) {
+        FilePathList files = LoadDirectoryFilesEx(dirs[d], NULL, true);
+        for (unsigned int f = 0; f < files.count && entryCount < capacity; f++) {
+            const char* path = files.paths[f];
+            while (path[0] == '.' && (path[1] == '/' || path[1] == '\\')) path += 2;
+
+            if (strlen(path) >= ASSET_PACK_PATH_MAX) {
+                fprintf(stderr, "Skipping (path too long): %s\n", path);
+                continue;
+            }
+            if (strcmp(path, outputPath) == 0) continue;  // Never pack the pack
+
+            AssetPackEntry* entry = &entries[entryCount++];
+            for (int c = 0; path[c]; c++) {
+                entry->path[c] = (path[c] == '\\') ? '/' : path[c];
+            }
+        }
+        UnloadDirectoryFiles(files);
+    }
+
+    // Sorted index enables binary search at runtime
+    qsort(entries, entryCount, sizeof(AssetPackEntry), CompareEntryPath);
+
+    AssetPackHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, ASSET_PACK_MAGIC, 4);
+    header.version = ASSET_PACK_VERSION;
+    header.entryCount = (uint32_t)entryCount;
+    header.alignment = ASSET_PACK_ALIGNMENT;
+    header.indexOffset = sizeof(AssetPackHeader);
+    header.dataOffset = AlignUp(header.indexOffset + (uint64_t)entryCount * sizeof(AssetPackEntry),
+                                ASSET_PACK_ALIGNMENT);
+
+    FILE* out = fopen(outputPath, "wb");
+    if (!out) {
+        fprintf(stderr, "Failed to create %s\n", outputPath);
+        free(entries);
+        return 1;
+    }
+
+    // Data first (index is written once offsets and hashes are known)
+    static const unsigned char padding[ASSET_PACK_ALIGNMENT] = { 0 };
+    uint64_t offset = header.dataOffset;
+    uint64_t totalBytes = 0;
+    fseek(out, (long)offset, SEEK_SET);
+
+    for (int i = 0; i < entryCount; i++) {
+        AssetPackEntry* entry = &entries[i];
+        uint64_t size = 0;
+        unsigned char* data = ReadWholeFile(entry->path, &size);
+        if (!data) {
+            fprintf(stderr, "Failed to read %s\n", entry->path);
+            fclose(out);
+            free(entries);
+            return 1;
+        }
+
+        entry->offset = offset;
+        entry->size = size;
+        entry->hash = AssetPack_Hash(data, size);
+        fwrite(data, 1, size, out);
+        free(data);
+
+        uint64_t aligned = AlignUp(offset + size, ASSET_PACK_ALIGNMENT);
+        fwrite(padding, 1, aligned - (offset + size), out);
+        offset = aligned;
+        totalBytes += size;
+
+        printf("  %-60s %10llu bytes\n", entry->path, (unsigned long long)size);
+    }
+
+    fseek(out, 0, SEEK_SET);
+    fwrite(&header, sizeof(header), 1, out);
+    fwrite(entries, sizeof(AssetPackEntry), entryCount, out);
+    fclose(out);
+    free(entries);
+
+    printf("\nPacked %d files (%.1f KB) into %s (%.1f KB)\n",
+           entryCount, totalBytes / 1024.0, outputPath, offset / 1024.0);
+    return 0;
+}
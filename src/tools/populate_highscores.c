@@ -1,8 +1,46 @@
+/**
+ * High Score Populator
+ *
+ * Fills the high score table with the legendary developer presets (the game
+ * does this itself on a fresh database). --force clears every stored score
+ * first.
+ *
+ * --seed n inserts n synthetic scores spread over five years of play, in
+ * transactions of SEED_BATCH_SIZE rows, then times the leaderboard queries
+ * the menus use (rank, page, neighbors, the cached top-N and DB_Init) and
+ * prints their latency percentiles. Seeding goes to SEED_DEFAULT_PATH
+ * unless --db is given, so the player's own scores are left alone.
+ *
+ * Usage: populate_highscores [--force] [--db path]
+ *        populate_highscores --seed n [--db path]
+ */
+
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L   // clock_gettime under -std=c99
+#endif
+
 #include "database.h"
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <time.h>
 
+#ifdef _WIN32
+    #include <windows.h>
+#endif
+
+#define SEED_DEFAULT_PATH "leaderboard_bench.db"
+#define SEED_BATCH_SIZE 10000           // Rows per transaction
+#define SEED_MAX_SCORE 100000
+#define SEED_HISTORY_SECONDS (5L * 365 * 24 * 60 * 60)
+#define BENCH_QUERIES 2000              // Timed calls per query type
+#define BENCH_STARTUPS 5                // Timed DB_Init calls
+#define BENCH_PAGE_SIZE 10
+#define BENCH_NEIGHBOR_RADIUS 5
+
+static const char* DIFFICULTY_NAMES[] = {"EASY", "NORMAL", "HARD", "INSANE"};
+
 // High score presets based on legendary game developers
 typedef struct {
     const char* name;
@@ -62,18 +100,238 @@ static const HighScorePreset PRESETS[] = {
 
 static const int PRESET_COUNT = sizeof(PRESETS) / sizeof(PRESETS[0]);
 
+static uint32_t rngState = 0x9E3779B9u;
+
+// xorshift32: fast and reproducible, plenty for synthetic scores
+static uint32_t NextRandom(void) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+// Uniform in [0, 1)
+static double NextUnit(void) {
+    return (NextRandom() >> 8) / 16777216.0;
+}
+
+static double NowMilliseconds(void) {
+#ifdef _WIN32
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000.0 + now.tv_nsec / 1000000.0;
+#endif
+}
+
+// Most players score low: squaring a uniform value skews the scores toward zero
+static int RandomScore(void) {
+    double u = NextUnit();
+    return (int)(u * u * SEED_MAX_SCORE);
+}
+
+static int CompareDoubles(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// Sort the samples and print one latency row
+static void PrintLatency(const char* name, double* samples, int count) {
+    qsort(samples, count, sizeof(double), CompareDoubles);
+    printf("  %-24s %9.3f %9.3f %9.3f %9.3f\n", name,
+           samples[count * 50 / 100], samples[count * 95 / 100], samples[count * 99 / 100], samples[count - 1]);
+}
+
+static void PrintScoreCounts(void) {
+    printf("\nScores per difficulty:\n");
+    for (int diff = 0; diff < DIFFICULTY_COUNT; diff++) {
+        HighScoreEntry top;
+        int count = 0;
+        
+        if (DB_GetHighScores((DifficultyLevel)diff, &top, 1, &count)) {
+            printf("  %s: %d scores (top: %d pts by %s)\n", 
+                   DIFFICULTY_NAMES[diff], 
+                   DB_GetHighScoreCount((DifficultyLevel)diff),
+                   count > 0 ? top.score : 0,
+                   count > 0 ? top.playerName : "N/A");
+        }
+    }
+}
+
+// Insert synthetic scores in batched transactions
+static bool SeedScores(long rows) {
+    HighScoreEntry* batch = (HighScoreEntry*)calloc(SEED_BATCH_SIZE, sizeof(HighScoreEntry));
+    if (!batch) {
+        fprintf(stderr, "❌ Out of memory\n");
+        return false;
+    }
+    
+    printf("Seeding %ld synthetic scores (%d per transaction)...\n", rows, SEED_BATCH_SIZE);
+    
+    long now = (long)time(NULL);
+    long inserted = 0;
+    double startTime = NowMilliseconds();
+    
+    while (inserted < rows) {
+        int count = rows - inserted < SEED_BATCH_SIZE ? (int)(rows - inserted) : SEED_BATCH_SIZE;
+        for (int i = 0; i < count; i++) {
+            HighScoreEntry* entry = &batch[i];
+            snprintf(entry->playerName, sizeof(entry->playerName), "pilot%06u", NextRandom() % 1000000u);
+            entry->score = RandomScore();
+            entry->difficulty = (DifficultyLevel)(NextRandom() % DIFFICULTY_COUNT);
+            entry->timestamp = now - (long)(NextUnit() * SEED_HISTORY_SECONDS);
+        }
+        
+        if (!DB_ImportHighScores(batch, count)) {
+            fprintf(stderr, "❌ Seeding failed after %ld rows\n", inserted);
+            free(batch);
+            return false;
+        }
+        inserted += count;
+    }
+    
+    double seconds = (NowMilliseconds() - startTime) / 1000.0;
+    printf("✓ Inserted %ld rows in %.2f s (%.0f rows/s)\n", inserted, seconds, seconds > 0.0 ? inserted / seconds : 0.0);
+    
+    free(batch);
+    return true;
+}
+
+// Time every leaderboard query against random scores, pages and difficulties
+static bool BenchmarkQueries(void) {
+    double* samples = (double*)malloc(sizeof(double) * BENCH_QUERIES);
+    if (!samples) {
+        fprintf(stderr, "❌ Out of memory\n");
+        return false;
+    }
+    
+    int totals[DIFFICULTY_COUNT];
+    for (int diff = 0; diff < DIFFICULTY_COUNT; diff++) {
+        totals[diff] = DB_GetHighScoreCount((DifficultyLevel)diff);
+    }
+    
+    HighScoreEntry entries[2 * BENCH_NEIGHBOR_RADIUS + 1];
+    int count = 0;
+    int extra = 0;
+    
+    printf("\nQuery latency over %d calls (ms):\n", BENCH_QUERIES);
+    printf("  %-24s %9s %9s %9s %9s\n", "Query", "p50", "p95", "p99", "max");
+    
+    for (int i = 0; i < BENCH_QUERIES; i++) {
+        DifficultyLevel diff = (DifficultyLevel)(NextRandom() % DIFFICULTY_COUNT);
+        int score = RandomScore();
+        double start = NowMilliseconds();
+        DB_GetScoreRank(score, diff);
+        samples[i] = NowMilliseconds() - start;
+    }
+    PrintLatency("DB_GetScoreRank", samples, BENCH_QUERIES);
+    
+    for (int i = 0; i < BENCH_QUERIES; i++) {
+        DifficultyLevel diff = (DifficultyLevel)(NextRandom() % DIFFICULTY_COUNT);
+        int pages = (totals[diff] + BENCH_PAGE_SIZE - 1) / BENCH_PAGE_SIZE;
+        int page = pages > 0 ? (int)(NextRandom() % (uint32_t)pages) : 0;
+        double start = NowMilliseconds();
+        DB_GetHighScorePage(diff, page, BENCH_PAGE_SIZE, entries, &count, &extra);
+        samples[i] = NowMilliseconds() - start;
+    }
+    PrintLatency("DB_GetHighScorePage", samples, BENCH_QUERIES);
+    
+    for (int i = 0; i < BENCH_QUERIES; i++) {
+        DifficultyLevel diff = (DifficultyLevel)(NextRandom() % DIFFICULTY_COUNT);
+        int score = RandomScore();
+        double start = NowMilliseconds();
+        DB_GetHighScoreNeighbors(score, diff, BENCH_NEIGHBOR_RADIUS, entries,
+                                 2 * BENCH_NEIGHBOR_RADIUS + 1, &count, &extra);
+        samples[i] = NowMilliseconds() - start;
+    }
+    PrintLatency("DB_GetHighScoreNeighbors", samples, BENCH_QUERIES);
+    
+    for (int i = 0; i < BENCH_QUERIES; i++) {
+        DifficultyLevel diff = (DifficultyLevel)(NextRandom() % DIFFICULTY_COUNT);
+        double start = NowMilliseconds();
+        DB_GetHighScores(diff, entries, DB_HIGH_SCORES_PER_DIFFICULTY, &count);
+        samples[i] = NowMilliseconds() - start;
+    }
+    PrintLatency("DB_GetHighScores", samples, BENCH_QUERIES);
+    
+    for (int i = 0; i < BENCH_QUERIES; i++) {
+        DifficultyLevel diff = (DifficultyLevel)(NextRandom() % DIFFICULTY_COUNT);
+        int score = RandomScore();
+        double start = NowMilliseconds();
+        DB_IsHighScore(score, diff);
+        samples[i] = NowMilliseconds() - start;
+    }
+    PrintLatency("DB_IsHighScore", samples, BENCH_QUERIES);
+    
+    // Startup reloads the cached leaderboards from the full table
+    double startups[BENCH_STARTUPS];
+    for (int i = 0; i < BENCH_STARTUPS; i++) {
+        DB_Cleanup();
+        double start = NowMilliseconds();
+        if (!DB_Init()) {
+            fprintf(stderr, "❌ Failed to reopen database!\n");
+            free(samples);
+            return false;
+        }
+        startups[i] = NowMilliseconds() - start;
+    }
+    printf("\nStartup latency over %d opens (ms):\n", BENCH_STARTUPS);
+    PrintLatency("DB_Init", startups, BENCH_STARTUPS);
+    
+    free(samples);
+    return true;
+}
+
+static void PrintUsage(const char* program) {
+    printf("Usage: %s [--force] [--db path]\n", program);
+    printf("       %s --seed n [--db path]\n\n", program);
+    printf("  --force     Clear every stored score and restore the presets\n");
+    printf("  --db path   Database file (default: the game's database; %s with --seed)\n", SEED_DEFAULT_PATH);
+    printf("  --seed n    Insert n synthetic scores and report query latency percentiles\n");
+}
+
 int main(int argc, char* argv[]) {
     bool force = false;
+    long seedRows = 0;
+    const char* path = NULL;
     
-    // Check for --force flag
-    if (argc > 1 && strcmp(argv[1], "--force") == 0) {
-        force = true;
-        printf("⚠️  Force mode enabled - will clear existing scores\n\n");
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--force") == 0) {
+            force = true;
+        } else if (strcmp(argv[i], "--db") == 0 && i + 1 < argc) {
+            path = argv[++i];
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seedRows = strtol(argv[++i], NULL, 10);
+            if (seedRows <= 0) {
+                fprintf(stderr, "❌ --seed needs a positive row count\n");
+                return 1;
+            }
+        } else {
+            PrintUsage(argv[0]);
+            return strcmp(argv[i], "--help") == 0 ? 0 : 1;
+        }
+    }
+    
+    if (seedRows > 0 && !path) {
+        path = SEED_DEFAULT_PATH;
+    }
+    if (path && !DB_SetDatabasePath(path)) {
+        fprintf(stderr, "❌ Invalid database path: %s\n", path);
+        return 1;
     }
     
     printf("🎮 HIGH SCORE PRESET POPULATOR 🎮\n");
     printf("===================================\n\n");
     
+    if (force) {
+        printf("⚠️  Force mode enabled - will clear existing scores\n\n");
+    }
+    
     // Initialize database
     printf("Initializing database...\n");
     if (!DB_Init()) {
@@ -82,88 +340,85 @@ int main(int argc, char* argv[]) {
     }
     printf("✓ Database: %s\n\n", DB_GetDatabasePath());
     
+    if (force) {
+        printf("Clearing existing high scores...\n");
+        if (!DB_ClearHighScores()) {
+            fprintf(stderr, "❌ Failed to clear high scores!\n");
+            DB_Cleanup();
+            return 1;
+        }
+    }
+    
+    if (seedRows > 0) {
+        bool ok = SeedScores(seedRows);
+        if (ok) {
+            PrintScoreCounts();
+            ok = BenchmarkQueries();
+        }
+        DB_Cleanup();
+        return ok ? 0 : 1;
+    }
+    
     // Check if scores already exist
     if (!force) {
         for (int diff = 0; diff < DIFFICULTY_COUNT; diff++) {
-            HighScoreEntry entries[1];
-            int count = 0;
-            
-            if (DB_GetHighScores((DifficultyLevel)diff, entries, 1, &count) && count > 0) {
+            if (DB_GetHighScoreCount((DifficultyLevel)diff) > 0) {
                 printf("⚠️  High scores already exist in database!\n");
                 printf("   Use --force to clear and repopulate.\n\n");
                 
                 // Show current scores count per difficulty
-                const char* diffNames[] = {"EASY", "NORMAL", "HARD", "INSANE"};
                 for (int d = 0; d < DIFFICULTY_COUNT; d++) {
-                    if (DB_GetHighScores((DifficultyLevel)d, entries, 10, &count)) {
-                        printf("   %s: %d scores\n", diffNames[d], count);
-                    }
+                    printf("   %s: %d scores\n", DIFFICULTY_NAMES[d], DB_GetHighScoreCount((DifficultyLevel)d));
                 }
                 
                 DB_Cleanup();
                 return 0;
             }
         }
-    } else {
-        // Clear existing scores if force mode
-        printf("Clearing existing high scores...\n");
-        // Note: SQLite doesn't have a TRUNCATE, so we'll just let DB_AddHighScore
-        // clean up old entries when adding new ones
     }
     
-    // Populate presets
+    // Populate presets (one transaction)
     printf("Populating legendary developer high scores...\n\n");
     
-    const char* difficultyNames[] = {"EASY", "NORMAL", "HARD", "INSANE"};
-    int successCount = 0;
-    int failCount = 0;
+    HighScoreEntry entries[sizeof(PRESETS) / sizeof(PRESETS[0])];
+    memset(entries, 0, sizeof(entries));
+    for (int i = 0; i < PRESET_COUNT; i++) {
+        strncpy(entries[i].playerName, PRESETS[i].name, sizeof(entries[i].playerName) - 1);
+        entries[i].score = PRESETS[i].score;
+        entries[i].difficulty = PRESETS[i].difficulty;
+    }
     
+    bool imported = DB_ImportHighScores(entries, PRESET_COUNT);
     for (int i = 0; i < PRESET_COUNT; i++) {
         const HighScorePreset* preset = &PRESETS[i];
-        
-        // Add small time offset to each entry for realistic timestamps
-        // (simulate scores being achieved at different times)
-        
-        if (DB_AddHighScore(preset->name, preset->score, preset->difficulty)) {
+        if (imported) {
             printf("  ✓ [%8s] %15s - %6d pts\n", 
-                   difficultyNames[preset->difficulty], 
+                   DIFFICULTY_NAMES[preset->difficulty], 
                    preset->name, 
                    preset->score);
-            successCount++;
         } else {
             printf("  ✗ [%8s] %15s - Failed\n", 
-                   difficultyNames[preset->difficulty], 
+                   DIFFICULTY_NAMES[preset->difficulty], 
                    preset->name);
-            failCount++;
         }
     }
     
     printf("\n===================================\n");
     printf("Summary:\n");
-    printf("  ✓ Successfully added: %d scores\n", successCount);
-    if (failCount > 0) {
-        printf("  ✗ Failed: %d scores\n", failCount);
+    if (imported) {
+        printf("  ✓ Successfully added: %d scores\n", PRESET_COUNT);
+    } else {
+        printf("  ✗ Failed: %d scores\n", PRESET_COUNT);
     }
     
-    // Show final counts per difficulty
-    printf("\nScores per difficulty:\n");
-    for (int diff = 0; diff < DIFFICULTY_COUNT; diff++) {
-        HighScoreEntry entries[10];
-        int count = 0;
-        
-        if (DB_GetHighScores((DifficultyLevel)diff, entries, 10, &count)) {
-            printf("  %s: %d scores (top: %d pts by %s)\n", 
-                   difficultyNames[diff], 
-                   count,
-                   count > 0 ? entries[0].score : 0,
-                   count > 0 ? entries[0].playerName : "N/A");
-        }
-    }
+    PrintScoreCounts();
     
     DB_Cleanup();
+    if (!imported) {
+        return 1;
+    }
     printf("\n✓ Database populated successfully!\n");
     printf("===================================\n\n");
     
     return 0;
 }
-
@@ -2,6 +2,7 @@
 #include "constants.h"
 #include "database.h"
 #include <math.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 
@@ -88,6 +89,36 @@ static bool MenuInput_Back(void) {
            (IsGamepadAvailable(0) && IsGamepadButtonPressed(0, GAMEPAD_BUTTON_RIGHT_FACE_RIGHT));  // B button
 }
 
+static bool MenuInput_Stats(void) {
+    return IsKeyPressed(KEY_TAB) || 
+           (IsGamepadAvailable(0) && IsGamepadButtonPressed(0, GAMEPAD_BUTTON_RIGHT_FACE_UP));  // Y button
+}
+
+// Run statistics screen data, queried once each time the screen opens (not per frame)
+typedef struct {
+    bool loaded;
+    DBRunTotals totals;
+    DBRunEnemyStats enemies[DB_RUN_MAX_ENEMY_TYPES];
+    int enemyCount;
+    DBRunPowerupStats powerups[DB_RUN_MAX_POWERUP_TYPES];
+    int powerupCount;
+    DBRunPhaseStats phases[DB_RUN_MAX_PHASES];
+    int phaseCount;
+    DBRunRecord lastRun;
+    int recentCount;
+} RunStatsView;
+
+static RunStatsView runStats;
+
+static void LoadRunStats(void) {
+    memset(&runStats, 0, sizeof(runStats));
+    runStats.loaded = DB_GetRunTotals(&runStats.totals) &&
+                      DB_GetEnemyTypeStats(runStats.enemies, DB_RUN_MAX_ENEMY_TYPES, &runStats.enemyCount) &&
+                      DB_GetPowerupStats(runStats.powerups, DB_RUN_MAX_POWERUP_TYPES, &runStats.powerupCount) &&
+                      DB_GetPhaseStats(runStats.phases, DB_RUN_MAX_PHASES, &runStats.phaseCount) &&
+                      DB_GetRecentRuns(&runStats.lastRun, 1, &runStats.recentCount);
+}
+
 // Note: Input detection now uses InputManager_DetectInput() to avoid duplication
 
 // Available resolutions
@@ -171,6 +202,8 @@ void InitMenu(Menu* menu) {
     menu->nameLength = 0;
     menu->pendingScore = 0;
     menu->pendingDifficulty = 0;
+    memset(&menu->pendingReplayInfo, 0, sizeof(DBReplayInfo));
+    menu->pendingReplayData = NULL;
     menu->nameInputActive = false;
     menu->nameInputBlink = 0.0f;
     
@@ -616,6 +649,13 @@ void UpdateMenu(Menu* menu, MenuState* gameState) {
                 }
             }
             
+            // TAB / Y button shows the run statistics
+            if (MenuInput_Stats()) {
+                LoadRunStats();
+                menu->currentState = MENU_RUN_STATS;
+                break;
+            }
+            
             // Go back with ESC, Backspace, Enter or Space
             if (MenuInput_Back() || MenuInput_Select()) {
                 menu->currentState = MENU_MAIN;
@@ -623,6 +663,13 @@ void UpdateMenu(Menu* menu, MenuState* gameState) {
             }
             break;
             
+        case MENU_RUN_STATS:
+            // Back to the high scores with TAB / Y again, ESC, Backspace, Enter or Space
+            if (MenuInput_Stats() || MenuInput_Back() || MenuInput_Select()) {
+                menu->currentState = MENU_HIGH_SCORES;
+            }
+            break;
+            
         case MENU_NAME_INPUT: {
             // Handle text input
             int key = GetCharPressed();
@@ -733,6 +780,9 @@ void DrawMenu(const Menu* menu) {
         case MENU_HIGH_SCORES:
             DrawHighScores((Menu*)menu);
             break;
+        case MENU_RUN_STATS:
+            DrawRunStats(menu);
+            break;
         case MENU_NAME_INPUT:
             DrawNameInput((Menu*)menu);
             break;
@@ -1035,7 +1085,7 @@ void DrawHighScores(Menu* menu) {
     DrawText(currentDifficulty, difficultyX, difficultyY, difficultySize, difficultyColors[menu->selectedDifficulty]);
     DrawText(">", difficultyX + difficultyWidth + 10 + arrowOffset, difficultyY, difficultySize, WHITE);
     
-    // Load high scores from database for selected difficulty
+    // High scores for selected difficulty (in-memory cache, no database query per frame)
     HighScoreEntry entries[10];
     int count = 0;
     
@@ -1101,6 +1151,134 @@ void DrawHighScores(Menu* menu) {
         DrawText(errorText, (screenWidth - errorWidth) / 2, 
                 screenHeight / 2, errorSize, RED);
     }
+    
+    // Hint for the run statistics screen
+    const char* hintText = "TAB / Y: Run statistics";
+    int hintSize = 16;
+    int hintWidth = MeasureText(hintText, hintSize);
+    DrawText(hintText, (screenWidth - hintWidth) / 2, screenHeight - 40, hintSize, (Color){150, 150, 150, 255});
+}
+
+// Format seconds as h:mm:ss (or m:ss under an hour)
+static void FormatPlayTime(char* buffer, size_t size, float seconds) {
+    int total = (int)seconds;
+    if (total >= 3600) {
+        snprintf(buffer, size, "%d:%02d:%02d", total / 3600, (total / 60) % 60, total % 60);
+    } else {
+        snprintf(buffer, size, "%d:%02d", total / 60, total % 60);
+    }
+}
+
+void DrawRunStats(const Menu* menu) {
+    (void)menu;
+    int screenWidth = GetScreenWidth();
+    int screenHeight = GetScreenHeight();
+    
+    // Draw background
+    DrawRectangleGradientV(0, 0, screenWidth, screenHeight, 
+                           (Color){10, 10, 30, 255}, (Color){30, 10, 60, 255});
+    
+    // Draw title
+    const char* title = "RUN STATISTICS";
+    int titleSize = 45;
+    int titleWidth = MeasureText(title, titleSize);
+    DrawText(title, (screenWidth - titleWidth) / 2, 60, titleSize, WHITE);
+    
+    Color labelColor = (Color){180, 180, 180, 255};
+    
+    if (!runStats.loaded) {
+        const char* errorText = "Error loading run statistics";
+        int errorSize = 20;
+        int errorWidth = MeasureText(errorText, errorSize);
+        DrawText(errorText, (screenWidth - errorWidth) / 2, screenHeight / 2, errorSize, RED);
+        return;
+    }
+    
+    const DBRunTotals* totals = &runStats.totals;
+    if (totals->runCount == 0) {
+        const char* emptyText = "No runs recorded yet. Start playing!";
+        int emptySize = 22;
+        int emptyWidth = MeasureText(emptyText, emptySize);
+        DrawText(emptyText, (screenWidth - emptyWidth) / 2, 
+                screenHeight / 2, emptySize, (Color){150, 150, 150, 255});
+        return;
+    }
+    
+    // Totals
+    char playTime[32], longest[32], line[192];
+    FormatPlayTime(playTime, sizeof(playTime), totals->totalPlayTime);
+    FormatPlayTime(longest, sizeof(longest), totals->longestRun);
+    
+    snprintf(line, sizeof(line), "Runs: %d    Victories: %d    Deaths: %d    Abandoned: %d",
+             totals->runCount, totals->victories, totals->deaths, totals->abandoned);
+    DrawText(line, (screenWidth - MeasureText(line, 18)) / 2, 120, 18, WHITE);
+    
+    snprintf(line, sizeof(line), "Best: %d    Average: %.0f    Play time: %s    Longest run: %s    Frame p99: %.1f ms",
+             totals->bestScore, totals->averageScore, playTime, longest, totals->averageFrameTimeP99);
+    DrawText(line, (screenWidth - MeasureText(line, 18)) / 2, 148, 18, labelColor);
+    
+    int headerY = 195;
+    int headerSize = 20;
+    int entrySize = 16;
+    int entrySpacing = 24;
+    int startY = 228;
+    int maxRows = 9;
+    
+    // Enemies (most kills first)
+    DrawText("ENEMY", 100, headerY, headerSize, YELLOW);
+    DrawText("KILLS", 230, headerY, headerSize, YELLOW);
+    DrawText("DAMAGE", 310, headerY, headerSize, YELLOW);
+    for (int i = 0; i < runStats.enemyCount && i < maxRows; i++) {
+        int y = startY + i * entrySpacing;
+        DrawText(runStats.enemies[i].name, 100, y, entrySize, WHITE);
+        DrawText(TextFormat("%d", runStats.enemies[i].kills), 230, y, entrySize, WHITE);
+        DrawText(TextFormat("%d", runStats.enemies[i].damage), 310, y, entrySize, WHITE);
+    }
+    
+    // Levels (average over the runs that reached them)
+    DrawText("LEVEL", 450, headerY, headerSize, YELLOW);
+    DrawText("RUNS", 530, headerY, headerSize, YELLOW);
+    DrawText("AVG TIME", 600, headerY, headerSize, YELLOW);
+    DrawText("AVG SCORE", 710, headerY, headerSize, YELLOW);
+    for (int i = 0; i < runStats.phaseCount && i < maxRows; i++) {
+        int y = startY + i * entrySpacing;
+        char averageTime[32];
+        FormatPlayTime(averageTime, sizeof(averageTime), runStats.phases[i].averageDuration);
+        DrawText(TextFormat("%d", runStats.phases[i].level), 450, y, entrySize, WHITE);
+        DrawText(TextFormat("%d", runStats.phases[i].runs), 530, y, entrySize, WHITE);
+        DrawText(averageTime, 600, y, entrySize, WHITE);
+        DrawText(TextFormat("%.0f", runStats.phases[i].averageScore), 710, y, entrySize, WHITE);
+    }
+    
+    // Powerups (most collected first)
+    DrawText("POWERUP", 870, headerY, headerSize, YELLOW);
+    DrawText("TAKEN", 1040, headerY, headerSize, YELLOW);
+    for (int i = 0; i < runStats.powerupCount && i < maxRows; i++) {
+        int y = startY + i * entrySpacing;
+        DrawText(runStats.powerups[i].name, 870, y, entrySize, WHITE);
+        DrawText(TextFormat("%d", runStats.powerups[i].collected), 1040, y, entrySize, WHITE);
+    }
+    
+    // Last run
+    if (runStats.recentCount > 0) {
+        const DBRunRecord* last = &runStats.lastRun;
+        const char* outcomeNames[] = {"Death", "Victory", "Abandoned"};
+        const char* outcome = (last->outcome >= DB_RUN_DEATH && last->outcome <= DB_RUN_ABANDONED) ?
+                              outcomeNames[last->outcome] : "Unknown";
+        char duration[32];
+        FormatPlayTime(duration, sizeof(duration), last->duration);
+        
+        snprintf(line, sizeof(line), "Last run: %s - score %d, level %d, %s", 
+                 outcome, last->score, last->levelReached, duration);
+        DrawText(line, 100, screenHeight - 110, 18, WHITE);
+        DrawText(last->deathCause, 100, screenHeight - 85, 16, labelColor);
+    }
+    
+    // Hint
+    const char* hintText = "TAB / ESC: Back to high scores";
+    int hintSize = 16;
+    int hintWidth = MeasureText(hintText, hintSize);
+    DrawText(hintText, (screenWidth - hintWidth) / 2, screenHeight - 40, hintSize, (Color){150, 150, 150, 255});
 }
 
 void DrawCredits(const Menu* menu) {
@@ -1246,6 +1424,8 @@ void StartNameInput(Menu* menu, int score, int difficulty) {
     menu->nameInputActive = true;
     menu->pendingScore = score;
     menu->pendingDifficulty = difficulty;
+    free(menu->pendingReplayData);  // Set by the caller after this call
+    menu->pendingReplayData = NULL;
     menu->playerName[0] = '\0';
     menu->nameLength = 0;
     menu->nameInputBlink = 0.0f;
@@ -1257,12 +1437,20 @@ bool IsNameInputActive(const Menu* menu) {
 
 void FinishNameInput(Menu* menu) {
     if (menu->nameInputActive && menu->nameLength > 0) {
-        // Save high score with entered name
-        DB_AddHighScore(menu->playerName, menu->pendingScore, (DifficultyLevel)menu->pendingDifficulty);
+        // Save high score with entered name (and the run's replay, which the database takes over)
+        if (menu->pendingReplayData) {
+            DB_AddHighScoreWithReplay(menu->playerName, menu->pendingScore, (DifficultyLevel)menu->pendingDifficulty,
+                                      &menu->pendingReplayInfo, menu->pendingReplayData);
+            menu->pendingReplayData = NULL;
+        } else {
+            DB_AddHighScore(menu->playerName, menu->pendingScore, (DifficultyLevel)menu->pendingDifficulty);
+        }
         printf("High score saved: %s - %d pts (Difficulty: %d)\n", 
                menu->playerName, menu->pendingScore, menu->pendingDifficulty);
     }
     
+    free(menu->pendingReplayData);
+    menu->pendingReplayData = NULL;
     menu->nameInputActive = false;
     menu->pendingScore = 0;
     menu->pendingDifficulty = 0;
@@ -0,0 +1,277 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L   // mmap/fstat under -std=c99
+#endif
+
+#include "asset_pack.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Platform-specific headers
+#ifdef _WIN32
+    // No mmap: the pack is read into memory once
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+// Mounted pack state
+static const unsigned char* packData = NULL;
+static size_t packSize = 0;
+static bool packMapped = false;              // true = mmap, false = malloc'd copy
+static const AssetPackEntry* packEntries = NULL;
+static int packEntryCount = 0;
+
+uint64_t AssetPack_Hash(const unsigned char* data, uint64_t size) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (uint64_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// Strip "./" and convert backslashes so lookups match the packed names
+static void NormalizePath(const char* path, char* out, size_t outSize) {
+    while (path[0] == '.' && (path[1] == '/' || path[1] == '\\')) path += 2;
+
+    size_t i = 0;
+    for (; path[i] && i < outSize - 1; i++) {
+        out[i] = (path[i] == '\\') ? '/' : path[i];
+    }
+    out[i] = '\0';
+}
+
+static const AssetPackEntry* FindEntry(const char* path) {
+    if (!packEntries || !path) return NULL;
+
+    char normalized[ASSET_PACK_PATH_MAX];
+    NormalizePath(path, normalized, sizeof(normalized));
+
+    // Entries are sorted by path
+    int low = 0, high = packEntryCount - 1;
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        int cmp = strcmp(packEntries[mid].path, normalized);
+        if (cmp == 0) return &packEntries[mid];
+        if (cmp < 0) low = mid + 1;
+        else high = mid - 1;
+    }
+    return NULL;
+}
+
+// Read a loose file from disk (fallback for anything not in the pack)
+static unsigned char* ReadLooseFile(const char* fileName, int* dataSize, bool addTerminator) {
+    *dataSize = 0;
+    FILE* file = fopen(fileName, "rb");
+    if (!file) return NULL;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (size < 0) {
+        fclose(file);
+        return NULL;
+    }
+
+    unsigned char* data = (unsigned char*)malloc(size + 1);  // Room for a terminator, never 0 bytes
+    if (!data) {
+        fclose(file);
+        return NULL;
+    }
+
+    size_t bytesRead = fread(data, 1, size, file);
+    fclose(file);
+    if (addTerminator) data[bytesRead] = '\0';
+    *dataSize = (int)bytesRead;
+    return data;
+}
+
+// raylib LoadFileData callback - caller releases with UnloadFileData (free)
+static unsigned char* PackLoadFileData(const char* fileName, int* dataSize) {
+    const AssetPackEntry* entry = FindEntry(fileName);
+    if (entry) {
+        unsigned char* data = (unsigned char*)malloc(entry->size ? entry->size : 1);
+        if (!data) {
+            *dataSize = 0;
+            return NULL;
+        }
+        memcpy(data, packData + entry->offset, entry->size);
+        *dataSize = (int)entry->size;
+        return data;
+    }
+    return ReadLooseFile(fileName, dataSize, false);
+}
+
+// raylib LoadFileText callback - caller releases with UnloadFileText (free)
+static char* PackLoadFileText(const char* fileName) {
+    const AssetPackEntry* entry = FindEntry(fileName);
+    if (entry) {
+        char* text = (char*)malloc(entry->size + 1);
+        if (!text) return NULL;
+        memcpy(text, packData + entry->offset, entry->size);
+        text[entry->size] = '\0';
+        return text;
+    }
+    int size = 0;
+    return (char*)ReadLooseFile(fileName, &size, true);
+}
+
+static void ReleasePackMemory(void) {
+    if (!packData) return;
+#ifndef _WIN32
+    if (packMapped) {
+        munmap((void*)packData, packSize);
+    } else
+#endif
+    {
+        free((void*)packData);
+    }
+    packData = NULL;
+    packSize = 0;
+    packMapped = false;
+    packEntries = NULL;
+    packEntryCount = 0;
+}
+
+static bool MapPackFile(const char* packPath) {
+#ifndef _WIN32
+    int fd = open(packPath, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+
+    void* mapped = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // The mapping stays valid after close
+    if (mapped == MAP_FAILED) return false;
+
+    packData = (const unsigned char*)mapped;
+    packSize = (size_t)st.st_size;
+    packMapped = true;
+    return true;
+#else
+    int size = 0;
+    unsigned char* data = ReadLooseFile(packPath, &size, false);
+    if (!data) return false;
+    packData = data;
+    packSize = (size_t)size;
+    packMapped = false;
+    return true;
+#endif
+}
+
+bool AssetPack_Mount(const char* packPath, bool verify) {
+    AssetPack_Unmount();
+
+    if (!MapPackFile(packPath)) {
+        return false;
+    }
+
+    // Validate header and index bounds before trusting any offsets
+    const AssetPackHeader* header = (const AssetPackHeader*)packData;
+    if (packSize < sizeof(AssetPackHeader) ||
+        memcmp(header->magic, ASSET_PACK_MAGIC, 4) != 0 ||
+        header->version != ASSET_PACK_VERSION) {
+        printf("[ASSET PACK] ERROR: %s is not a version %d asset pack\n", packPath, ASSET_PACK_VERSION);
+        ReleasePackMemory();
+        return false;
+    }
+
+    // Compare against the room left after an offset so corrupt values cannot wrap around
+    if (header->indexOffset % 8 != 0 || header->indexOffset > packSize || header->entryCount > INT_MAX ||
+        header->entryCount > (packSize - header->indexOffset) / sizeof(AssetPackEntry)) {
+        printf("[ASSET PACK] ERROR: %s has a truncated index\n", packPath);
+        ReleasePackMemory();
+        return false;
+    }
+
+    packEntries = (const AssetPackEntry*)(packData + header->indexOffset);
+    packEntryCount = (int)header->entryCount;
+
+    for (int i = 0; i < packEntryCount; i++) {
+        const AssetPackEntry* entry = &packEntries[i];
+        if (entry->offset > packSize || entry->size > packSize - entry->offset || entry->size > INT_MAX ||
+            memchr(entry->path, '\0', ASSET_PACK_PATH_MAX) == NULL) {
+            printf("[ASSET PACK] ERROR: %s entry %d is out of bounds\n", packPath, i);
+            ReleasePackMemory();
+            return false;
+        }
+    }
+
+    if (verify) {
+        int corrupt = AssetPack_Verify();
+        if (corrupt > 0) {
+            printf("[ASSET PACK] ERROR: %s has %d corrupt entries\n", packPath, corrupt);
+            ReleasePackMemory();
+            return false;
+        }
+    }
+
+    SetLoadFileDataCallback(PackLoadFileData);
+    SetLoadFileTextCallback(PackLoadFileText);
+
+    printf("[ASSET PACK] Mounted %s: %d entries, %.1f KB%s\n", packPath, packEntryCount,
+           packSize / 1024.0, packMapped ? " (mapped)" : "");
+    return true;
+}
+
+void AssetPack_Unmount(void) {
+    if (!packData) return;
+
+    SetLoadFileDataCallback(NULL);
+    SetLoadFileTextCallback(NULL);
+    ReleasePackMemory();
+}
+
+bool AssetPack_IsMounted(void) {
+    return packData != NULL;
+}
+
+const unsigned char* AssetPack_Find(const char* path, int* size) {
+    const AssetPackEntry* entry = FindEntry(path);
+    if (!entry) return NULL;
+    if (size) *size = (int)entry->size;
+    return packData + entry->offset;
+}
+
+int AssetPack_GetEntryCount(void) {
+    return packEntryCount;
+}
+
+const AssetPackEntry* AssetPack_GetEntry(int index) {
+    if (index < 0 || index >= packEntryCount) return NULL;
+    return &packEntries[index];
+}
+
+bool AssetPack_FileExists(const char* path) {
+    return FindEntry(path) != NULL || FileExists(path);
+}
+
+Music AssetPack_LoadMusicStream(const char* path) {
+    int size = 0;
+    const unsigned char* data = AssetPack_Find(path, &size);
+    if (data) {
+        // The pack stays mapped while the game runs, so the stream can read it in place
+        return LoadMusicStreamFromMemory(GetFileExtension(path), data, size);
+    }
+    return LoadMusicStream(path);
+}
+
+int AssetPack_Verify(void) {
+    int corrupt = 0;
+    for (int i = 0; i < packEntryCount; i++) {
+        const AssetPackEntry* entry = &packEntries[i];
+        if (AssetPack_Hash(packData + entry->offset, entry->size) != entry->hash) {
+            printf("[ASSET PACK] Hash mismatch: %s\n", entry->path);
+            corrupt++;
+        }
+    }
+    return corrupt;
+}
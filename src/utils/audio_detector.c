@@ -0,0 +1,230 @@
+// Bass event / peak detection and bass log writing shared by the CLI tools
+#include "audio_detector.h"
+#include <string.h>
+
+// Print an event line to stdout (if echoing) and the log file
+static void LogEvent(const BassDetector *detector, const char *line) {
+    if (detector->echo) {
+        fputs(line, stdout);
+    }
+    if (detector->logFile) {
+        fputs(line, detector->logFile);
+        fflush(detector->logFile);
+    }
+}
+
+// Write one onset/beat event to the beat grid
+static void LogOnsetEvent(BassDetector *detector, const AudioOnsetEvent *event) {
+    if (event->type == AUDIO_ONSET_EVENT_ONSET) {
+        detector->onsetCount++;
+        if (detector->beatsFile) {
+            fprintf(detector->beatsFile, "[%06.2f] ONSET    - Strength: %.3f\n", event->time, event->strength);
+        }
+        return;
+    }
+
+    detector->beatCount++;
+    if (event->downbeat) detector->barCount++;
+    if (detector->beatsFile) {
+        if (event->downbeat) {
+            fprintf(detector->beatsFile, "[%06.2f] DOWNBEAT - Bar %d (%.1f BPM)\n", event->time, event->bar, event->bpm);
+        } else {
+            fprintf(detector->beatsFile, "[%06.2f] BEAT     - Bar %d, beat %d\n", event->time, event->bar, event->beat);
+        }
+    }
+}
+
+void audio_detectorInit(BassDetector *detector, const BassConfig *config, FILE *logFile, bool echo) {
+    memset(detector, 0, sizeof(BassDetector));
+    detector->config = *config;
+    detector->logFile = logFile;
+    detector->echo = echo;
+}
+
+void audio_detectorProcessFrame(BassDetector *detector, const float *spectrum, double currentTime) {
+    char line[128];
+    bool peak = false;
+
+    // Calculate magnitude spectrum with smoothing
+    for (int i = 0; i < FFT_SIZE/2; i++) {
+        float newMag = spectrum[i] / (FFT_SIZE/4);
+
+        // Apply smoothing
+        detector->magnitude[i] = detector->magnitude[i] * 0.7f + newMag * 0.3f;
+    }
+
+    // Calculate bass energy using shared function
+    detector->bassEnergy = audio_calculateBassEnergy(detector->magnitude, FFT_SIZE/2);
+
+    // Determine bass level
+    detector->previousBassLevel = detector->currentBassLevel;
+    detector->currentBassLevel = audio_getBassLevel(detector->bassEnergy, &detector->config);
+
+    // Verbose output - show all energy readings
+    if (detector->echo && detector->verbose && ((int)(currentTime * 10) % 5 == 0)) {  // Every 0.5 seconds
+        printf("[%06.2f] Energy: %.3f Level: %s\n",
+               currentTime, detector->bassEnergy, audio_getBassLevelString(detector->currentBassLevel));
+    }
+
+    // Detect peaks - only if enabled
+    if (detector->config.peakEnabled) {
+        float energyDelta = detector->bassEnergy - detector->previousBassEnergy;
+        float energyIncrease = (detector->previousBassEnergy > 0.01f) ?
+                               (energyDelta / detector->previousBassEnergy) : 0.0f;
+
+        // Detect peak if energy increases by threshold percentage and enough time has passed
+        if (energyIncrease >= detector->config.peakThreshold &&
+            (currentTime - detector->lastPeakTime) >= PEAK_DEBOUNCE_TIME) {
+            detector->lastPeakTime = currentTime;
+            detector->peakCount++;
+            peak = true;
+
+            snprintf(line, sizeof(line), "[%06.2f] PEAK detected - Energy: %.3f (increase: +%.1f%%)\n",
+                     currentTime, detector->bassEnergy, energyIncrease * 100.0f);
+            LogEvent(detector, line);
+        }
+
+        // Update previous energy for next peak detection
+        detector->previousBassEnergy = detector->bassEnergy;
+    }
+
+    if (detector->envelope) {
+        BassEnvelope_BuilderAdd(detector->envelope, currentTime, detector->bassEnergy,
+                                detector->currentBassLevel, peak);
+    }
+
+    if (detector->onsets) {
+        AudioOnsetEvent events[AUDIO_ONSET_MAX_EVENTS];
+        int count = audio_onsetProcess(detector->onsets, spectrum, currentTime, events, AUDIO_ONSET_MAX_EVENTS);
+        for (int i = 0; i < count; i++) {
+            LogOnsetEvent(detector, &events[i]);
+        }
+    }
+
+    // Log bass events
+    if (detector->previousBassLevel == BASS_NONE && detector->currentBassLevel != BASS_NONE) {
+        // Bass started
+        detector->bassStartTime = currentTime;
+        detector->bassEventCount++;
+
+        snprintf(line, sizeof(line), "[%06.2f] Bass START - Level: %-6s (Energy: %.3f)\n",
+                 currentTime, audio_getBassLevelString(detector->currentBassLevel), detector->bassEnergy);
+        LogEvent(detector, line);
+        detector->lastLogTime = currentTime;
+    }
+    else if (detector->previousBassLevel != BASS_NONE &&
+             detector->currentBassLevel != BASS_NONE &&
+             detector->previousBassLevel != detector->currentBassLevel) {
+        // Bass level changed (no debouncing for CHANGE events - log all transitions)
+        snprintf(line, sizeof(line), "[%06.2f] Bass CHANGE - Level: %-6s (Energy: %.3f)\n",
+                 currentTime, audio_getBassLevelString(detector->currentBassLevel), detector->bassEnergy);
+        LogEvent(detector, line);
+        detector->lastLogTime = currentTime;
+    }
+    else if (detector->previousBassLevel != BASS_NONE && detector->currentBassLevel == BASS_NONE) {
+        // Bass ended
+        float duration = currentTime - detector->bassStartTime;
+
+        snprintf(line, sizeof(line), "[%06.2f] Bass END   - Duration: %.2fs\n", currentTime, duration);
+        LogEvent(detector, line);
+        detector->lastLogTime = currentTime;
+    }
+}
+
+float audio_detectorAnalyzePCM(BassDetector *detector, AudioSTFT *stft,
+                               const float *samples, unsigned int frameCount, float maxTime) {
+    unsigned int frame = 0;
+    float analysisTime = 0.0f;
+    float lastProgressUpdate = 0.0f;
+    float spectrum[FFT_SIZE/2];
+    double frameTime;
+
+    while (frame < frameCount) {
+        unsigned int count = frameCount - frame;
+        if (count > FFT_SIZE) count = FFT_SIZE;
+        audio_stftPush(stft, samples + (size_t)frame * 2, count, 2);
+        frame += count;
+
+        while (audio_stftNextFrame(stft, spectrum, &frameTime)) {
+            float currentTime = (float)frameTime;
+            analysisTime = currentTime;
+
+            if (currentTime >= (maxTime - 0.1f)) {
+                if (detector->echo) {
+                    printf("\n[Completed: analyzed %.2f of %.2f seconds]\n", currentTime, maxTime);
+                }
+                return analysisTime;
+            }
+
+            if (detector->echo && currentTime - lastProgressUpdate >= 30.0f) {
+                printf("Progress: %.1f%% (%.1f/%.1f seconds)\n",
+                       (currentTime / maxTime) * 100.0f, currentTime, maxTime);
+                lastProgressUpdate = currentTime;
+            }
+
+            audio_detectorProcessFrame(detector, spectrum, frameTime);
+        }
+    }
+
+    if (detector->echo) {
+        printf("\n[Music stream ended at %.2f seconds]\n", analysisTime);
+    }
+    return analysisTime;
+}
+
+void audio_writeLogHeader(FILE *file, const char *audioFile, float duration, const BassConfig *config) {
+    fprintf(file, "=== Audio Bass Analyzer Log ===\n");
+    fprintf(file, "Audio file: %s\n", audioFile);
+    fprintf(file, "Duration: %.2f seconds\n", duration);
+    fprintf(file, "Bass Thresholds: LOW=%.3f, MEDIUM=%.3f, HIGH=%.3f\n",
+           config->thresholdLow, config->thresholdMedium, config->thresholdHigh);
+    fprintf(file, "Peak Detection: %s", config->peakEnabled ? "ENABLED" : "DISABLED");
+    if (config->peakEnabled) {
+        fprintf(file, " (threshold: %.3f = %.0f%% energy increase)",
+               config->peakThreshold, config->peakThreshold * 100.0f);
+    }
+    fprintf(file, "\n\n");
+    fprintf(file, "Time format: [seconds from start]\n");
+    fprintf(file, "=====================================\n\n");
+    fflush(file);
+}
+
+void audio_writeLogSummary(FILE *file, const BassDetector *detector, float analysisTime) {
+    fprintf(file, "\n=====================================\n");
+    fprintf(file, "=== Analysis Summary ===\n");
+    fprintf(file, "Total bass events detected: %d\n", detector->bassEventCount);
+    if (detector->config.peakEnabled) {
+        fprintf(file, "Total peaks detected: %d\n", detector->peakCount);
+    }
+    fprintf(file, "Analysis duration: %.2f seconds\n", analysisTime);
+}
+
+void audio_getBeatsFilePath(const char *audioPath, char *beatsPath, size_t size) {
+    snprintf(beatsPath, size, "%s", audioPath);
+
+    char *ext = strrchr(beatsPath, '.');
+    char *slash = strrchr(beatsPath, '/');
+    if (ext != NULL && (slash == NULL || ext > slash)) {
+        *ext = '\0';
+    }
+    strncat(beatsPath, ".beats", size - strlen(beatsPath) - 1);
+}
+
+void audio_writeBeatsHeader(FILE *file, const char *audioFile, float duration) {
+    fprintf(file, "=== Audio Beat Grid ===\n");
+    fprintf(file, "Audio file: %s\n", audioFile);
+    fprintf(file, "Duration: %.2f seconds\n", duration);
+    fprintf(file, "Onsets: spectral flux in %d bands, adaptive median threshold\n", AUDIO_ONSET_BANDS);
+    fprintf(file, "Beats: %d/4 grid, tempo %.0f-%.0f BPM\n\n",
+            AUDIO_ONSET_BEATS_PER_BAR, AUDIO_ONSET_MIN_BPM, AUDIO_ONSET_MAX_BPM);
+    fprintf(file, "Time format: [seconds from start]\n");
+    fprintf(file, "=====================================\n\n");
+}
+
+void audio_writeBeatsSummary(FILE *file, const BassDetector *detector) {
+    fprintf(file, "\n=====================================\n");
+    fprintf(file, "=== Beat Summary ===\n");
+    fprintf(file, "Tempo: %.1f BPM\n", detector->onsets ? audio_onsetGetTempo(detector->onsets) : 0.0f);
+    fprintf(file, "Total onsets detected: %d\n", detector->onsetCount);
+    fprintf(file, "Total beats: %d (%d bars)\n", detector->beatCount, detector->barCount);
+}
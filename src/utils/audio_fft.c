@@ -0,0 +1,277 @@
+// Real-input FFT plans (radix-4 complex core + real post-processing)
+#include "audio_fft.h"
+#include <math.h>
+#include <stdlib.h>
+
+#if defined(__AVX__)
+    #include <immintrin.h>
+    #define FFT_VEC_WIDTH 8
+    #define FFT_KERNEL_NAME "avx"
+    typedef __m256 FFTVec;
+    #define VecLoad(p) _mm256_loadu_ps(p)
+    #define VecStore(p, v) _mm256_storeu_ps(p, v)
+    #define VecAdd(a, b) _mm256_add_ps(a, b)
+    #define VecSub(a, b) _mm256_sub_ps(a, b)
+    #define VecMul(a, b) _mm256_mul_ps(a, b)
+#elif defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define FFT_VEC_WIDTH 4
+    #define FFT_KERNEL_NAME "sse"
+    typedef __m128 FFTVec;
+    #define VecLoad(p) _mm_loadu_ps(p)
+    #define VecStore(p, v) _mm_storeu_ps(p, v)
+    #define VecAdd(a, b) _mm_add_ps(a, b)
+    #define VecSub(a, b) _mm_sub_ps(a, b)
+    #define VecMul(a, b) _mm_mul_ps(a, b)
+#else
+    #define FFT_KERNEL_NAME "scalar"
+#endif
+
+#define FFT_TWO_PI 6.283185307179586476925286766559
+
+struct AudioFFTPlan {
+    int size;               // Real transform size n
+    int half;               // Complex transform size m = n/2
+    int *bitReverse;        // m entries: where input pair k lands before the butterflies
+    float *stageTwiddles;   // Per radix-4 stage: re/im of W^2j, W^j, W^3j (h entries each)
+    float *realTwiddleRe;   // m entries: cos(-2*pi*k/n)
+    float *realTwiddleIm;   // m entries: sin(-2*pi*k/n)
+    float *workRe;          // m entries of scratch
+    float *workIm;
+};
+
+static int IsPowerOfTwo(int value) {
+    return value > 0 && (value & (value - 1)) == 0;
+}
+
+// First radix-4 stage span: the odd power of two (if any) is done by one radix-2 pass
+static int FirstRadix4Span(int m) {
+    int log2m = 0;
+    while ((1 << log2m) < m) log2m++;
+    return (log2m & 1) ? 2 : 1;
+}
+
+// Radix-2 pass over adjacent pairs (all twiddles are 1)
+static void Radix2Pass(float *re, float *im, int m) {
+    for (int i = 0; i < m; i += 2) {
+        float ar = re[i], ai = im[i];
+        float br = re[i + 1], bi = im[i + 1];
+        re[i] = ar + br;      im[i] = ai + bi;
+        re[i + 1] = ar - br;  im[i + 1] = ai - bi;
+    }
+}
+
+/*
+ * Radix-4 decimation-in-time stage: fuses the radix-2 stages of span h and
+ * 2h. For each group a0..a3 at j, j+h, j+2h, j+3h (W = e^(-2*pi*i/4h)):
+ *   t1 = W^2j a1, t2 = W^j a2, t3 = W^3j a3
+ *   c0 = (a0 + t1) + (t2 + t3)     c2 = (a0 + t1) - (t2 + t3)
+ *   c1 = (a0 - t1) - i(t2 - t3)    c3 = (a0 - t1) + i(t2 - t3)
+ */
+static void Radix4Stage(float *re, float *im, int m, int h, const float *tw) {
+    const float *w1r = tw,         *w1i = tw + h;        // W^2j (a1)
+    const float *w2r = tw + 2 * h, *w2i = tw + 3 * h;    // W^j  (a2)
+    const float *w3r = tw + 4 * h, *w3i = tw + 5 * h;    // W^3j (a3)
+
+    for (int base = 0; base < m; base += 4 * h) {
+        float *r0 = re + base, *r1 = r0 + h, *r2 = r1 + h, *r3 = r2 + h;
+        float *i0 = im + base, *i1 = i0 + h, *i2 = i1 + h, *i3 = i2 + h;
+        int j = 0;
+
+#ifdef FFT_VEC_WIDTH
+        if (h % FFT_VEC_WIDTH == 0) {
+            for (; j < h; j += FFT_VEC_WIDTH) {
+                FFTVec a0r = VecLoad(r0 + j), a0i = VecLoad(i0 + j);
+                FFTVec a1r = VecLoad(r1 + j), a1i = VecLoad(i1 + j);
+                FFTVec a2r = VecLoad(r2 + j), a2i = VecLoad(i2 + j);
+                FFTVec a3r = VecLoad(r3 + j), a3i = VecLoad(i3 + j);
+                FFTVec c1r = VecLoad(w1r + j), c1i = VecLoad(w1i + j);
+                FFTVec c2r = VecLoad(w2r + j), c2i = VecLoad(w2i + j);
+                FFTVec c3r = VecLoad(w3r + j), c3i = VecLoad(w3i + j);
+
+                FFTVec t1r = VecSub(VecMul(a1r, c1r), VecMul(a1i, c1i));
+                FFTVec t1i = VecAdd(VecMul(a1r, c1i), VecMul(a1i, c1r));
+                FFTVec t2r = VecSub(VecMul(a2r, c2r), VecMul(a2i, c2i));
+                FFTVec t2i = VecAdd(VecMul(a2r, c2i), VecMul(a2i, c2r));
+                FFTVec t3r = VecSub(VecMul(a3r, c3r), VecMul(a3i, c3i));
+                FFTVec t3i = VecAdd(VecMul(a3r, c3i), VecMul(a3i, c3r));
+
+                FFTVec s0r = VecAdd(a0r, t1r), s0i = VecAdd(a0i, t1i);
+                FFTVec d0r = VecSub(a0r, t1r), d0i = VecSub(a0i, t1i);
+                FFTVec s1r = VecAdd(t2r, t3r), s1i = VecAdd(t2i, t3i);
+                FFTVec d1r = VecSub(t2r, t3r), d1i = VecSub(t2i, t3i);
+
+                VecStore(r0 + j, VecAdd(s0r, s1r)); VecStore(i0 + j, VecAdd(s0i, s1i));
+                VecStore(r2 + j, VecSub(s0r, s1r)); VecStore(i2 + j, VecSub(s0i, s1i));
+                VecStore(r1 + j, VecAdd(d0r, d1i)); VecStore(i1 + j, VecSub(d0i, d1r));
+                VecStore(r3 + j, VecSub(d0r, d1i)); VecStore(i3 + j, VecAdd(d0i, d1r));
+            }
+        }
+#endif
+
+        for (; j < h; j++) {
+            float a0r = r0[j], a0i = i0[j];
+            float t1r = r1[j] * w1r[j] - i1[j] * w1i[j], t1i = r1[j] * w1i[j] + i1[j] * w1r[j];
+            float t2r = r2[j] * w2r[j] - i2[j] * w2i[j], t2i = r2[j] * w2i[j] + i2[j] * w2r[j];
+            float t3r = r3[j] * w3r[j] - i3[j] * w3i[j], t3i = r3[j] * w3i[j] + i3[j] * w3r[j];
+
+            float s0r = a0r + t1r, s0i = a0i + t1i;
+            float d0r = a0r - t1r, d0i = a0i - t1i;
+            float s1r = t2r + t3r, s1i = t2i + t3i;
+            float d1r = t2r - t3r, d1i = t2i - t3i;
+
+            r0[j] = s0r + s1r;  i0[j] = s0i + s1i;
+            r2[j] = s0r - s1r;  i2[j] = s0i - s1i;
+            r1[j] = d0r + d1i;  i1[j] = d0i - d1r;
+            r3[j] = d0r - d1i;  i3[j] = d0i + d1r;
+        }
+    }
+}
+
+// Complex FFT of the m packed samples (z[k] = x[2k] + i*x[2k+1]) into workRe/workIm
+static void ComplexTransform(AudioFFTPlan *plan, const float *input) {
+    int m = plan->half;
+    float *re = plan->workRe;
+    float *im = plan->workIm;
+
+    // Load straight into bit-reversed order
+    for (int k = 0; k < m; k++) {
+        int target = plan->bitReverse[k];
+        re[target] = input[2 * k];
+        im[target] = input[2 * k + 1];
+    }
+
+    int h = FirstRadix4Span(m);
+    if (h == 2) {
+        Radix2Pass(re, im, m);
+    }
+
+    const float *tw = plan->stageTwiddles;
+    for (; h < m; h *= 4) {
+        Radix4Stage(re, im, m, h, tw);
+        tw += 6 * h;
+    }
+}
+
+/*
+ * Split the packed transform Z into the real transform X:
+ *   X[k] = (Z[k] + conj(Z[m-k])) / 2 - i/2 * W_n^k * (Z[k] - conj(Z[m-k]))
+ */
+#define FFT_SPLIT(plan, k, xr, xi) do { \
+        int mk_ = (plan)->half - (k); \
+        float zr_ = (plan)->workRe[k], zi_ = (plan)->workIm[k]; \
+        float cr_ = (plan)->workRe[mk_], ci_ = -(plan)->workIm[mk_]; \
+        float er_ = 0.5f * (zr_ + cr_), ei_ = 0.5f * (zi_ + ci_); \
+        float or_ = 0.5f * (zi_ - ci_), oi_ = -0.5f * (zr_ - cr_); \
+        float wr_ = (plan)->realTwiddleRe[k], wi_ = (plan)->realTwiddleIm[k]; \
+        (xr) = er_ + or_ * wr_ - oi_ * wi_; \
+        (xi) = ei_ + or_ * wi_ + oi_ * wr_; \
+    } while (0)
+
+AudioFFTPlan* audio_fftPlanCreate(int size) {
+    if (size < 4 || !IsPowerOfTwo(size)) {
+        return NULL;
+    }
+
+    AudioFFTPlan *plan = calloc(1, sizeof(AudioFFTPlan));
+    if (plan == NULL) return NULL;
+
+    int m = size / 2;
+    plan->size = size;
+    plan->half = m;
+
+    // Each radix-4 stage of span h holds 6*h floats (about 2*m in total)
+    int twiddleCount = 0;
+    for (int h = FirstRadix4Span(m); h < m; h *= 4) {
+        twiddleCount += 6 * h;
+    }
+
+    plan->bitReverse = malloc(sizeof(int) * m);
+    plan->stageTwiddles = malloc(sizeof(float) * (twiddleCount > 0 ? twiddleCount : 1));
+    plan->realTwiddleRe = malloc(sizeof(float) * m);
+    plan->realTwiddleIm = malloc(sizeof(float) * m);
+    plan->workRe = malloc(sizeof(float) * m);
+    plan->workIm = malloc(sizeof(float) * m);
+
+    if (!plan->bitReverse || !plan->stageTwiddles || !plan->realTwiddleRe ||
+        !plan->realTwiddleIm || !plan->workRe || !plan->workIm) {
+        audio_fftPlanDestroy(plan);
+        return NULL;
+    }
+
+    int bits = 0;
+    while ((1 << bits) < m) bits++;
+    for (int k = 0; k < m; k++) {
+        int reversed = 0;
+        for (int b = 0; b < bits; b++) {
+            reversed |= ((k >> b) & 1) << (bits - 1 - b);
+        }
+        plan->bitReverse[k] = reversed;
+    }
+
+    float *tw = plan->stageTwiddles;
+    for (int h = FirstRadix4Span(m); h < m; h *= 4) {
+        double step = -FFT_TWO_PI / (4.0 * h);
+        for (int j = 0; j < h; j++) {
+            tw[j]         = (float)cos(step * 2 * j);
+            tw[h + j]     = (float)sin(step * 2 * j);
+            tw[2 * h + j] = (float)cos(step * j);
+            tw[3 * h + j] = (float)sin(step * j);
+            tw[4 * h + j] = (float)cos(step * 3 * j);
+            tw[5 * h + j] = (float)sin(step * 3 * j);
+        }
+        tw += 6 * h;
+    }
+
+    for (int k = 0; k < m; k++) {
+        double angle = -FFT_TWO_PI * k / size;
+        plan->realTwiddleRe[k] = (float)cos(angle);
+        plan->realTwiddleIm[k] = (float)sin(angle);
+    }
+
+    return plan;
+}
+
+void audio_fftPlanDestroy(AudioFFTPlan *plan) {
+    if (plan == NULL) return;
+    free(plan->bitReverse);
+    free(plan->stageTwiddles);
+    free(plan->realTwiddleRe);
+    free(plan->realTwiddleIm);
+    free(plan->workRe);
+    free(plan->workIm);
+    free(plan);
+}
+
+int audio_fftPlanSize(const AudioFFTPlan *plan) {
+    return plan->size;
+}
+
+void audio_fftForward(AudioFFTPlan *plan, const float *input, float complex *output) {
+    int m = plan->half;
+    ComplexTransform(plan, input);
+
+    output[0] = plan->workRe[0] + plan->workIm[0];
+    output[m] = plan->workRe[0] - plan->workIm[0];
+    for (int k = 1; k < m; k++) {
+        float xr, xi;
+        FFT_SPLIT(plan, k, xr, xi);
+        output[k] = xr + xi * I;
+    }
+}
+
+void audio_fftMagnitude(AudioFFTPlan *plan, const float *input, float *magnitude) {
+    int m = plan->half;
+    ComplexTransform(plan, input);
+
+    magnitude[0] = fabsf(plan->workRe[0] + plan->workIm[0]);
+    for (int k = 1; k < m; k++) {
+        float xr, xi;
+        FFT_SPLIT(plan, k, xr, xi);
+        magnitude[k] = sqrtf(xr * xr + xi * xi);
+    }
+}
+
+const char* audio_fftKernelName(void) {
+    return FFT_KERNEL_NAME;
+}
@@ -0,0 +1,393 @@
+// Onset/beat engine: multi-band spectral flux, adaptive median threshold, autocorrelation tempo
+#include "audio_onset.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ONSET_COMPRESSION 1000.0f       // log(1 + C * magnitude)
+#define ONSET_MEDIAN_WEIGHT 1.0f
+#define ONSET_MEAN_WEIGHT 0.5f
+#define ONSET_MEAN_SECONDS 2.0f         // Running mean time constant
+#define ONSET_MIN_INTERVAL 0.05f        // Seconds between onsets
+#define ONSET_LOW_BANDS 2               // Bands used for bar accents (up to 400 Hz)
+#define TEMPO_UPDATE_SECONDS 1.0f
+#define TEMPO_SPREAD_OCTAVES 1.0f       // Width of the preferred-tempo weighting
+#define TEMPO_MATCH 0.08f               // Relative change treated as the same tempo
+#define TEMPO_SWITCH_VOTES 3            // Consecutive estimates needed to change tempo
+#define BEAT_TOLERANCE 0.2f             // Search window around a prediction (fraction of a period)
+#define BEAT_CORRECTION 0.5f            // How far a beat moves towards the observed onset
+#define ACCENT_DECAY 0.8f
+#define ACCENT_SWITCH 1.1f              // Another phase must be this much stronger to become the downbeat
+#define MAX_HISTORY_FRAMES 8192
+
+static const float bandEdges[AUDIO_ONSET_BANDS + 1] = { 0.0f, 150.0f, 400.0f, 1000.0f, 2500.0f, 6000.0f, 1e9f };
+
+struct AudioOnsetDetector {
+    float frameRate;                    // Frames per second (sampleRate / hop)
+    int bins;
+    float normalization;
+    int bandStart[AUDIO_ONSET_BANDS + 1];
+    float *previous;                    // Log spectrum of the previous frame
+    bool hasPrevious;
+
+    // Onset strength history (ring indexed by absolute frame number)
+    int historySize;
+    float *flux;
+    float *lowEnergy;                   // Linear low-band level, for bar accents
+    double *times;
+    long long frameCount;
+    float average;
+
+    int medianSize;
+    float *scratch;                     // Median selection / autocorrelation series
+    double lastOnsetTime;
+
+    // Tempo
+    int minLag;
+    int maxLag;
+    float period;                       // Seconds, 0 = unknown
+    float candidatePeriod;
+    int candidateVotes;
+    int framesSinceTempo;
+
+    // Beat grid
+    double nextBeat;                    // Predicted time of the next beat (< 0 = not started)
+    int beatCount;
+    int bar;
+    int beatInBar;
+    float accent[AUDIO_ONSET_BEATS_PER_BAR];
+    int downbeatPhase;
+};
+
+static int HistoryIndex(const AudioOnsetDetector *detector, long long frame) {
+    return (int)(frame % detector->historySize);
+}
+
+static int AvailableFrames(const AudioOnsetDetector *detector) {
+    return detector->frameCount < detector->historySize ? (int)detector->frameCount : detector->historySize;
+}
+
+// k-th smallest value (values are reordered)
+static float SelectKth(float *values, int count, int k) {
+    int left = 0, right = count - 1;
+    while (left < right) {
+        float pivot = values[(left + right) / 2];
+        int i = left, j = right;
+        while (i <= j) {
+            while (values[i] < pivot) i++;
+            while (values[j] > pivot) j--;
+            if (i <= j) {
+                float swap = values[i];
+                values[i] = values[j];
+                values[j] = swap;
+                i++;
+                j--;
+            }
+        }
+        if (k <= j) right = j;
+        else if (k >= i) left = i;
+        else break;
+    }
+    return values[k];
+}
+
+static float MedianBefore(AudioOnsetDetector *detector, long long frame) {
+    int count = detector->medianSize;
+    if (count > frame + 1) count = (int)(frame + 1);
+    for (int i = 0; i < count; i++) {
+        detector->scratch[i] = detector->flux[HistoryIndex(detector, frame - i)];
+    }
+    return SelectKth(detector->scratch, count, count / 2);
+}
+
+// Weighted autocorrelation of the mean-removed onset strength at one lag
+static float TempoScore(const AudioOnsetDetector *detector, const float *series, int count, int lag) {
+    float sum = 0.0f;
+    for (int i = 0; i + lag < count; i++) {
+        sum += series[i] * series[i + lag];
+    }
+    float preferredLag = 60.0f * detector->frameRate / AUDIO_ONSET_PREFERRED_BPM;
+    float octaves = log2f(lag / preferredLag) / TEMPO_SPREAD_OCTAVES;
+    return sum / (count - lag) * expf(-0.5f * octaves * octaves);
+}
+
+static void EstimateTempo(AudioOnsetDetector *detector) {
+    int count = AvailableFrames(detector);
+    if (detector->maxLag + 1 >= count / 2) return;
+
+    // Oldest first, mean removed
+    float *series = detector->scratch;
+    float mean = 0.0f;
+    for (int i = 0; i < count; i++) {
+        series[i] = detector->flux[HistoryIndex(detector, detector->frameCount - count + i)];
+        mean += series[i];
+    }
+    mean /= count;
+    for (int i = 0; i < count; i++) series[i] -= mean;
+
+    int bestLag = 0;
+    float bestScore = 0.0f;
+    for (int lag = detector->minLag; lag <= detector->maxLag; lag++) {
+        float score = TempoScore(detector, series, count, lag);
+        if (score > bestScore) {
+            bestScore = score;
+            bestLag = lag;
+        }
+    }
+    if (bestLag == 0) return;
+
+    // Parabolic interpolation for a fractional lag
+    float lag = (float)bestLag;
+    if (bestLag > detector->minLag && bestLag < detector->maxLag) {
+        float before = TempoScore(detector, series, count, bestLag - 1);
+        float after = TempoScore(detector, series, count, bestLag + 1);
+        float curvature = before - 2.0f * bestScore + after;
+        if (curvature < 0.0f) lag += 0.5f * (before - after) / curvature;
+    }
+    float period = lag / detector->frameRate;
+
+    // Smooth small changes, require agreement before jumping to a new tempo
+    if (detector->period == 0.0f) {
+        detector->period = period;
+    } else if (fabsf(period - detector->period) < TEMPO_MATCH * detector->period) {
+        detector->period = detector->period * 0.8f + period * 0.2f;
+        detector->candidateVotes = 0;
+    } else if (detector->candidateVotes > 0 &&
+               fabsf(period - detector->candidatePeriod) < TEMPO_MATCH * detector->candidatePeriod) {
+        if (++detector->candidateVotes >= TEMPO_SWITCH_VOTES) {
+            detector->period = period;
+            detector->candidateVotes = 0;
+        }
+    } else {
+        detector->candidatePeriod = period;
+        detector->candidateVotes = 1;
+    }
+}
+
+// Strongest frame with time in [from, to]; returns -1 if none is in the history
+static long long StrongestFrame(const AudioOnsetDetector *detector, double from, double to) {
+    long long best = -1;
+    int available = AvailableFrames(detector);
+    for (int i = 0; i < available; i++) {
+        long long frame = detector->frameCount - 1 - i;
+        double time = detector->times[HistoryIndex(detector, frame)];
+        if (time < from) break;
+        if (time > to) continue;
+        if (best < 0 || detector->flux[HistoryIndex(detector, frame)] > detector->flux[HistoryIndex(detector, best)]) {
+            best = frame;
+        }
+    }
+    return best;
+}
+
+static AudioOnsetEvent NextBeat(AudioOnsetDetector *detector) {
+    float tolerance = BEAT_TOLERANCE * detector->period;
+    long long frame = StrongestFrame(detector, detector->nextBeat - tolerance, detector->nextBeat + tolerance);
+
+    double beatTime = detector->nextBeat;
+    float strength = 0.0f;
+    float low = 0.0f;
+    if (frame >= 0) {
+        int index = HistoryIndex(detector, frame);
+        strength = detector->flux[index];
+        low = detector->lowEnergy[index];
+        if (strength > detector->average) {
+            beatTime += BEAT_CORRECTION * (detector->times[index] - detector->nextBeat);
+        }
+    }
+
+    // Bar position: the beat phase with the most low-band flux is the downbeat
+    int phase = detector->beatCount % AUDIO_ONSET_BEATS_PER_BAR;
+    detector->accent[phase] = detector->accent[phase] * ACCENT_DECAY + low;
+    if (detector->beatCount >= AUDIO_ONSET_BEATS_PER_BAR) {
+        int strongest = 0;
+        for (int i = 1; i < AUDIO_ONSET_BEATS_PER_BAR; i++) {
+            if (detector->accent[i] > detector->accent[strongest]) strongest = i;
+        }
+        if (detector->accent[strongest] > ACCENT_SWITCH * detector->accent[detector->downbeatPhase]) {
+            detector->downbeatPhase = strongest;
+        }
+    }
+
+    AudioOnsetEvent event = {0};
+    event.type = AUDIO_ONSET_EVENT_BEAT;
+    event.time = beatTime;
+    event.strength = strength;
+    event.bpm = 60.0f / detector->period;
+    event.downbeat = (phase == detector->downbeatPhase) || detector->bar == 0;
+    if (event.downbeat || detector->beatInBar >= 2 * AUDIO_ONSET_BEATS_PER_BAR) {
+        detector->bar++;
+        detector->beatInBar = 1;
+        event.downbeat = true;
+    } else {
+        detector->beatInBar++;
+    }
+    event.bar = detector->bar;
+    event.beat = detector->beatInBar;
+
+    detector->beatCount++;
+    detector->nextBeat = beatTime + detector->period;
+    return event;
+}
+
+AudioOnsetDetector* audio_onsetCreate(const AudioSTFTConfig *config) {
+    AudioSTFTConfig settings = config ? *config : audio_stftDefaultConfig();
+
+    AudioOnsetDetector *detector = calloc(1, sizeof(AudioOnsetDetector));
+    if (detector == NULL) return NULL;
+
+    detector->frameRate = settings.sampleRate / settings.hopSize;
+    detector->bins = settings.frameSize / 2;
+    detector->normalization = settings.frameSize / 4.0f;
+
+    for (int b = 0; b <= AUDIO_ONSET_BANDS; b++) {
+        int bin = (int)(bandEdges[b] * settings.frameSize / settings.sampleRate);
+        if (bin < 1) bin = 1;                       // Skip DC
+        if (bin > detector->bins) bin = detector->bins;
+        if (b > 0 && bin <= detector->bandStart[b - 1]) bin = detector->bandStart[b - 1] + 1;
+        detector->bandStart[b] = bin;
+    }
+    detector->bandStart[AUDIO_ONSET_BANDS] = detector->bins;
+
+    detector->historySize = (int)(AUDIO_ONSET_HISTORY_SECONDS * detector->frameRate);
+    if (detector->historySize > MAX_HISTORY_FRAMES) detector->historySize = MAX_HISTORY_FRAMES;
+    if (detector->historySize < 16) detector->historySize = 16;
+    detector->medianSize = (int)(AUDIO_ONSET_MEDIAN_SECONDS * detector->frameRate);
+    if (detector->medianSize < 3) detector->medianSize = 3;
+    if (detector->medianSize > detector->historySize) detector->medianSize = detector->historySize;
+
+    detector->minLag = (int)floorf(60.0f * detector->frameRate / AUDIO_ONSET_MAX_BPM);
+    detector->maxLag = (int)ceilf(60.0f * detector->frameRate / AUDIO_ONSET_MIN_BPM);
+    if (detector->minLag < 1) detector->minLag = 1;
+
+    detector->previous = malloc(sizeof(float) * detector->bins);
+    detector->flux = malloc(sizeof(float) * detector->historySize);
+    detector->lowEnergy = malloc(sizeof(float) * detector->historySize);
+    detector->times = malloc(sizeof(double) * detector->historySize);
+    detector->scratch = malloc(sizeof(float) * detector->historySize);
+    if (!detector->previous || !detector->flux || !detector->lowEnergy || !detector->times || !detector->scratch) {
+        audio_onsetDestroy(detector);
+        return NULL;
+    }
+
+    audio_onsetReset(detector);
+    return detector;
+}
+
+void audio_onsetDestroy(AudioOnsetDetector *detector) {
+    if (detector == NULL) return;
+    free(detector->previous);
+    free(detector->flux);
+    free(detector->lowEnergy);
+    free(detector->times);
+    free(detector->scratch);
+    free(detector);
+}
+
+void audio_onsetReset(AudioOnsetDetector *detector) {
+    detector->hasPrevious = false;
+    detector->frameCount = 0;
+    detector->average = 0.0f;
+    detector->lastOnsetTime = -1e9;
+    detector->period = 0.0f;
+    detector->candidatePeriod = 0.0f;
+    detector->candidateVotes = 0;
+    detector->framesSinceTempo = 0;
+    detector->nextBeat = -1.0;
+    detector->beatCount = 0;
+    detector->bar = 0;
+    detector->beatInBar = 0;
+    memset(detector->accent, 0, sizeof(detector->accent));
+    detector->downbeatPhase = 0;
+}
+
+int audio_onsetProcess(AudioOnsetDetector *detector, const float *spectrum, double time,
+                       AudioOnsetEvent *events, int maxEvents) {
+    int eventCount = 0;
+
+    // Multi-band spectral flux of the log-compressed spectrum
+    float bandFlux[AUDIO_ONSET_BANDS] = {0};
+    float low = 0.0f;
+    for (int b = 0; b < AUDIO_ONSET_BANDS; b++) {
+        float sum = 0.0f;
+        for (int k = detector->bandStart[b]; k < detector->bandStart[b + 1]; k++) {
+            float magnitude = spectrum[k] / detector->normalization;
+            if (b < ONSET_LOW_BANDS) low += magnitude;
+            float value = logf(1.0f + ONSET_COMPRESSION * magnitude);
+            float rise = value - detector->previous[k];
+            if (detector->hasPrevious && rise > 0.0f) sum += rise;
+            detector->previous[k] = value;
+        }
+        int width = detector->bandStart[b + 1] - detector->bandStart[b];
+        bandFlux[b] = width > 0 ? sum / width : 0.0f;
+    }
+    detector->hasPrevious = true;
+
+    float strength = 0.0f;
+    for (int b = 0; b < AUDIO_ONSET_BANDS; b++) {
+        strength += bandFlux[b];
+    }
+    strength /= AUDIO_ONSET_BANDS;
+
+    long long frame = detector->frameCount++;
+    int index = HistoryIndex(detector, frame);
+    detector->flux[index] = strength;
+    detector->lowEnergy[index] = low;
+    detector->times[index] = time;
+    detector->average += (strength - detector->average) / (ONSET_MEAN_SECONDS * detector->frameRate);
+
+    // Onset: the previous frame is a local maximum above the adaptive threshold
+    if (frame >= 2) {
+        long long candidate = frame - 1;
+        float value = detector->flux[HistoryIndex(detector, candidate)];
+        float before = detector->flux[HistoryIndex(detector, candidate - 1)];
+        double candidateTime = detector->times[HistoryIndex(detector, candidate)];
+
+        if (value > before && value >= strength &&
+            candidateTime - detector->lastOnsetTime >= ONSET_MIN_INTERVAL) {
+            float threshold = ONSET_MEDIAN_WEIGHT * MedianBefore(detector, candidate) +
+                              ONSET_MEAN_WEIGHT * detector->average;
+            if (value > threshold && eventCount < maxEvents) {
+                AudioOnsetEvent event = {0};
+                event.type = AUDIO_ONSET_EVENT_ONSET;
+                event.time = candidateTime;
+                event.strength = value;
+                events[eventCount++] = event;
+                detector->lastOnsetTime = candidateTime;
+            }
+        }
+    }
+
+    // Tempo
+    if (++detector->framesSinceTempo >= (int)(TEMPO_UPDATE_SECONDS * detector->frameRate)) {
+        detector->framesSinceTempo = 0;
+        EstimateTempo(detector);
+    }
+
+    // Beats: emit each predicted beat once its search window has passed
+    if (detector->period > 0.0f) {
+        if (detector->nextBeat < 0.0) {
+            long long start = StrongestFrame(detector, time - detector->period, time);
+            detector->nextBeat = detector->times[HistoryIndex(detector, start >= 0 ? start : frame)];
+        }
+        while (time >= detector->nextBeat + BEAT_TOLERANCE * detector->period && eventCount < maxEvents) {
+            events[eventCount++] = NextBeat(detector);
+        }
+    }
+
+    // Beats can precede the onset found in this call
+    for (int i = 1; i < eventCount; i++) {
+        AudioOnsetEvent event = events[i];
+        int j = i - 1;
+        while (j >= 0 && events[j].time > event.time) {
+            events[j + 1] = events[j];
+            j--;
+        }
+        events[j + 1] = event;
+    }
+    return eventCount;
+}
+
+float audio_onsetGetTempo(const AudioOnsetDetector *detector) {
+    return detector->period > 0.0f ? 60.0f / detector->period : 0.0f;
+}
@@ -0,0 +1,216 @@
+// Streaming STFT: SPSC sample ring + cached window + real FFT plan
+#include "audio_stft.h"
+#include "audio_analysis.h"
+#include "audio_fft.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define STFT_TWO_PI 6.283185307179586476925286766559
+
+struct AudioSTFT {
+    AudioSTFTConfig config;
+    AudioFFTPlan *plan;
+    float *window;              // Cached window table (frameSize)
+    float *frame;               // Current frame in time order (frameSize)
+    float *windowed;            // Scratch (frameSize)
+    int frameFill;              // Valid samples at the start of frame
+
+    // Ring: the producer writes writeIndex and dropped, the consumer readIndex
+    float *ring;
+    unsigned int ringMask;
+    unsigned int writeIndex;
+    unsigned int readIndex;
+    unsigned int dropped;
+
+    // Consumer clock
+    double startTime;
+    unsigned long long samplesRead;
+    unsigned int droppedAtReset;
+};
+
+static bool IsPowerOfTwo(int value) {
+    return value > 0 && (value & (value - 1)) == 0;
+}
+
+static void BuildWindow(AudioWindowType type, float *window, int size) {
+    for (int i = 0; i < size; i++) {
+        double phase = STFT_TWO_PI * i / (size - 1);
+        double value;
+        switch (type) {
+            case AUDIO_WINDOW_HANN:     value = 0.5 - 0.5 * cos(phase); break;
+            case AUDIO_WINDOW_BLACKMAN: value = 0.42 - 0.5 * cos(phase) + 0.08 * cos(2.0 * phase); break;
+            case AUDIO_WINDOW_HAMMING:
+            default:                    value = 0.54 - 0.46 * cos(phase); break;
+        }
+        window[i] = (float)value;
+    }
+}
+
+AudioSTFTConfig audio_stftDefaultConfig(void) {
+    AudioSTFTConfig config = {
+        .frameSize = FFT_SIZE,
+        .hopSize = FFT_SIZE,
+        .window = AUDIO_WINDOW_HAMMING,
+        .channel = AUDIO_CHANNEL_LEFT,
+        .sampleRate = SAMPLE_RATE,
+        .ringSize = AUDIO_STFT_RING_SIZE
+    };
+    return config;
+}
+
+AudioSTFT* audio_stftCreate(const AudioSTFTConfig *config) {
+    AudioSTFTConfig settings = config ? *config : audio_stftDefaultConfig();
+
+    if (!IsPowerOfTwo(settings.frameSize) || settings.hopSize < 1 ||
+        settings.hopSize > settings.frameSize || settings.sampleRate <= 0.0f) {
+        return NULL;
+    }
+    if (settings.ringSize < 2 * settings.frameSize) {
+        settings.ringSize = 2 * settings.frameSize;
+    }
+    if (!IsPowerOfTwo(settings.ringSize)) {
+        int size = 1;
+        while (size < settings.ringSize) size <<= 1;
+        settings.ringSize = size;
+    }
+
+    AudioSTFT *stft = calloc(1, sizeof(AudioSTFT));
+    if (stft == NULL) return NULL;
+
+    stft->config = settings;
+    stft->plan = audio_fftPlanCreate(settings.frameSize);
+    stft->window = malloc(sizeof(float) * settings.frameSize);
+    stft->frame = calloc(settings.frameSize, sizeof(float));
+    stft->windowed = malloc(sizeof(float) * settings.frameSize);
+    stft->ring = malloc(sizeof(float) * settings.ringSize);
+    stft->ringMask = (unsigned int)settings.ringSize - 1;
+
+    if (!stft->plan || !stft->window || !stft->frame || !stft->windowed || !stft->ring) {
+        audio_stftDestroy(stft);
+        return NULL;
+    }
+
+    BuildWindow(settings.window, stft->window, settings.frameSize);
+    return stft;
+}
+
+void audio_stftDestroy(AudioSTFT *stft) {
+    if (stft == NULL) return;
+    audio_fftPlanDestroy(stft->plan);
+    free(stft->window);
+    free(stft->frame);
+    free(stft->windowed);
+    free(stft->ring);
+    free(stft);
+}
+
+AudioSTFTConfig audio_stftGetConfig(const AudioSTFT *stft) {
+    return stft->config;
+}
+
+void audio_stftPush(AudioSTFT *stft, const float *samples, unsigned int frames, int channels) {
+    unsigned int write = stft->writeIndex;
+    unsigned int read = __atomic_load_n(&stft->readIndex, __ATOMIC_ACQUIRE);
+    unsigned int space = (unsigned int)stft->config.ringSize - (write - read);
+    unsigned int count = frames < space ? frames : space;
+
+    int right = channels > 1 ? 1 : 0;
+    for (unsigned int i = 0; i < count; i++) {
+        const float *frame = samples + (size_t)i * channels;
+        float sample;
+        switch (stft->config.channel) {
+            case AUDIO_CHANNEL_RIGHT: sample = frame[right]; break;
+            case AUDIO_CHANNEL_MID:   sample = 0.5f * (frame[0] + frame[right]); break;
+            case AUDIO_CHANNEL_LEFT:
+            default:                  sample = frame[0]; break;
+        }
+        stft->ring[(write + i) & stft->ringMask] = sample;
+    }
+
+    __atomic_store_n(&stft->writeIndex, write + count, __ATOMIC_RELEASE);
+    if (count < frames) {
+        __atomic_add_fetch(&stft->dropped, frames - count, __ATOMIC_RELAXED);
+    }
+}
+
+bool audio_stftNextFrame(AudioSTFT *stft, float *magnitude, double *time) {
+    int frameSize = stft->config.frameSize;
+    int hopSize = stft->config.hopSize;
+    unsigned int read = stft->readIndex;
+    unsigned int available = __atomic_load_n(&stft->writeIndex, __ATOMIC_ACQUIRE) - read;
+    unsigned int needed = (unsigned int)(frameSize - stft->frameFill);
+
+    if (available < needed) {
+        return false;
+    }
+
+    // Copy the newest samples after what is left of the previous frame (two spans at the wrap)
+    unsigned int start = read & stft->ringMask;
+    unsigned int first = (unsigned int)stft->config.ringSize - start;
+    if (first > needed) first = needed;
+    memcpy(stft->frame + stft->frameFill, stft->ring + start, sizeof(float) * first);
+    memcpy(stft->frame + stft->frameFill + first, stft->ring, sizeof(float) * (needed - first));
+    __atomic_store_n(&stft->readIndex, read + needed, __ATOMIC_RELEASE);
+    stft->samplesRead += needed;
+
+    for (int i = 0; i < frameSize; i++) {
+        stft->windowed[i] = stft->frame[i] * stft->window[i];
+    }
+    audio_fftMagnitude(stft->plan, stft->windowed, magnitude);
+
+    if (time) {
+        unsigned int dropped = __atomic_load_n(&stft->dropped, __ATOMIC_RELAXED) - stft->droppedAtReset;
+        *time = stft->startTime + (double)(stft->samplesRead + dropped) / stft->config.sampleRate;
+    }
+
+    // Keep the overlap for the next frame
+    stft->frameFill = frameSize - hopSize;
+    memmove(stft->frame, stft->frame + hopSize, sizeof(float) * stft->frameFill);
+    return true;
+}
+
+void audio_stftReset(AudioSTFT *stft, double time) {
+    unsigned int write = __atomic_load_n(&stft->writeIndex, __ATOMIC_ACQUIRE);
+    __atomic_store_n(&stft->readIndex, write, __ATOMIC_RELEASE);
+    stft->frameFill = 0;
+    stft->samplesRead = 0;
+    stft->droppedAtReset = __atomic_load_n(&stft->dropped, __ATOMIC_RELAXED);
+    stft->startTime = time;
+}
+
+unsigned int audio_stftDroppedSamples(const AudioSTFT *stft) {
+    return __atomic_load_n(&stft->dropped, __ATOMIC_RELAXED);
+}
+
+bool audio_stftParseWindow(const char *name, AudioWindowType *window) {
+    if (strcmp(name, "hann") == 0) *window = AUDIO_WINDOW_HANN;
+    else if (strcmp(name, "hamming") == 0) *window = AUDIO_WINDOW_HAMMING;
+    else if (strcmp(name, "blackman") == 0) *window = AUDIO_WINDOW_BLACKMAN;
+    else return false;
+    return true;
+}
+
+bool audio_stftParseChannel(const char *name, AudioChannelMode *channel) {
+    if (strcmp(name, "left") == 0) *channel = AUDIO_CHANNEL_LEFT;
+    else if (strcmp(name, "right") == 0) *channel = AUDIO_CHANNEL_RIGHT;
+    else if (strcmp(name, "mid") == 0) *channel = AUDIO_CHANNEL_MID;
+    else return false;
+    return true;
+}
+
+const char* audio_stftWindowName(AudioWindowType window) {
+    switch (window) {
+        case AUDIO_WINDOW_HANN: return "hann";
+        case AUDIO_WINDOW_BLACKMAN: return "blackman";
+        default: return "hamming";
+    }
+}
+
+const char* audio_stftChannelName(AudioChannelMode channel) {
+    switch (channel) {
+        case AUDIO_CHANNEL_RIGHT: return "right";
+        case AUDIO_CHANNEL_MID: return "mid";
+        default: return "left";
+    }
+}
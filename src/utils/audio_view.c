@@ -0,0 +1,160 @@
+// Spectrum and spectrogram views: precomputed bin tables, color LUTs, ring-scrolled texture
+#include "audio_view.h"
+#include "audio_analysis.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MID_FREQ_MAX 2000.0f
+#define SPECTROGRAM_GAIN 3000.0f       // Magnitude to color intensity
+#define SPECTRUM_BASS_GAIN 2000.0f     // Magnitude to bass bar color intensity
+#define SPECTRUM_HEIGHT_GAIN 50.0f     // Magnitude to bar height (fraction of the view)
+
+static unsigned char BandOfBin(int bin) {
+    float freq = (bin * SAMPLE_RATE) / FFT_SIZE;
+    if (freq < BASS_FREQ_MAX) return 0;
+    if (freq < MID_FREQ_MAX) return 1;
+    return 2;
+}
+
+static int LutIndex(float magnitude, float gain) {
+    int index = (int)(magnitude * gain);
+    if (index < 0) return 0;
+    if (index >= AUDIO_VIEW_LUT_SIZE) return AUDIO_VIEW_LUT_SIZE - 1;
+    return index;
+}
+
+bool audio_spectrogramViewInit(AudioSpectrogramView *view, int columns, int rows, int maxBin) {
+    memset(view, 0, sizeof(AudioSpectrogramView));
+    if (columns <= 0 || rows <= 0 || maxBin <= 0) return false;
+
+    view->columns = columns;
+    view->rows = rows;
+    view->rowBin = malloc(sizeof(int) * rows);
+    view->rowBand = malloc(rows);
+    view->pixels = malloc(sizeof(Color) * rows);
+    if (!view->rowBin || !view->rowBand || !view->pixels) {
+        audio_spectrogramViewUnload(view);
+        return false;
+    }
+
+    // Low frequencies at the bottom
+    float binStep = (float)maxBin / rows;
+    for (int row = 0; row < rows; row++) {
+        int bin = (int)((rows - 1 - row) * binStep);
+        view->rowBin[row] = bin;
+        view->rowBand[row] = BandOfBin(bin);
+    }
+
+    for (int i = 0; i < AUDIO_VIEW_LUT_SIZE; i++) {
+        unsigned char full = (unsigned char)i;
+        unsigned char half = (unsigned char)(i / 2);
+        view->lut[0][i] = (Color){full, half, 0, 255};      // Bass - red/orange
+        view->lut[1][i] = (Color){0, full, half, 255};      // Mid - green
+        view->lut[2][i] = (Color){half, half, full, 255};   // High - blue
+    }
+
+    Image image = GenImageColor(columns, rows, view->lut[0][0]);
+    view->texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+    if (view->texture.id == 0) {
+        audio_spectrogramViewUnload(view);
+        return false;
+    }
+    return true;
+}
+
+void audio_spectrogramViewPush(AudioSpectrogramView *view, const float *magnitude) {
+    if (view->texture.id == 0) return;
+
+    for (int row = 0; row < view->rows; row++) {
+        view->pixels[row] = view->lut[view->rowBand[row]][LutIndex(magnitude[view->rowBin[row]], SPECTROGRAM_GAIN)];
+    }
+
+    Rectangle column = { (float)view->nextColumn, 0.0f, 1.0f, (float)view->rows };
+    UpdateTextureRec(view->texture, column, view->pixels);
+    view->nextColumn = (view->nextColumn + 1) % view->columns;
+}
+
+void audio_spectrogramViewClear(AudioSpectrogramView *view) {
+    if (view->texture.id == 0) return;
+
+    Image image = GenImageColor(view->columns, view->rows, view->lut[0][0]);
+    UpdateTexture(view->texture, image.data);
+    UnloadImage(image);
+    view->nextColumn = 0;
+}
+
+void audio_spectrogramViewDraw(const AudioSpectrogramView *view, Rectangle bounds) {
+    if (view->texture.id == 0) return;
+
+    float columnWidth = bounds.width / view->columns;
+    int older = view->columns - view->nextColumn;   // Columns from nextColumn to the end
+
+    // Oldest columns on the left, then the columns written since the ring wrapped
+    Rectangle source = { (float)view->nextColumn, 0.0f, (float)older, (float)view->rows };
+    Rectangle dest = { bounds.x, bounds.y, older * columnWidth, bounds.height };
+    DrawTexturePro(view->texture, source, dest, (Vector2){ 0, 0 }, 0.0f, WHITE);
+
+    if (view->nextColumn > 0) {
+        source = (Rectangle){ 0.0f, 0.0f, (float)view->nextColumn, (float)view->rows };
+        dest = (Rectangle){ bounds.x + older * columnWidth, bounds.y, view->nextColumn * columnWidth, bounds.height };
+        DrawTexturePro(view->texture, source, dest, (Vector2){ 0, 0 }, 0.0f, WHITE);
+    }
+}
+
+void audio_spectrogramViewUnload(AudioSpectrogramView *view) {
+    if (view->texture.id != 0) UnloadTexture(view->texture);
+    free(view->rowBin);
+    free(view->rowBand);
+    free(view->pixels);
+    memset(view, 0, sizeof(AudioSpectrogramView));
+}
+
+bool audio_spectrumViewInit(AudioSpectrumView *view, int barCount, int maxBin) {
+    memset(view, 0, sizeof(AudioSpectrumView));
+    if (barCount <= 0 || maxBin <= 0) return false;
+
+    view->barCount = barCount;
+    view->barBin = malloc(sizeof(int) * barCount);
+    view->barBand = malloc(barCount);
+    if (!view->barBin || !view->barBand) {
+        audio_spectrumViewUnload(view);
+        return false;
+    }
+
+    float binStep = (float)maxBin / barCount;
+    for (int i = 0; i < barCount; i++) {
+        view->barBin[i] = (int)(i * binStep);
+        view->barBand[i] = BandOfBin(view->barBin[i]);
+    }
+
+    for (int i = 0; i < AUDIO_VIEW_LUT_SIZE; i++) {
+        view->lut[0][i] = (Color){255, (unsigned char)i, 0, 200};   // Bass - red to orange
+        view->lut[1][i] = (Color){0, 200, 100, 200};                // Mid - green
+        view->lut[2][i] = (Color){100, 150, 255, 200};              // High - blue
+    }
+    return true;
+}
+
+void audio_spectrumViewDraw(const AudioSpectrumView *view, const float *magnitude, Rectangle bounds) {
+    int pitch = (int)bounds.width / (view->barCount > 0 ? view->barCount : 1);
+    int barWidth = pitch > 1 ? pitch - 1 : 1;
+    int height = (int)bounds.height;
+    int bottom = (int)bounds.y + height;
+
+    for (int i = 0; i < view->barCount; i++) {
+        float value = magnitude[view->barBin[i]];
+        int barHeight = (int)(value * height * SPECTRUM_HEIGHT_GAIN);
+        if (barHeight > height) barHeight = height;
+        if (barHeight <= 0) continue;
+
+        Color color = view->lut[view->barBand[i]][LutIndex(value, SPECTRUM_BASS_GAIN)];
+        DrawRectangle((int)bounds.x + i * pitch, bottom - barHeight, barWidth, barHeight, color);
+    }
+}
+
+void audio_spectrumViewUnload(AudioSpectrumView *view) {
+    free(view->barBin);
+    free(view->barBand);
+    memset(view, 0, sizeof(AudioSpectrumView));
+}
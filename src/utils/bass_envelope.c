@@ -0,0 +1,207 @@
+// Bass envelope: compact per-level bass track written by the analyzers, read by the game
+#include "bass_envelope.h"
+#include "raylib.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ENVELOPE_ENERGY_MAX 4095
+#define ENVELOPE_LEVEL_SHIFT 12
+#define ENVELOPE_LEVEL_MASK 0x3
+#define ENVELOPE_PEAK_BIT 0x4000
+#define BUILDER_PEAK_FLAG 0x4
+
+static uint16_t ReadU16(const unsigned char* data) {
+    return (uint16_t)(data[0] | (data[1] << 8));
+}
+
+static uint32_t ReadU32(const unsigned char* data) {
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+static void WriteU16(unsigned char* data, uint16_t value) {
+    data[0] = (unsigned char)(value & 0xFF);
+    data[1] = (unsigned char)(value >> 8);
+}
+
+static void WriteU32(unsigned char* data, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        data[i] = (unsigned char)(value >> (8 * i));
+    }
+}
+
+void BassEnvelope_GetPath(const char* audioPath, char* envelopePath, size_t size) {
+    snprintf(envelopePath, size, "%s", audioPath);
+
+    char* ext = strrchr(envelopePath, '.');
+    char* slash = strrchr(envelopePath, '/');
+    if (ext != NULL && (slash == NULL || ext > slash)) {
+        *ext = '\0';
+    }
+    strncat(envelopePath, BASS_ENVELOPE_EXTENSION, size - strlen(envelopePath) - 1);
+}
+
+BassEnvelope* BassEnvelope_Load(const char* path) {
+    int size = 0;
+    unsigned char* data = LoadFileData(path, &size);
+    if (data == NULL) return NULL;
+
+    if (size < BASS_ENVELOPE_HEADER_SIZE || memcmp(data, BASS_ENVELOPE_MAGIC, 4) != 0 ||
+        ReadU16(data + 4) != BASS_ENVELOPE_VERSION) {
+        printf("[BASS ENVELOPE] ERROR: Invalid envelope file: %s\n", path);
+        UnloadFileData(data);
+        return NULL;
+    }
+
+    int frameRate = ReadU16(data + 6);
+    uint32_t frameCount = ReadU32(data + 8);
+    uint32_t scaleBits = ReadU32(data + 12);
+    if (frameRate == 0 || frameCount > (uint32_t)(size - BASS_ENVELOPE_HEADER_SIZE) / 2) {
+        printf("[BASS ENVELOPE] ERROR: Truncated envelope file: %s\n", path);
+        UnloadFileData(data);
+        return NULL;
+    }
+
+    BassEnvelope* envelope = (BassEnvelope*)malloc(sizeof(BassEnvelope));
+    uint16_t* frames = (uint16_t*)malloc(sizeof(uint16_t) * (frameCount > 0 ? frameCount : 1));
+    if (!envelope || !frames) {
+        free(envelope);
+        free(frames);
+        UnloadFileData(data);
+        return NULL;
+    }
+
+    envelope->frameRate = frameRate;
+    envelope->frameCount = (int)frameCount;
+    memcpy(&envelope->energyScale, &scaleBits, sizeof(float));
+    envelope->frames = frames;
+    for (uint32_t i = 0; i < frameCount; i++) {
+        frames[i] = ReadU16(data + BASS_ENVELOPE_HEADER_SIZE + i * 2);
+    }
+
+    UnloadFileData(data);
+    return envelope;
+}
+
+void BassEnvelope_Unload(BassEnvelope* envelope) {
+    if (envelope == NULL) return;
+    free(envelope->frames);
+    free(envelope);
+}
+
+BassSample BassEnvelope_Sample(const BassEnvelope* envelope, float time) {
+    BassSample sample = { 0.0f, BASS_NONE, false };
+    if (envelope == NULL || time < 0.0f) return sample;
+
+    int index = (int)(time * envelope->frameRate);
+    if (index >= envelope->frameCount) return sample;
+
+    uint16_t frame = envelope->frames[index];
+    sample.energy = (frame & ENVELOPE_ENERGY_MAX) * (envelope->energyScale / ENVELOPE_ENERGY_MAX);
+    sample.level = (BassLevel)((frame >> ENVELOPE_LEVEL_SHIFT) & ENVELOPE_LEVEL_MASK);
+    sample.peak = (frame & ENVELOPE_PEAK_BIT) != 0;
+    return sample;
+}
+
+bool BassEnvelope_PeakBetween(const BassEnvelope* envelope, float from, float to) {
+    if (envelope == NULL || to <= from) return false;
+
+    // Frames whose start lies in (from, to]; frame 0 belongs to the first call from a negative time
+    int first = (int)floorf(from * envelope->frameRate) + 1;
+    int last = (int)floorf(to * envelope->frameRate);
+    if (first < 0) first = 0;
+    if (last >= envelope->frameCount) last = envelope->frameCount - 1;
+
+    for (int i = first; i <= last; i++) {
+        if (envelope->frames[i] & ENVELOPE_PEAK_BIT) return true;
+    }
+    return false;
+}
+
+float BassEnvelope_GetDuration(const BassEnvelope* envelope) {
+    if (envelope == NULL) return 0.0f;
+    return (float)envelope->frameCount / envelope->frameRate;
+}
+
+bool BassEnvelope_BuilderInit(BassEnvelopeBuilder* builder, int frameRate) {
+    memset(builder, 0, sizeof(BassEnvelopeBuilder));
+    if (frameRate <= 0 || frameRate > 0xFFFF) return false;
+    builder->frameRate = frameRate;
+    return true;
+}
+
+void BassEnvelope_BuilderAdd(BassEnvelopeBuilder* builder, double time, float energy, BassLevel level, bool peak) {
+    if (builder->frameRate == 0 || time < 0.0) return;
+
+    int index = (int)(time * builder->frameRate);
+    if (index >= builder->capacity) {
+        int capacity = builder->capacity ? builder->capacity : 1024;
+        while (capacity <= index) capacity *= 2;
+
+        float* energyFrames = (float*)realloc(builder->energy, sizeof(float) * capacity);
+        if (energyFrames == NULL) return;
+        builder->energy = energyFrames;
+        uint8_t* flagFrames = (uint8_t*)realloc(builder->flags, capacity);
+        if (flagFrames == NULL) return;
+        builder->flags = flagFrames;
+        builder->capacity = capacity;
+    }
+
+    uint8_t flags = (uint8_t)level;
+
+    // Several analysis frames in one envelope frame (small hops): newest wins, peaks accumulate
+    if (index < builder->frameCount) {
+        builder->energy[index] = energy;
+        builder->flags[index] = flags | (builder->flags[index] & BUILDER_PEAK_FLAG) | (peak ? BUILDER_PEAK_FLAG : 0);
+        return;
+    }
+
+    // Hold this analysis frame over every envelope frame it covers
+    for (int i = builder->frameCount; i <= index; i++) {
+        builder->energy[i] = energy;
+        builder->flags[i] = flags;
+    }
+    if (peak) builder->flags[index] |= BUILDER_PEAK_FLAG;
+    builder->frameCount = index + 1;
+}
+
+bool BassEnvelope_Save(const BassEnvelopeBuilder* builder, const char* path) {
+    float energyScale = 0.0f;
+    for (int i = 0; i < builder->frameCount; i++) {
+        if (builder->energy[i] > energyScale) energyScale = builder->energy[i];
+    }
+    if (energyScale <= 0.0f) energyScale = 1.0f;
+
+    size_t size = BASS_ENVELOPE_HEADER_SIZE + (size_t)builder->frameCount * 2;
+    unsigned char* data = (unsigned char*)malloc(size);
+    if (data == NULL) return false;
+
+    uint32_t scaleBits;
+    memcpy(&scaleBits, &energyScale, sizeof(float));
+    memcpy(data, BASS_ENVELOPE_MAGIC, 4);
+    WriteU16(data + 4, BASS_ENVELOPE_VERSION);
+    WriteU16(data + 6, (uint16_t)builder->frameRate);
+    WriteU32(data + 8, (uint32_t)builder->frameCount);
+    WriteU32(data + 12, scaleBits);
+
+    for (int i = 0; i < builder->frameCount; i++) {
+        float normalized = builder->energy[i] > 0.0f ? builder->energy[i] / energyScale : 0.0f;
+        uint16_t frame = (uint16_t)lroundf(normalized * ENVELOPE_ENERGY_MAX);
+        frame |= (uint16_t)((builder->flags[i] & ENVELOPE_LEVEL_MASK) << ENVELOPE_LEVEL_SHIFT);
+        if (builder->flags[i] & BUILDER_PEAK_FLAG) frame |= ENVELOPE_PEAK_BIT;
+        WriteU16(data + BASS_ENVELOPE_HEADER_SIZE + (size_t)i * 2, frame);
+    }
+
+    FILE* file = fopen(path, "wb");
+    bool ok = file != NULL && fwrite(data, 1, size, file) == size;
+    if (file != NULL && fclose(file) != 0) ok = false;
+    free(data);
+    return ok;
+}
+
+void BassEnvelope_BuilderFree(BassEnvelopeBuilder* builder) {
+    free(builder->energy);
+    free(builder->flags);
+    memset(builder, 0, sizeof(BassEnvelopeBuilder));
+}
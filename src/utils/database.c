@@ -1,4 +1,9 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L   // clock_gettime under -std=c99
+#endif
+
 #include "database.h"
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -17,10 +22,224 @@
     #include <pwd.h>
 #endif
 
+// Schema version stored in PRAGMA user_version (bump and add a step to MigrateSchema)
+#define DB_SCHEMA_VERSION 4
+
+// Scores per high_score_buckets row. The version 3 triggers hard-code it, so changing it
+// needs a migration that rebuilds the buckets.
+#define DB_RANK_BUCKET_SIZE 100
+#define DB_SQL_INT_(value) #value
+#define DB_SQL_INT(value) DB_SQL_INT_(value)
+
 // Global database handle
 static sqlite3* db = NULL;
 static char dbPath[512] = {0};
 
+// Statements prepared once in DB_Init, reset and rebound on every call
+typedef enum {
+    STMT_LOAD_SETTINGS = 0,
+    STMT_SAVE_SETTINGS,
+    STMT_INSERT_HIGH_SCORE,
+    STMT_SELECT_HIGH_SCORES,
+    STMT_COUNT_HIGH_SCORES,
+    STMT_COUNT_DIFFICULTY_SCORES,
+    STMT_COUNT_BUCKETS_ABOVE,
+    STMT_COUNT_SCORES_ABOVE,
+    STMT_SCAN_BUCKETS,
+    STMT_SELECT_SCORES_FROM,
+    STMT_SELECT_SCORES_ABOVE,
+    STMT_INSERT_RUN,
+    STMT_INSERT_RUN_PHASE,
+    STMT_INSERT_RUN_ENEMY,
+    STMT_INSERT_RUN_POWERUP,
+    STMT_RUN_TOTALS,
+    STMT_RUN_ENEMY_TOTALS,
+    STMT_RUN_POWERUP_TOTALS,
+    STMT_RUN_PHASE_TOTALS,
+    STMT_RECENT_RUNS,
+    STMT_INSERT_REPLAY,
+    STMT_SELECT_REPLAY,
+    STMT_SELECT_HIGH_SCORE_REPLAY,
+    STMT_COUNT
+} StatementId;
+
+static const char* STATEMENT_SQL[STMT_COUNT] = {
+    // STMT_LOAD_SETTINGS
+    "SELECT sound_volume, music_volume, fullscreen, "
+    "resolution_width, resolution_height, fullscreen_mode, vsync "
+    "FROM settings WHERE id = 1;",
+    
+    // STMT_SAVE_SETTINGS
+    "INSERT OR REPLACE INTO settings "
+    "(id, sound_volume, music_volume, fullscreen, "
+    "resolution_width, resolution_height, fullscreen_mode, vsync) "
+    "VALUES (1, ?, ?, ?, ?, ?, ?, ?);",
+    
+    // STMT_INSERT_HIGH_SCORE
+    "INSERT INTO high_scores (player_name, score, difficulty, timestamp) "
+    "VALUES (?, ?, ?, ?);",
+    
+    // STMT_SELECT_HIGH_SCORES: top of the leaderboard for the cache (ties oldest first)
+    "SELECT id, player_name, score, difficulty, timestamp "
+    "FROM high_scores "
+    "WHERE difficulty = ? "
+    "ORDER BY score DESC, id ASC "
+    "LIMIT ?;",
+    
+    // STMT_COUNT_HIGH_SCORES
+    "SELECT COUNT(*) FROM high_scores;",
+    
+    // STMT_COUNT_DIFFICULTY_SCORES
+    "SELECT TOTAL(count) FROM high_score_buckets WHERE difficulty = ?;",
+    
+    // STMT_COUNT_BUCKETS_ABOVE: scores in every bucket above a bucket
+    "SELECT TOTAL(count) FROM high_score_buckets WHERE difficulty = ? AND bucket > ?;",
+    
+    // STMT_COUNT_SCORES_ABOVE: scores in (low, high], one bucket at most (idx_difficulty_score)
+    "SELECT COUNT(*) FROM high_scores WHERE difficulty = ? AND score > ? AND score <= ?;",
+    
+    // STMT_SCAN_BUCKETS: walk the buckets from the top to find a position
+    "SELECT bucket, count FROM high_score_buckets "
+    "WHERE difficulty = ? AND count > 0 "
+    "ORDER BY bucket DESC;",
+    
+    // STMT_SELECT_SCORES_FROM: leaderboard order starting at the highest score <= a score
+    "SELECT id, player_name, score, difficulty, timestamp "
+    "FROM high_scores "
+    "WHERE difficulty = ? AND score <= ? "
+    "ORDER BY score DESC, id ASC "
+    "LIMIT ? OFFSET ?;",
+    
+    // STMT_SELECT_SCORES_ABOVE: the entries just above a score, nearest first
+    "SELECT id, player_name, score, difficulty, timestamp "
+    "FROM high_scores "
+    "WHERE difficulty = ? AND score > ? "
+    "ORDER BY score ASC, id DESC "
+    "LIMIT ?;",
+    
+    // STMT_INSERT_RUN
+    "INSERT INTO runs (timestamp, difficulty, score, duration, level_reached, outcome, death_cause, "
+    "frame_count, frame_time_p50, frame_time_p90, frame_time_p99, frame_time_max) "
+    "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);",
+    
+    // STMT_INSERT_RUN_PHASE
+    "INSERT INTO run_phases (run_id, phase, level, start_time, duration, score, kills) "
+    "VALUES (?, ?, ?, ?, ?, ?, ?);",
+    
+    // STMT_INSERT_RUN_ENEMY
+    "INSERT INTO run_enemy_stats (run_id, enemy_type, kills, damage) VALUES (?, ?, ?, ?);",
+    
+    // STMT_INSERT_RUN_POWERUP
+    "INSERT INTO run_powerup_stats (run_id, powerup_type, collected) VALUES (?, ?, ?);",
+    
+    // STMT_RUN_TOTALS
+    "SELECT COUNT(*), "
+    "TOTAL(outcome = 1), TOTAL(outcome = 0), TOTAL(outcome = 2), "
+    "IFNULL(MAX(score), 0), IFNULL(AVG(score), 0), TOTAL(duration), IFNULL(MAX(duration), 0), "
+    "IFNULL(AVG(frame_time_p99), 0) "
+    "FROM runs;",
+    
+    // STMT_RUN_ENEMY_TOTALS (covered by idx_run_enemy_stats_type)
+    "SELECT enemy_type, SUM(kills), SUM(damage) "
+    "FROM run_enemy_stats "
+    "GROUP BY enemy_type "
+    "ORDER BY SUM(kills) DESC, enemy_type ASC;",
+    
+    // STMT_RUN_POWERUP_TOTALS (covered by idx_run_powerup_stats_type)
+    "SELECT powerup_type, SUM(collected) "
+    "FROM run_powerup_stats "
+    "GROUP BY powerup_type "
+    "ORDER BY SUM(collected) DESC, powerup_type ASC;",
+    
+    // STMT_RUN_PHASE_TOTALS (covered by idx_run_phases_level)
+    "SELECT level, COUNT(*), AVG(duration), AVG(score), AVG(kills) "
+    "FROM run_phases "
+    "GROUP BY level "
+    "ORDER BY level ASC;",
+    
+    // STMT_RECENT_RUNS (idx_runs_timestamp)
+    "SELECT id, timestamp, difficulty, score, duration, level_reached, outcome, death_cause, "
+    "frame_count, frame_time_p50, frame_time_p90, frame_time_p99, frame_time_max "
+    "FROM runs "
+    "ORDER BY timestamp DESC, id DESC "
+    "LIMIT ?;",
+    
+    // STMT_INSERT_REPLAY: the input data is streamed into the zeroblob afterwards
+    "INSERT INTO replays (high_score_id, format_version, seed, start_level, final_level, "
+    "tick_rate, tick_count, score, data) "
+    "VALUES (?, ?, ?, ?, ?, ?, ?, ?, zeroblob(?));",
+    
+    // STMT_SELECT_REPLAY (length() reads the blob size without loading it)
+    "SELECT id, high_score_id, format_version, seed, start_level, final_level, "
+    "tick_rate, tick_count, score, length(data) "
+    "FROM replays WHERE id = ?;",
+    
+    // STMT_SELECT_HIGH_SCORE_REPLAY (idx_replays_high_score)
+    "SELECT id, high_score_id, format_version, seed, start_level, final_level, "
+    "tick_rate, tick_count, score, length(data) "
+    "FROM replays WHERE high_score_id = ?;"
+};
+
+static sqlite3_stmt* statements[STMT_COUNT] = {0};
+
+// Second connection for the writes, with its own statements. db and its statements belong to the
+// calling thread (reads); WAL lets them read while a write batch is open, so reads never wait
+// for the writer. The lock serializes the write connection between the writer thread and the
+// synchronous writes (imports, clearing, writes while the writer is not running).
+static sqlite3* writeDb = NULL;
+static sqlite3_stmt* writeStatements[STMT_COUNT] = {0};
+static pthread_mutex_t writeConnectionLock = PTHREAD_MUTEX_INITIALIZER;
+
+// Writer thread: performs every settings/high score/run write off the render thread.
+// The queue state below is protected by writerLock.
+#define DB_WRITE_QUEUE_SIZE 64
+#define DB_RUN_QUEUE_SIZE 8             // Runs end at most every few seconds (restart)
+#define DB_SETTINGS_DEBOUNCE_MS 300.0   // Settings changes closer together than this become one write
+#define DB_REPLAY_CHUNK_SIZE 4096       // Bytes per incremental blob write
+
+static pthread_t writerThread;
+static bool writerRunning = false;
+static bool writerStopping = false;
+static pthread_mutex_t writerLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t writerWake = PTHREAD_COND_INITIALIZER;
+
+// Replay queued with a high score (data is owned by the queue and freed once written)
+typedef struct {
+    DBReplayInfo info;
+    unsigned char* data;
+} QueuedReplay;
+
+static HighScoreEntry scoreQueue[DB_WRITE_QUEUE_SIZE];
+static QueuedReplay scoreReplayQueue[DB_WRITE_QUEUE_SIZE];
+static int scoreQueueCount = 0;
+static DBRunRecord runQueue[DB_RUN_QUEUE_SIZE];
+static int runQueueCount = 0;
+static UserSettings pendingSettings;
+static int pendingSettingsChanges = 0;  // 0 = nothing to write
+static double pendingSettingsDue = 0.0;
+
+static DBWriteResult completions[DB_WRITE_QUEUE_SIZE];
+static int completionCount = 0;
+static unsigned int droppedScoreDifficulties = 0;  // Bit per difficulty whose score result was dropped
+static DBWriteCallback writeCallback = NULL;
+static void* writeCallbackData = NULL;
+
+// Settings as last loaded or saved, so reads never wait for the writer
+static UserSettings cachedSettings;
+static bool settingsCached = false;
+
+// In-memory leaderboard per difficulty, sorted by score (highest first, oldest first on ties).
+// Loaded on first use and kept in sync by DB_AddHighScore, so reads never touch SQLite. A queued
+// score shows up at once (id 0) and DB_Update settles it when the write finishes.
+typedef struct {
+    HighScoreEntry* entries;
+    int count;
+    int capacity;
+    bool loaded;
+} HighScoreCache;
+
+static HighScoreCache highScoreCache[DIFFICULTY_COUNT] = {0};
+
 // High score presets based on legendary game developers
 typedef struct {
     const char* name;
@@ -123,6 +342,16 @@ static bool CreateDirectoryIfNeeded(const char* path) {
     return true;
 }
 
+// Use a database file other than the per-user default (call before DB_Init)
+bool DB_SetDatabasePath(const char* path) {
+    if (db || !path || strlen(path) >= sizeof(dbPath)) {
+        return false;
+    }
+    
+    strcpy(dbPath, path);
+    return true;
+}
+
 // Get the database file path
 const char* DB_GetDatabasePath(void) {
     if (dbPath[0] == '\0') {
@@ -155,224 +384,237 @@ const char* DB_GetDatabasePath(void) {
     return dbPath;
 }
 
-// Populate high scores with legendary developer presets
-static void PopulateHighScorePresets(void) {
-    if (!db) {
-        return;
+// Monotonic time in milliseconds (startup timing)
+static double NowMilliseconds(void) {
+#ifdef _WIN32
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000.0 + now.tv_nsec / 1000000.0;
+#endif
+}
+
+// Prepare every statement once on a connection (after the schema is up to date)
+static bool PrepareStatements(sqlite3* connection, sqlite3_stmt** prepared) {
+    for (int i = 0; i < STMT_COUNT; i++) {
+        int rc = sqlite3_prepare_v3(connection, STATEMENT_SQL[i], -1, SQLITE_PREPARE_PERSISTENT, &prepared[i], NULL);
+        if (rc != SQLITE_OK) {
+            fprintf(stderr, "Failed to prepare statement: %s\n", sqlite3_errmsg(connection));
+            return false;
+        }
     }
-    
-    // Check if high_scores table is empty
-    const char* countQuery = "SELECT COUNT(*) FROM high_scores;";
-    sqlite3_stmt* stmt = NULL;
-    
-    int rc = sqlite3_prepare_v2(db, countQuery, -1, &stmt, NULL);
-    if (rc != SQLITE_OK) {
-        fprintf(stderr, "Failed to check high scores: %s\n", sqlite3_errmsg(db));
-        return;
+    return true;
+}
+
+static void FinalizeStatements(sqlite3_stmt** prepared) {
+    for (int i = 0; i < STMT_COUNT; i++) {
+        sqlite3_finalize(prepared[i]);
+        prepared[i] = NULL;
     }
-    
-    if (sqlite3_step(stmt) == SQLITE_ROW) {
-        int count = sqlite3_column_int(stmt, 0);
-        sqlite3_finalize(stmt);
-        
-        if (count > 0) {
-            // High scores already exist, don't populate
-            return;
-        }
-    } else {
-        sqlite3_finalize(stmt);
-        return;
+}
+
+// Reset a cached statement and clear its bindings (NULL passes through)
+static sqlite3_stmt* ResetStatement(sqlite3_stmt* stmt) {
+    if (stmt) {
+        sqlite3_reset(stmt);
+        sqlite3_clear_bindings(stmt);
+    }
+    return stmt;
+}
+
+// Cached statement ready for binding (NULL if the database is closed)
+static sqlite3_stmt* GetStatement(StatementId id) {
+    return ResetStatement(statements[id]);
+}
+
+// Same on the write connection (caller holds writeConnectionLock)
+static sqlite3_stmt* GetWriteStatement(StatementId id) {
+    return ResetStatement(writeStatements[id]);
+}
+
+// Reset after use so a finished SELECT does not keep its read transaction open
+static void ReleaseStatement(sqlite3_stmt* stmt) {
+    sqlite3_reset(stmt);
+}
+
+// Drop the cached leaderboard for a difficulty (reloaded on next use)
+static void InvalidateHighScoreCache(DifficultyLevel difficulty) {
+    HighScoreCache* cache = &highScoreCache[difficulty];
+    free(cache->entries);
+    memset(cache, 0, sizeof(HighScoreCache));
+}
+
+static bool ReserveHighScoreCache(HighScoreCache* cache, int capacity) {
+    if (capacity <= cache->capacity) {
+        return true;
     }
     
-    // Table is empty, populate with presets
-    printf("Populating high scores with legendary game developers...\n");
+    int newCapacity = cache->capacity > 0 ? cache->capacity : 16;
+    while (newCapacity < capacity) {
+        newCapacity *= 2;
+    }
     
-    int successCount = 0;
-    for (int i = 0; i < PRESET_COUNT; i++) {
-        const HighScorePreset* preset = &PRESETS[i];
-        
-        if (DB_AddHighScore(preset->name, preset->score, preset->difficulty)) {
-            successCount++;
-        }
+    HighScoreEntry* entries = (HighScoreEntry*)realloc(cache->entries, sizeof(HighScoreEntry) * newCapacity);
+    if (!entries) {
+        return false;
     }
     
-    printf("✓ Added %d legendary developer high scores\n", successCount);
+    cache->entries = entries;
+    cache->capacity = newCapacity;
+    return true;
 }
 
-// Migrate database schema to add new columns
-static void MigrateSchema(void) {
-    // Check if new columns exist, if not add them
-    const char* alterQueries[] = {
-        "ALTER TABLE settings ADD COLUMN resolution_width INTEGER DEFAULT 1200;",
-        "ALTER TABLE settings ADD COLUMN resolution_height INTEGER DEFAULT 600;",
-        "ALTER TABLE settings ADD COLUMN fullscreen_mode INTEGER DEFAULT 0;",
-        "ALTER TABLE settings ADD COLUMN vsync INTEGER DEFAULT 1;"
-    };
+// Number of cached entries with a score >= the given score (binary search)
+static int CountScoresAtLeast(const HighScoreCache* cache, int score) {
+    int low = 0;
+    int high = cache->count;
     
-    for (int i = 0; i < 4; i++) {
-        char* errMsg = NULL;
-        int rc = sqlite3_exec(db, alterQueries[i], NULL, NULL, &errMsg);
-        if (rc != SQLITE_OK) {
-            // Ignore errors (column might already exist)
-            sqlite3_free(errMsg);
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (cache->entries[mid].score >= score) {
+            low = mid + 1;
+        } else {
+            high = mid;
         }
     }
+    
+    return low;
 }
 
-// Initialize the database
-bool DB_Init(void) {
-    const char* path = DB_GetDatabasePath();
-    if (!path) {
-        return false;
+// Load a difficulty's top scores into the cache (one query per difficulty per session)
+static HighScoreCache* GetHighScoreCache(DifficultyLevel difficulty) {
+    if (!db || difficulty < 0 || difficulty >= DIFFICULTY_COUNT) {
+        return NULL;
     }
     
-    // Open database
-    int rc = sqlite3_open(path, &db);
-    if (rc != SQLITE_OK) {
-        fprintf(stderr, "Failed to open database: %s\n", sqlite3_errmsg(db));
-        sqlite3_close(db);
-        db = NULL;
-        return false;
+    HighScoreCache* cache = &highScoreCache[difficulty];
+    if (cache->loaded) {
+        return cache;
     }
     
-    // Create settings table with all columns
-    const char* createSettingsTable = 
-        "CREATE TABLE IF NOT EXISTS settings ("
-        "    id INTEGER PRIMARY KEY CHECK (id = 1),"
-        "    sound_volume REAL DEFAULT 1.0,"
-        "    music_volume REAL DEFAULT 0.5,"
-        "    fullscreen INTEGER DEFAULT 0,"
-        "    resolution_width INTEGER DEFAULT 1200,"
-        "    resolution_height INTEGER DEFAULT 600,"
-        "    fullscreen_mode INTEGER DEFAULT 0,"
-        "    vsync INTEGER DEFAULT 1"
-        ");";
-    
-    char* errMsg = NULL;
-    rc = sqlite3_exec(db, createSettingsTable, NULL, NULL, &errMsg);
-    if (rc != SQLITE_OK) {
-        fprintf(stderr, "Failed to create settings table: %s\n", errMsg);
-        sqlite3_free(errMsg);
-        DB_Cleanup();
-        return false;
+    sqlite3_stmt* stmt = GetStatement(STMT_SELECT_HIGH_SCORES);
+    if (!stmt) {
+        return NULL;
     }
     
-    // Create high_scores table
-    const char* createHighScoresTable = 
-        "CREATE TABLE IF NOT EXISTS high_scores ("
-        "    id INTEGER PRIMARY KEY AUTOINCREMENT,"
-        "    player_name TEXT NOT NULL,"
-        "    score INTEGER NOT NULL,"
-        "    difficulty INTEGER NOT NULL,"
-        "    timestamp INTEGER NOT NULL"
-        ");";
+    sqlite3_bind_int(stmt, 1, (int)difficulty);
+    sqlite3_bind_int(stmt, 2, DB_HIGH_SCORES_PER_DIFFICULTY);
     
-    rc = sqlite3_exec(db, createHighScoresTable, NULL, NULL, &errMsg);
-    if (rc != SQLITE_OK) {
-        fprintf(stderr, "Failed to create high_scores table: %s\n", errMsg);
-        sqlite3_free(errMsg);
-        DB_Cleanup();
-        return false;
+    int rc;
+    cache->count = 0;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        if (!ReserveHighScoreCache(cache, cache->count + 1)) {
+            rc = SQLITE_NOMEM;
+            break;
+        }
+        
+        HighScoreEntry* entry = &cache->entries[cache->count];
+        entry->id = sqlite3_column_int(stmt, 0);
+        
+        const char* name = (const char*)sqlite3_column_text(stmt, 1);
+        strncpy(entry->playerName, name ? name : "Unknown", sizeof(entry->playerName) - 1);
+        entry->playerName[sizeof(entry->playerName) - 1] = '\0';
+        
+        entry->score = sqlite3_column_int(stmt, 2);
+        entry->difficulty = (DifficultyLevel)sqlite3_column_int(stmt, 3);
+        entry->timestamp = sqlite3_column_int64(stmt, 4);
+        
+        cache->count++;
     }
     
-    // Create index on difficulty for faster queries
-    const char* createIndex = 
-        "CREATE INDEX IF NOT EXISTS idx_difficulty_score "
-        "ON high_scores(difficulty, score DESC);";
+    ReleaseStatement(stmt);
+    if (rc != SQLITE_DONE) {
+        fprintf(stderr, "Failed to load high scores: %s\n", sqlite3_errmsg(db));
+        InvalidateHighScoreCache(difficulty);
+        return NULL;
+    }
     
-    rc = sqlite3_exec(db, createIndex, NULL, NULL, &errMsg);
-    if (rc != SQLITE_OK) {
-        fprintf(stderr, "Failed to create index: %s\n", errMsg);
-        sqlite3_free(errMsg);
-        // Continue anyway, index is just for performance
+    cache->loaded = true;
+    return cache;
+}
+
+// Mirror a queued score into the cache, keeping the same top-N as the database
+static void InsertCachedHighScore(const HighScoreEntry* entry) {
+    HighScoreCache* cache = &highScoreCache[entry->difficulty];
+    if (!cache->loaded) {
+        return;
     }
     
-    // Migrate schema for existing databases
-    MigrateSchema();
+    if (!ReserveHighScoreCache(cache, cache->count + 1)) {
+        InvalidateHighScoreCache(entry->difficulty);
+        return;
+    }
     
-    // Populate high scores with presets if table is empty
-    PopulateHighScorePresets();
+    // Newest entry goes after older entries with the same score
+    int position = CountScoresAtLeast(cache, entry->score);
+    memmove(&cache->entries[position + 1], &cache->entries[position],
+            sizeof(HighScoreEntry) * (cache->count - position));
+    cache->entries[position] = *entry;
+    cache->count++;
     
-    printf("Database initialized at: %s\n", path);
-    return true;
-}
-
-// Cleanup the database
-void DB_Cleanup(void) {
-    if (db) {
-        sqlite3_close(db);
-        db = NULL;
+    if (cache->count > DB_HIGH_SCORES_PER_DIFFICULTY) {
+        cache->count = DB_HIGH_SCORES_PER_DIFFICULTY;
     }
 }
 
-// Load user settings from database
-bool DB_LoadSettings(UserSettings* settings) {
-    if (!db || !settings) {
-        return false;
+// Settle the cache entry of a queued score once the writer is done with it
+static void ApplyHighScoreResult(const DBWriteResult* result) {
+    const HighScoreEntry* stored = &result->highScore;
+    if (stored->difficulty < 0 || stored->difficulty >= DIFFICULTY_COUNT) {
+        return;
     }
     
-    const char* query = 
-        "SELECT sound_volume, music_volume, fullscreen, "
-        "resolution_width, resolution_height, fullscreen_mode, vsync "
-        "FROM settings WHERE id = 1;";
-    sqlite3_stmt* stmt = NULL;
+    // The queued score is in the cache without an id; a failed write must not stay there
+    if (!result->success) {
+        InvalidateHighScoreCache(stored->difficulty);
+        return;
+    }
     
-    int rc = sqlite3_prepare_v2(db, query, -1, &stmt, NULL);
-    if (rc != SQLITE_OK) {
-        fprintf(stderr, "Failed to prepare statement: %s\n", sqlite3_errmsg(db));
-        return false;
+    HighScoreCache* cache = &highScoreCache[stored->difficulty];
+    if (!cache->loaded) {
+        return;
     }
     
-    rc = sqlite3_step(stmt);
-    if (rc == SQLITE_ROW) {
-        settings->soundVolume = (float)sqlite3_column_double(stmt, 0);
-        settings->musicVolume = (float)sqlite3_column_double(stmt, 1);
-        settings->fullscreen = sqlite3_column_int(stmt, 2) != 0;
-        settings->resolutionWidth = sqlite3_column_int(stmt, 3);
-        settings->resolutionHeight = sqlite3_column_int(stmt, 4);
-        settings->fullscreenMode = sqlite3_column_int(stmt, 5);
-        settings->vsync = sqlite3_column_int(stmt, 6) != 0;
-        
-        sqlite3_finalize(stmt);
-        return true;
-    } else if (rc == SQLITE_DONE) {
-        // No settings found, use defaults
-        settings->soundVolume = 1.0f;
-        settings->musicVolume = 0.5f;
-        settings->fullscreen = false;
-        settings->resolutionWidth = 1200;
-        settings->resolutionHeight = 600;
-        settings->fullscreenMode = 0;  // FULLSCREEN_OFF
-        settings->vsync = true;
-        
-        sqlite3_finalize(stmt);
-        
-        // Save default settings
-        DB_SaveSettings(settings);
-        return true;
+    for (int i = 0; i < cache->count; i++) {
+        HighScoreEntry* entry = &cache->entries[i];
+        if (entry->id == stored->id) {
+            return;
+        }
+        if (entry->id == 0 && entry->score == stored->score && entry->timestamp == stored->timestamp &&
+            strcmp(entry->playerName, stored->playerName) == 0) {
+            entry->id = stored->id;
+            return;
+        }
     }
     
-    sqlite3_finalize(stmt);
-    return false;
+    // Reloaded while the score was queued (after another write failed)
+    InsertCachedHighScore(stored);
 }
 
-// Save user settings to database
-bool DB_SaveSettings(const UserSettings* settings) {
-    if (!db || !settings) {
+// Run a statement that returns no rows on a connection, reporting errors with a description
+static bool ExecSQLOn(sqlite3* connection, const char* sql, const char* description) {
+    char* errMsg = NULL;
+    int rc = sqlite3_exec(connection, sql, NULL, NULL, &errMsg);
+    if (rc != SQLITE_OK) {
+        fprintf(stderr, "Failed to %s: %s\n", description, errMsg ? errMsg : sqlite3_errmsg(connection));
+        sqlite3_free(errMsg);
         return false;
     }
-    
-    const char* query = 
-        "INSERT OR REPLACE INTO settings "
-        "(id, sound_volume, music_volume, fullscreen, "
-        "resolution_width, resolution_height, fullscreen_mode, vsync) "
-        "VALUES (1, ?, ?, ?, ?, ?, ?, ?);";
-    
-    sqlite3_stmt* stmt = NULL;
-    
-    int rc = sqlite3_prepare_v2(db, query, -1, &stmt, NULL);
-    if (rc != SQLITE_OK) {
-        fprintf(stderr, "Failed to prepare statement: %s\n", sqlite3_errmsg(db));
+    return true;
+}
+
+static bool ExecSQL(const char* sql, const char* description) {
+    return ExecSQLOn(db, sql, description);
+}
+
+// Write settings (caller holds writeConnectionLock)
+static bool WriteSettings(const UserSettings* settings) {
+    sqlite3_stmt* stmt = GetWriteStatement(STMT_SAVE_SETTINGS);
+    if (!stmt) {
         return false;
     }
     
@@ -384,112 +626,920 @@ bool DB_SaveSettings(const UserSettings* settings) {
     sqlite3_bind_int(stmt, 6, settings->fullscreenMode);
     sqlite3_bind_int(stmt, 7, settings->vsync ? 1 : 0);
     
-    rc = sqlite3_step(stmt);
-    sqlite3_finalize(stmt);
+    int rc = sqlite3_step(stmt);
+    ReleaseStatement(stmt);
     
     if (rc != SQLITE_DONE) {
-        fprintf(stderr, "Failed to save settings: %s\n", sqlite3_errmsg(db));
+        fprintf(stderr, "Failed to save settings: %s\n", sqlite3_errmsg(writeDb));
         return false;
     }
     
     return true;
 }
 
-// Add a high score to the database
-bool DB_AddHighScore(const char* playerName, int score, DifficultyLevel difficulty) {
-    if (!db || !playerName) {
-        return false;
-    }
-    
-    const char* query = 
-        "INSERT INTO high_scores (player_name, score, difficulty, timestamp) "
-        "VALUES (?, ?, ?, ?);";
-    
-    sqlite3_stmt* stmt = NULL;
-    
-    int rc = sqlite3_prepare_v2(db, query, -1, &stmt, NULL);
-    if (rc != SQLITE_OK) {
-        fprintf(stderr, "Failed to prepare statement: %s\n", sqlite3_errmsg(db));
+// Insert a high score; every score is kept as history (caller holds writeConnectionLock)
+static bool WriteHighScore(HighScoreEntry* entry) {
+    sqlite3_stmt* stmt = GetWriteStatement(STMT_INSERT_HIGH_SCORE);
+    if (!stmt) {
         return false;
     }
     
-    sqlite3_bind_text(stmt, 1, playerName, -1, SQLITE_TRANSIENT);
-    sqlite3_bind_int(stmt, 2, score);
-    sqlite3_bind_int(stmt, 3, (int)difficulty);
-    sqlite3_bind_int64(stmt, 4, (long)time(NULL));
+    sqlite3_bind_text(stmt, 1, entry->playerName, -1, SQLITE_TRANSIENT);
+    sqlite3_bind_int(stmt, 2, entry->score);
+    sqlite3_bind_int(stmt, 3, (int)entry->difficulty);
+    sqlite3_bind_int64(stmt, 4, entry->timestamp);
     
-    rc = sqlite3_step(stmt);
-    sqlite3_finalize(stmt);
+    int rc = sqlite3_step(stmt);
+    ReleaseStatement(stmt);
     
     if (rc != SQLITE_DONE) {
-        fprintf(stderr, "Failed to add high score: %s\n", sqlite3_errmsg(db));
+        fprintf(stderr, "Failed to add high score: %s\n", sqlite3_errmsg(writeDb));
         return false;
     }
     
-    // Keep only top 10 scores per difficulty
-    const char* cleanupQuery = 
-        "DELETE FROM high_scores "
-        "WHERE difficulty = ? "
-        "AND id NOT IN ("
-        "    SELECT id FROM high_scores "
-        "    WHERE difficulty = ? "
-        "    ORDER BY score DESC "
-        "    LIMIT 10"
-        ");";
-    
-    rc = sqlite3_prepare_v2(db, cleanupQuery, -1, &stmt, NULL);
-    if (rc == SQLITE_OK) {
-        sqlite3_bind_int(stmt, 1, (int)difficulty);
-        sqlite3_bind_int(stmt, 2, (int)difficulty);
-        sqlite3_step(stmt);
-        sqlite3_finalize(stmt);
-    }
-    
+    entry->id = (int)sqlite3_last_insert_rowid(writeDb);
     return true;
 }
 
-// Get high scores for a specific difficulty
-bool DB_GetHighScores(DifficultyLevel difficulty, HighScoreEntry* entries, int maxEntries, int* outCount) {
-    if (!db || !entries || !outCount) {
+// Step a bound insert statement and reset it
+static bool StepInsert(sqlite3_stmt* stmt) {
+    int rc = sqlite3_step(stmt);
+    ReleaseStatement(stmt);
+    return rc == SQLITE_DONE;
+}
+
+// Insert a run and its detail rows, all or nothing (caller holds writeConnectionLock).
+// The savepoint nests inside the writer's batch transaction, or acts as one on its own.
+static bool WriteRun(DBRunRecord* run) {
+    if (!writeStatements[STMT_INSERT_RUN] || !ExecSQLOn(writeDb, "SAVEPOINT write_run;", "begin run write")) {
         return false;
     }
     
-    *outCount = 0;
+    sqlite3_stmt* stmt = GetWriteStatement(STMT_INSERT_RUN);
+    sqlite3_bind_int64(stmt, 1, run->timestamp);
+    sqlite3_bind_int(stmt, 2, (int)run->difficulty);
+    sqlite3_bind_int(stmt, 3, run->score);
+    sqlite3_bind_double(stmt, 4, run->duration);
+    sqlite3_bind_int(stmt, 5, run->levelReached);
+    sqlite3_bind_int(stmt, 6, (int)run->outcome);
+    sqlite3_bind_text(stmt, 7, run->deathCause, -1, SQLITE_TRANSIENT);
+    sqlite3_bind_int(stmt, 8, run->frameCount);
+    sqlite3_bind_double(stmt, 9, run->frameTimeP50);
+    sqlite3_bind_double(stmt, 10, run->frameTimeP90);
+    sqlite3_bind_double(stmt, 11, run->frameTimeP99);
+    sqlite3_bind_double(stmt, 12, run->frameTimeMax);
+    
+    bool ok = StepInsert(stmt);
+    if (ok) {
+        run->id = (int)sqlite3_last_insert_rowid(writeDb);
+    }
+    
+    for (int i = 0; ok && i < run->phaseCount; i++) {
+        const DBRunPhase* phase = &run->phases[i];
+        stmt = GetWriteStatement(STMT_INSERT_RUN_PHASE);
+        sqlite3_bind_int(stmt, 1, run->id);
+        sqlite3_bind_int(stmt, 2, i);
+        sqlite3_bind_int(stmt, 3, phase->level);
+        sqlite3_bind_double(stmt, 4, phase->startTime);
+        sqlite3_bind_double(stmt, 5, phase->duration);
+        sqlite3_bind_int(stmt, 6, phase->score);
+        sqlite3_bind_int(stmt, 7, phase->kills);
+        ok = StepInsert(stmt);
+    }
+    
+    for (int i = 0; ok && i < run->enemyTypeCount; i++) {
+        const DBRunEnemyStats* enemy = &run->enemies[i];
+        stmt = GetWriteStatement(STMT_INSERT_RUN_ENEMY);
+        sqlite3_bind_int(stmt, 1, run->id);
+        sqlite3_bind_text(stmt, 2, enemy->name, -1, SQLITE_TRANSIENT);
+        sqlite3_bind_int(stmt, 3, enemy->kills);
+        sqlite3_bind_int(stmt, 4, enemy->damage);
+        ok = StepInsert(stmt);
+    }
+    
+    for (int i = 0; ok && i < run->powerupTypeCount; i++) {
+        const DBRunPowerupStats* powerup = &run->powerups[i];
+        stmt = GetWriteStatement(STMT_INSERT_RUN_POWERUP);
+        sqlite3_bind_int(stmt, 1, run->id);
+        sqlite3_bind_text(stmt, 2, powerup->name, -1, SQLITE_TRANSIENT);
+        sqlite3_bind_int(stmt, 3, powerup->collected);
+        ok = StepInsert(stmt);
+    }
+    
+    if (!ok) {
+        fprintf(stderr, "Failed to record run: %s\n", sqlite3_errmsg(writeDb));
+        ExecSQLOn(writeDb, "ROLLBACK TO write_run;", "roll back run write");
+        run->id = 0;
+    }
+    ExecSQLOn(writeDb, "RELEASE write_run;", "finish run write");
+    
+    return ok;
+}
+
+// Insert a replay for a stored high score (caller holds writeConnectionLock). The row is created
+// with a zeroblob and the input data streamed into it in chunks, so SQLite never holds a
+// second copy of the whole replay.
+static bool WriteReplay(DBReplayInfo* replay, const unsigned char* data) {
+    if (!writeStatements[STMT_INSERT_REPLAY] || !ExecSQLOn(writeDb, "SAVEPOINT write_replay;", "begin replay write")) {
+        return false;
+    }
+    
+    sqlite3_stmt* stmt = GetWriteStatement(STMT_INSERT_REPLAY);
+    sqlite3_bind_int(stmt, 1, replay->highScoreId);
+    sqlite3_bind_int(stmt, 2, replay->formatVersion);
+    sqlite3_bind_int64(stmt, 3, (sqlite3_int64)replay->seed);
+    sqlite3_bind_int(stmt, 4, replay->startLevel);
+    sqlite3_bind_int(stmt, 5, replay->finalLevel);
+    sqlite3_bind_int(stmt, 6, replay->tickRate);
+    sqlite3_bind_int(stmt, 7, replay->tickCount);
+    sqlite3_bind_int(stmt, 8, replay->score);
+    sqlite3_bind_int(stmt, 9, replay->dataSize);
+    
+    bool ok = StepInsert(stmt);
+    if (ok) {
+        replay->id = (int)sqlite3_last_insert_rowid(writeDb);
+    }
+    
+    sqlite3_blob* blob = NULL;
+    if (ok && sqlite3_blob_open(writeDb, "main", "replays", "data", replay->id, 1, &blob) != SQLITE_OK) {
+        ok = false;
+    }
+    for (int offset = 0; ok && offset < replay->dataSize; offset += DB_REPLAY_CHUNK_SIZE) {
+        int chunk = replay->dataSize - offset < DB_REPLAY_CHUNK_SIZE ? replay->dataSize - offset : DB_REPLAY_CHUNK_SIZE;
+        ok = sqlite3_blob_write(blob, data + offset, chunk, offset) == SQLITE_OK;
+    }
+    if (blob && sqlite3_blob_close(blob) != SQLITE_OK) {
+        ok = false;
+    }
+    
+    if (!ok) {
+        fprintf(stderr, "Failed to save replay: %s\n", sqlite3_errmsg(writeDb));
+        ExecSQLOn(writeDb, "ROLLBACK TO write_replay;", "roll back replay write");
+        replay->id = 0;
+    }
+    ExecSQLOn(writeDb, "RELEASE write_replay;", "finish replay write");
+    
+    return ok;
+}
+
+// Write a queued high score and its replay, if any (caller holds writeConnectionLock)
+static bool WriteQueuedHighScore(HighScoreEntry* entry, QueuedReplay* replay) {
+    if (!WriteHighScore(entry)) {
+        return false;
+    }
+    
+    // A replay that fails to save does not cost the player the score
+    if (replay->data) {
+        replay->info.highScoreId = entry->id;
+        WriteReplay(&replay->info, replay->data);
+    }
+    return true;
+}
+
+// Queue a finished write for DB_Update (caller holds writerLock)
+static void PublishWriteResult(const DBWriteResult* result) {
+    if (completionCount >= DB_WRITE_QUEUE_SIZE) {
+        // Nobody is calling DB_Update; drop the oldest result
+        if (completions[0].type == DB_WRITE_HIGH_SCORE) {
+            droppedScoreDifficulties |= 1u << completions[0].highScore.difficulty;
+        }
+        memmove(&completions[0], &completions[1], sizeof(DBWriteResult) * (DB_WRITE_QUEUE_SIZE - 1));
+        completionCount--;
+    }
+    completions[completionCount++] = *result;
+}
+
+// Wait on writerWake for at most the given time (caller holds writerLock)
+static void WaitForWriterWork(double milliseconds) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    long long nanoseconds = deadline.tv_nsec + (long long)(milliseconds * 1000000.0);
+    deadline.tv_sec += (time_t)(nanoseconds / 1000000000LL);
+    deadline.tv_nsec = (long)(nanoseconds % 1000000000LL);
+    pthread_cond_timedwait(&writerWake, &writerLock, &deadline);
+}
+
+// Writes every queued high score and run, plus the settings once their debounce expired,
+// in one transaction per batch. Flushes everything when stopping.
+static void* WriterThreadMain(void* arg) {
+    (void)arg;
+    HighScoreEntry scores[DB_WRITE_QUEUE_SIZE];
+    QueuedReplay replays[DB_WRITE_QUEUE_SIZE];
+    static DBRunRecord runs[DB_RUN_QUEUE_SIZE];   // Only touched by the writer thread
+    
+    pthread_mutex_lock(&writerLock);
+    while (true) {
+        double now = NowMilliseconds();
+        bool settingsReady = pendingSettingsChanges > 0 && (writerStopping || now >= pendingSettingsDue);
+        
+        if (scoreQueueCount == 0 && runQueueCount == 0 && !settingsReady) {
+            if (writerStopping) {
+                break;
+            }
+            if (pendingSettingsChanges > 0) {
+                WaitForWriterWork(pendingSettingsDue - now);
+            } else {
+                pthread_cond_wait(&writerWake, &writerLock);
+            }
+            continue;
+        }
+        
+        // Take the batch and let callers keep queueing while it is written
+        int scoreCount = scoreQueueCount;
+        memcpy(scores, scoreQueue, sizeof(HighScoreEntry) * scoreCount);
+        memcpy(replays, scoreReplayQueue, sizeof(QueuedReplay) * scoreCount);
+        scoreQueueCount = 0;
+        
+        int runCount = runQueueCount;
+        memcpy(runs, runQueue, sizeof(DBRunRecord) * runCount);
+        runQueueCount = 0;
+        
+        UserSettings settings = pendingSettings;
+        int settingsChanges = settingsReady ? pendingSettingsChanges : 0;
+        if (settingsReady) {
+            pendingSettingsChanges = 0;
+        }
+        pthread_mutex_unlock(&writerLock);
+        
+        double startTime = NowMilliseconds();
+        bool settingsOk = true;
+        bool scoreOk[DB_WRITE_QUEUE_SIZE];
+        bool runOk[DB_RUN_QUEUE_SIZE];
+        
+        pthread_mutex_lock(&writeConnectionLock);
+        bool transaction = ExecSQLOn(writeDb, "BEGIN;", "begin write batch");
+        if (settingsChanges > 0) {
+            settingsOk = WriteSettings(&settings);
+        }
+        for (int i = 0; i < scoreCount; i++) {
+            scoreOk[i] = WriteQueuedHighScore(&scores[i], &replays[i]);
+        }
+        for (int i = 0; i < runCount; i++) {
+            runOk[i] = WriteRun(&runs[i]);
+        }
+        if (transaction && !ExecSQLOn(writeDb, "COMMIT;", "commit write batch")) {
+            ExecSQLOn(writeDb, "ROLLBACK;", "roll back write batch");
+            settingsOk = false;
+            for (int i = 0; i < scoreCount; i++) {
+                scoreOk[i] = false;
+                replays[i].info.id = 0;
+            }
+            for (int i = 0; i < runCount; i++) {
+                runOk[i] = false;
+            }
+        }
+        pthread_mutex_unlock(&writeConnectionLock);
+        double duration = NowMilliseconds() - startTime;
+        
+        for (int i = 0; i < scoreCount; i++) {
+            free(replays[i].data);
+            replays[i].data = NULL;
+        }
+        
+        pthread_mutex_lock(&writerLock);
+        if (settingsChanges > 0) {
+            DBWriteResult result = {0};
+            result.type = DB_WRITE_SETTINGS;
+            result.success = settingsOk;
+            result.coalesced = settingsChanges;
+            result.durationMs = duration;
+            PublishWriteResult(&result);
+        }
+        for (int i = 0; i < scoreCount; i++) {
+            DBWriteResult result = {0};
+            result.type = DB_WRITE_HIGH_SCORE;
+            result.success = scoreOk[i];
+            result.coalesced = 1;
+            result.durationMs = duration;
+            result.highScore = scores[i];
+            result.replayId = replays[i].info.id;
+            PublishWriteResult(&result);
+        }
+        for (int i = 0; i < runCount; i++) {
+            DBWriteResult result = {0};
+            result.type = DB_WRITE_RUN;
+            result.success = runOk[i];
+            result.coalesced = 1;
+            result.durationMs = duration;
+            result.runId = runOk[i] ? runs[i].id : 0;
+            PublishWriteResult(&result);
+        }
+    }
+    pthread_mutex_unlock(&writerLock);
+    
+    return NULL;
+}
+
+static void StartWriter(void) {
+    writerStopping = false;
+    if (pthread_create(&writerThread, NULL, WriterThreadMain, NULL) == 0) {
+        writerRunning = true;
+    } else {
+        fprintf(stderr, "Failed to start database writer thread, writing synchronously\n");
+    }
+}
+
+// Flush pending writes and join the writer
+static void StopWriter(void) {
+    if (!writerRunning) {
+        return;
+    }
+    
+    pthread_mutex_lock(&writerLock);
+    writerStopping = true;
+    pthread_cond_signal(&writerWake);
+    pthread_mutex_unlock(&writerLock);
+    
+    pthread_join(writerThread, NULL);
+    writerRunning = false;
+    writerStopping = false;
+    
+    // Report the writes flushed at shutdown too
+    DB_Update();
+}
+
+// Populate high scores with legendary developer presets
+static void PopulateHighScorePresets(void) {
+    if (!db) {
+        return;
+    }
+    
+    // Check if high_scores table is empty
+    sqlite3_stmt* stmt = GetStatement(STMT_COUNT_HIGH_SCORES);
+    if (!stmt) {
+        return;
+    }
+    
+    int count = -1;
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        count = sqlite3_column_int(stmt, 0);
+    }
+    ReleaseStatement(stmt);
+    
+    if (count != 0) {
+        // High scores already exist (or the check failed), don't populate
+        return;
+    }
+    
+    // Table is empty, populate with presets
+    printf("Populating high scores with legendary game developers...\n");
+    
+    HighScoreEntry entries[sizeof(PRESETS) / sizeof(PRESETS[0])];
+    memset(entries, 0, sizeof(entries));
+    for (int i = 0; i < PRESET_COUNT; i++) {
+        strncpy(entries[i].playerName, PRESETS[i].name, sizeof(entries[i].playerName) - 1);
+        entries[i].score = PRESETS[i].score;
+        entries[i].difficulty = PRESETS[i].difficulty;
+    }
+    
+    if (DB_ImportHighScores(entries, PRESET_COUNT)) {
+        printf("✓ Added %d legendary developer high scores\n", PRESET_COUNT);
+    }
+}
+
+static int GetSchemaVersion(void) {
+    sqlite3_stmt* stmt = NULL;
+    int version = -1;
+    
+    if (sqlite3_prepare_v2(db, "PRAGMA user_version;", -1, &stmt, NULL) == SQLITE_OK &&
+        sqlite3_step(stmt) == SQLITE_ROW) {
+        version = sqlite3_column_int(stmt, 0);
+    }
+    sqlite3_finalize(stmt);
+    return version;
+}
+
+// Version 1: tables, score index, and the video columns older databases lack
+static bool MigrateToVersion1(void) {
+    const char* createSettingsTable = 
+        "CREATE TABLE IF NOT EXISTS settings ("
+        "    id INTEGER PRIMARY KEY CHECK (id = 1),"
+        "    sound_volume REAL DEFAULT 1.0,"
+        "    music_volume REAL DEFAULT 0.5,"
+        "    fullscreen INTEGER DEFAULT 0,"
+        "    resolution_width INTEGER DEFAULT 1200,"
+        "    resolution_height INTEGER DEFAULT 600,"
+        "    fullscreen_mode INTEGER DEFAULT 0,"
+        "    vsync INTEGER DEFAULT 1"
+        ");";
+    
+    const char* createHighScoresTable = 
+        "CREATE TABLE IF NOT EXISTS high_scores ("
+        "    id INTEGER PRIMARY KEY AUTOINCREMENT,"
+        "    player_name TEXT NOT NULL,"
+        "    score INTEGER NOT NULL,"
+        "    difficulty INTEGER NOT NULL,"
+        "    timestamp INTEGER NOT NULL"
+        ");";
+    
+    // Create index on difficulty for faster queries
+    const char* createIndex = 
+        "CREATE INDEX IF NOT EXISTS idx_difficulty_score "
+        "ON high_scores(difficulty, score DESC);";
+    
+    if (!ExecSQL(createSettingsTable, "create settings table") ||
+        !ExecSQL(createHighScoresTable, "create high_scores table")) {
+        return false;
+    }
+    
+    // Continue anyway, index is just for performance
+    ExecSQL(createIndex, "create index");
+    
+    // Databases created before video options were added
+    const char* alterQueries[] = {
+        "ALTER TABLE settings ADD COLUMN resolution_width INTEGER DEFAULT 1200;",
+        "ALTER TABLE settings ADD COLUMN resolution_height INTEGER DEFAULT 600;",
+        "ALTER TABLE settings ADD COLUMN fullscreen_mode INTEGER DEFAULT 0;",
+        "ALTER TABLE settings ADD COLUMN vsync INTEGER DEFAULT 1;"
+    };
+    
+    for (int i = 0; i < 4; i++) {
+        char* errMsg = NULL;
+        int rc = sqlite3_exec(db, alterQueries[i], NULL, NULL, &errMsg);
+        if (rc != SQLITE_OK) {
+            // Ignore errors (column might already exist)
+            sqlite3_free(errMsg);
+        }
+    }
+    
+    return true;
+}
+
+// Version 2: run telemetry tables. The detail tables are clustered by run (WITHOUT ROWID);
+// the aggregate queries GROUP BY type/level over covering indexes instead of the tables.
+static bool MigrateToVersion2(void) {
+    const char* createRunsTable = 
+        "CREATE TABLE IF NOT EXISTS runs ("
+        "    id INTEGER PRIMARY KEY AUTOINCREMENT,"
+        "    timestamp INTEGER NOT NULL,"
+        "    difficulty INTEGER NOT NULL,"
+        "    score INTEGER NOT NULL,"
+        "    duration REAL NOT NULL,"
+        "    level_reached INTEGER NOT NULL,"
+        "    outcome INTEGER NOT NULL,"
+        "    death_cause TEXT NOT NULL,"
+        "    frame_count INTEGER NOT NULL,"
+        "    frame_time_p50 REAL NOT NULL,"
+        "    frame_time_p90 REAL NOT NULL,"
+        "    frame_time_p99 REAL NOT NULL,"
+        "    frame_time_max REAL NOT NULL"
+        ");";
+    
+    const char* createPhasesTable = 
+        "CREATE TABLE IF NOT EXISTS run_phases ("
+        "    run_id INTEGER NOT NULL REFERENCES runs(id),"
+        "    phase INTEGER NOT NULL,"
+        "    level INTEGER NOT NULL,"
+        "    start_time REAL NOT NULL,"
+        "    duration REAL NOT NULL,"
+        "    score INTEGER NOT NULL,"
+        "    kills INTEGER NOT NULL,"
+        "    PRIMARY KEY (run_id, phase)"
+        ") WITHOUT ROWID;";
+    
+    const char* createEnemyStatsTable = 
+        "CREATE TABLE IF NOT EXISTS run_enemy_stats ("
+        "    run_id INTEGER NOT NULL REFERENCES runs(id),"
+        "    enemy_type TEXT NOT NULL,"
+        "    kills INTEGER NOT NULL,"
+        "    damage INTEGER NOT NULL,"
+        "    PRIMARY KEY (run_id, enemy_type)"
+        ") WITHOUT ROWID;";
+    
+    const char* createPowerupStatsTable = 
+        "CREATE TABLE IF NOT EXISTS run_powerup_stats ("
+        "    run_id INTEGER NOT NULL REFERENCES runs(id),"
+        "    powerup_type TEXT NOT NULL,"
+        "    collected INTEGER NOT NULL,"
+        "    PRIMARY KEY (run_id, powerup_type)"
+        ") WITHOUT ROWID;";
+    
+    const char* createIndexes[] = {
+        "CREATE INDEX IF NOT EXISTS idx_runs_timestamp ON runs(timestamp DESC);",
+        "CREATE INDEX IF NOT EXISTS idx_run_phases_level ON run_phases(level, duration, score, kills);",
+        "CREATE INDEX IF NOT EXISTS idx_run_enemy_stats_type ON run_enemy_stats(enemy_type, kills, damage);",
+        "CREATE INDEX IF NOT EXISTS idx_run_powerup_stats_type ON run_powerup_stats(powerup_type, collected);"
+    };
+    
+    if (!ExecSQL(createRunsTable, "create runs table") ||
+        !ExecSQL(createPhasesTable, "create run_phases table") ||
+        !ExecSQL(createEnemyStatsTable, "create run_enemy_stats table") ||
+        !ExecSQL(createPowerupStatsTable, "create run_powerup_stats table")) {
+        return false;
+    }
+    
+    // Continue anyway, indexes are just for performance
+    for (int i = 0; i < 4; i++) {
+        ExecSQL(createIndexes[i], "create run telemetry index");
+    }
+    
+    return true;
+}
+
+// Version 3: per-difficulty score counts in DB_RANK_BUCKET_SIZE buckets, kept by triggers.
+// A rank or page position is found by summing a few hundred bucket rows and counting inside
+// one bucket, instead of counting every higher score.
+static bool MigrateToVersion3(void) {
+    const char* createBucketsTable = 
+        "CREATE TABLE IF NOT EXISTS high_score_buckets ("
+        "    difficulty INTEGER NOT NULL,"
+        "    bucket INTEGER NOT NULL,"
+        "    count INTEGER NOT NULL,"
+        "    PRIMARY KEY (difficulty, bucket)"
+        ") WITHOUT ROWID;";
+    
+    const char* createInsertTrigger = 
+        "CREATE TRIGGER IF NOT EXISTS high_scores_bucket_insert "
+        "AFTER INSERT ON high_scores BEGIN "
+        "    INSERT INTO high_score_buckets (difficulty, bucket, count) "
+        "    VALUES (NEW.difficulty, NEW.score / " DB_SQL_INT(DB_RANK_BUCKET_SIZE) ", 1) "
+        "    ON CONFLICT (difficulty, bucket) DO UPDATE SET count = count + 1;"
+        "END;";
+    
+    const char* createDeleteTrigger = 
+        "CREATE TRIGGER IF NOT EXISTS high_scores_bucket_delete "
+        "AFTER DELETE ON high_scores BEGIN "
+        "    UPDATE high_score_buckets SET count = count - 1 "
+        "    WHERE difficulty = OLD.difficulty AND bucket = OLD.score / " DB_SQL_INT(DB_RANK_BUCKET_SIZE) ";"
+        "END;";
+    
+    // Scores stored before the triggers existed
+    const char* backfillBuckets = 
+        "INSERT OR REPLACE INTO high_score_buckets (difficulty, bucket, count) "
+        "SELECT difficulty, score / " DB_SQL_INT(DB_RANK_BUCKET_SIZE) ", COUNT(*) "
+        "FROM high_scores GROUP BY 1, 2;";
+    
+    return ExecSQL(createBucketsTable, "create high_score_buckets table") &&
+           ExecSQL(createInsertTrigger, "create high score insert trigger") &&
+           ExecSQL(createDeleteTrigger, "create high score delete trigger") &&
+           ExecSQL(backfillBuckets, "count existing high scores");
+}
+
+// Version 4: replays of high score runs. The input data is the last column so reading the
+// metadata never touches the blob's overflow pages; replays go when their score is deleted.
+static bool MigrateToVersion4(void) {
+    const char* createReplaysTable = 
+        "CREATE TABLE IF NOT EXISTS replays ("
+        "    id INTEGER PRIMARY KEY AUTOINCREMENT,"
+        "    high_score_id INTEGER NOT NULL REFERENCES high_scores(id),"
+        "    format_version INTEGER NOT NULL,"
+        "    seed INTEGER NOT NULL,"
+        "    start_level INTEGER NOT NULL,"
+        "    final_level INTEGER NOT NULL,"
+        "    tick_rate INTEGER NOT NULL,"
+        "    tick_count INTEGER NOT NULL,"
+        "    score INTEGER NOT NULL,"
+        "    data BLOB NOT NULL"
+        ");";
+    
+    const char* createIndex = 
+        "CREATE UNIQUE INDEX IF NOT EXISTS idx_replays_high_score ON replays(high_score_id);";
+    
+    const char* createDeleteTrigger = 
+        "CREATE TRIGGER IF NOT EXISTS high_scores_replay_delete "
+        "AFTER DELETE ON high_scores BEGIN "
+        "    DELETE FROM replays WHERE high_score_id = OLD.id;"
+        "END;";
+    
+    return ExecSQL(createReplaysTable, "create replays table") &&
+           ExecSQL(createIndex, "create replay index") &&
+           ExecSQL(createDeleteTrigger, "create replay delete trigger");
+}
+
+// Bring the schema up to DB_SCHEMA_VERSION in one transaction; no-op when already current
+static bool MigrateSchema(int* fromVersion) {
+    int version = GetSchemaVersion();
+    *fromVersion = version;
+    
+    if (version < 0) {
+        fprintf(stderr, "Failed to read schema version: %s\n", sqlite3_errmsg(db));
+        return false;
+    }
+    if (version >= DB_SCHEMA_VERSION) {
+        return true;
+    }
+    
+    if (!ExecSQL("BEGIN IMMEDIATE;", "begin migration")) {
+        return false;
+    }
+    
+    bool ok = true;
+    if (version < 1) {
+        ok = MigrateToVersion1();
+    }
+    if (ok && version < 2) {
+        ok = MigrateToVersion2();
+    }
+    if (ok && version < 3) {
+        ok = MigrateToVersion3();
+    }
+    if (ok && version < 4) {
+        ok = MigrateToVersion4();
+    }
+    
+    if (ok) {
+        char setVersion[64];
+        snprintf(setVersion, sizeof(setVersion), "PRAGMA user_version = %d;", DB_SCHEMA_VERSION);
+        ok = ExecSQL(setVersion, "set schema version") && ExecSQL("COMMIT;", "commit migration");
+    }
+    
+    if (!ok) {
+        ExecSQL("ROLLBACK;", "roll back migration");
+        return false;
+    }
+    
+    printf("Database schema migrated from version %d to %d\n", version, DB_SCHEMA_VERSION);
+    return true;
+}
+
+// Initialize the database
+// Open the write connection once the schema is current (WAL mode is already set on the file)
+static bool OpenWriteConnection(const char* path) {
+    if (sqlite3_open(path, &writeDb) != SQLITE_OK) {
+        fprintf(stderr, "Failed to open database write connection: %s\n", sqlite3_errmsg(writeDb));
+        sqlite3_close(writeDb);
+        writeDb = NULL;
+        return false;
+    }
+    
+    // Per-connection settings (journal_mode is stored in the file)
+    ExecSQLOn(writeDb, "PRAGMA synchronous = NORMAL;", "set synchronous mode");
+    ExecSQLOn(writeDb, "PRAGMA temp_store = MEMORY;", "set temp store");
+    sqlite3_busy_timeout(writeDb, 1000);
+    return PrepareStatements(writeDb, writeStatements);
+}
+
+bool DB_Init(void) {
+    double startTime = NowMilliseconds();
+    
+    const char* path = DB_GetDatabasePath();
+    if (!path) {
+        return false;
+    }
+    
+    // Open database
+    int rc = sqlite3_open(path, &db);
+    if (rc != SQLITE_OK) {
+        fprintf(stderr, "Failed to open database: %s\n", sqlite3_errmsg(db));
+        sqlite3_close(db);
+        db = NULL;
+        return false;
+    }
+    double openTime = NowMilliseconds();
+    
+    // Connection profile: WAL lets commits append to the log without an fsync
+    // (synchronous=NORMAL only syncs at checkpoints), so writes stay sub-millisecond.
+    // A crash can lose the last commits but never corrupts the database.
+    ExecSQL("PRAGMA journal_mode = WAL;", "enable WAL journaling");
+    ExecSQL("PRAGMA synchronous = NORMAL;", "set synchronous mode");
+    ExecSQL("PRAGMA temp_store = MEMORY;", "set temp store");
+    sqlite3_busy_timeout(db, 1000);
+    double pragmaTime = NowMilliseconds();
+    
+    // Create or migrate the schema only when user_version is behind
+    int fromVersion = 0;
+    if (!MigrateSchema(&fromVersion)) {
+        DB_Cleanup();
+        return false;
+    }
+    double migrateTime = NowMilliseconds();
+    
+    if (!PrepareStatements(db, statements) || !OpenWriteConnection(path)) {
+        DB_Cleanup();
+        return false;
+    }
+    double prepareTime = NowMilliseconds();
+    
+    // Populate high scores with presets on a fresh database
+    if (fromVersion == 0) {
+        PopulateHighScorePresets();
+    }
+    double presetTime = NowMilliseconds();
+    
+    // Load every leaderboard now so the render thread never waits for a query
+    for (int i = 0; i < DIFFICULTY_COUNT; i++) {
+        GetHighScoreCache((DifficultyLevel)i);
+    }
+    StartWriter();
+    double endTime = NowMilliseconds();
+    
+    printf("Database initialized at: %s\n", path);
+    printf("Database startup: %.2f ms (open %.2f, pragmas %.2f, schema %.2f, prepare %.2f, presets %.2f, "
+           "cache %.2f)\n",
+           endTime - startTime, openTime - startTime, pragmaTime - openTime, migrateTime - pragmaTime,
+           prepareTime - migrateTime, presetTime - prepareTime, endTime - presetTime);
+    return true;
+}
+
+// Cleanup the database
+void DB_Cleanup(void) {
+    StopWriter();
+    settingsCached = false;
+    
+    for (int i = 0; i < DIFFICULTY_COUNT; i++) {
+        InvalidateHighScoreCache((DifficultyLevel)i);
+    }
+    
+    FinalizeStatements(writeStatements);
+    FinalizeStatements(statements);
+    
+    if (writeDb) {
+        sqlite3_close(writeDb);
+        writeDb = NULL;
+    }
+    if (db) {
+        sqlite3_close(db);
+        db = NULL;
+    }
+}
+
+// Load user settings from database (first call only, then from memory)
+bool DB_LoadSettings(UserSettings* settings) {
+    if (!db || !settings) {
+        return false;
+    }
+    
+    if (settingsCached) {
+        *settings = cachedSettings;
+        return true;
+    }
+    
+    sqlite3_stmt* stmt = GetStatement(STMT_LOAD_SETTINGS);
+    if (!stmt) {
+        return false;
+    }
+    
+    int rc = sqlite3_step(stmt);
+    if (rc == SQLITE_ROW) {
+        settings->soundVolume = (float)sqlite3_column_double(stmt, 0);
+        settings->musicVolume = (float)sqlite3_column_double(stmt, 1);
+        settings->fullscreen = sqlite3_column_int(stmt, 2) != 0;
+        settings->resolutionWidth = sqlite3_column_int(stmt, 3);
+        settings->resolutionHeight = sqlite3_column_int(stmt, 4);
+        settings->fullscreenMode = sqlite3_column_int(stmt, 5);
+        settings->vsync = sqlite3_column_int(stmt, 6) != 0;
+    } else if (rc != SQLITE_DONE) {
+        fprintf(stderr, "Failed to load settings: %s\n", sqlite3_errmsg(db));
+    }
+    ReleaseStatement(stmt);
+    
+    if (rc == SQLITE_ROW) {
+        cachedSettings = *settings;
+        settingsCached = true;
+        return true;
+    } else if (rc == SQLITE_DONE) {
+        // No settings found, use defaults
+        settings->soundVolume = 1.0f;
+        settings->musicVolume = 0.5f;
+        settings->fullscreen = false;
+        settings->resolutionWidth = 1200;
+        settings->resolutionHeight = 600;
+        settings->fullscreenMode = 0;  // FULLSCREEN_OFF
+        settings->vsync = true;
+        
+        // Save default settings
+        DB_SaveSettings(settings);
+        return true;
+    }
+    
+    return false;
+}
+
+// Save user settings (queued; rapid changes are written once after the debounce)
+bool DB_SaveSettings(const UserSettings* settings) {
+    if (!db || !settings) {
+        return false;
+    }
+    
+    cachedSettings = *settings;
+    settingsCached = true;
+    
+    if (!writerRunning) {
+        pthread_mutex_lock(&writeConnectionLock);
+        bool ok = WriteSettings(settings);
+        pthread_mutex_unlock(&writeConnectionLock);
+        return ok;
+    }
+    
+    pthread_mutex_lock(&writerLock);
+    pendingSettings = *settings;
+    pendingSettingsChanges++;
+    pendingSettingsDue = NowMilliseconds() + DB_SETTINGS_DEBOUNCE_MS;
+    pthread_cond_signal(&writerWake);
+    pthread_mutex_unlock(&writerLock);
+    
+    return true;
+}
+
+// Add a high score (queued; the cached leaderboard is updated immediately)
+bool DB_AddHighScore(const char* playerName, int score, DifficultyLevel difficulty) {
+    return DB_AddHighScoreWithReplay(playerName, score, difficulty, NULL, NULL);
+}
+
+// Add a high score with the replay of its run; replayData (malloc'd) is freed by the database
+bool DB_AddHighScoreWithReplay(const char* playerName, int score, DifficultyLevel difficulty,
+                               const DBReplayInfo* replay, unsigned char* replayData) {
+    QueuedReplay queuedReplay = {0};
+    if (replay && replayData) {
+        queuedReplay.info = *replay;
+        queuedReplay.data = replayData;
+    } else {
+        free(replayData);
+    }
     
-    const char* query = 
-        "SELECT id, player_name, score, difficulty, timestamp "
-        "FROM high_scores "
-        "WHERE difficulty = ? "
-        "ORDER BY score DESC "
-        "LIMIT ?;";
+    if (!db || !playerName || difficulty < 0 || difficulty >= DIFFICULTY_COUNT) {
+        free(queuedReplay.data);
+        return false;
+    }
     
-    sqlite3_stmt* stmt = NULL;
+    HighScoreEntry entry = {0};
+    strncpy(entry.playerName, playerName, sizeof(entry.playerName) - 1);
+    entry.score = score;
+    entry.difficulty = difficulty;
+    entry.timestamp = (long)time(NULL);
     
-    int rc = sqlite3_prepare_v2(db, query, -1, &stmt, NULL);
-    if (rc != SQLITE_OK) {
-        fprintf(stderr, "Failed to prepare statement: %s\n", sqlite3_errmsg(db));
+    if (!writerRunning) {
+        pthread_mutex_lock(&writeConnectionLock);
+        bool ok = WriteQueuedHighScore(&entry, &queuedReplay);
+        pthread_mutex_unlock(&writeConnectionLock);
+        free(queuedReplay.data);
+        if (ok) {
+            InsertCachedHighScore(&entry);
+        }
+        return ok;
+    }
+    
+    pthread_mutex_lock(&writerLock);
+    bool queued = scoreQueueCount < DB_WRITE_QUEUE_SIZE;
+    if (queued) {
+        scoreReplayQueue[scoreQueueCount] = queuedReplay;
+        scoreQueue[scoreQueueCount++] = entry;
+        pthread_cond_signal(&writerWake);
+    }
+    pthread_mutex_unlock(&writerLock);
+    
+    if (!queued) {
+        fprintf(stderr, "Failed to add high score: write queue is full\n");
+        free(queuedReplay.data);
         return false;
     }
     
-    sqlite3_bind_int(stmt, 1, (int)difficulty);
-    sqlite3_bind_int(stmt, 2, maxEntries);
+    InsertCachedHighScore(&entry);
+    return true;
+}
+
+void DB_SetWriteCallback(DBWriteCallback callback, void* userData) {
+    writeCallback = callback;
+    writeCallbackData = userData;
+}
+
+// Deliver finished writes to the callback on the calling thread
+void DB_Update(void) {
+    DBWriteResult results[DB_WRITE_QUEUE_SIZE];
     
-    int count = 0;
-    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW && count < maxEntries) {
-        entries[count].id = sqlite3_column_int(stmt, 0);
-        
-        const char* name = (const char*)sqlite3_column_text(stmt, 1);
-        strncpy(entries[count].playerName, name ? name : "Unknown", sizeof(entries[count].playerName) - 1);
-        entries[count].playerName[sizeof(entries[count].playerName) - 1] = '\0';
-        
-        entries[count].score = sqlite3_column_int(stmt, 2);
-        entries[count].difficulty = (DifficultyLevel)sqlite3_column_int(stmt, 3);
-        entries[count].timestamp = sqlite3_column_int64(stmt, 4);
-        
-        count++;
+    pthread_mutex_lock(&writerLock);
+    int count = completionCount;
+    memcpy(results, completions, sizeof(DBWriteResult) * count);
+    completionCount = 0;
+    unsigned int dropped = droppedScoreDifficulties;
+    droppedScoreDifficulties = 0;
+    pthread_mutex_unlock(&writerLock);
+    
+    for (int i = 0; i < DIFFICULTY_COUNT; i++) {
+        if (dropped & (1u << i)) {
+            InvalidateHighScoreCache((DifficultyLevel)i);
+        }
+    }
+    for (int i = 0; i < count; i++) {
+        if (results[i].type == DB_WRITE_HIGH_SCORE) {
+            ApplyHighScoreResult(&results[i]);
+        }
     }
     
-    sqlite3_finalize(stmt);
+    if (writeCallback) {
+        for (int i = 0; i < count; i++) {
+            writeCallback(&results[i], writeCallbackData);
+        }
+    }
+}
+
+// Get high scores for a specific difficulty (served from the in-memory cache)
+bool DB_GetHighScores(DifficultyLevel difficulty, HighScoreEntry* entries, int maxEntries, int* outCount) {
+    if (!db || !entries || !outCount) {
+        return false;
+    }
+    
+    *outCount = 0;
+    
+    const HighScoreCache* cache = GetHighScoreCache(difficulty);
+    if (!cache) {
+        return false;
+    }
+    
+    int count = cache->count < maxEntries ? cache->count : maxEntries;
+    if (count > 0) {
+        memcpy(entries, cache->entries, sizeof(HighScoreEntry) * count);
+    }
     
     *outCount = count;
     return true;
@@ -497,33 +1547,531 @@ bool DB_GetHighScores(DifficultyLevel difficulty, HighScoreEntry* entries, int m
 
 // Check if a score qualifies as a high score
 bool DB_IsHighScore(int score, DifficultyLevel difficulty) {
-    if (!db) {
+    const HighScoreCache* cache = GetHighScoreCache(difficulty);
+    if (!cache) {
         return false;
     }
     
-    // Count how many scores are higher
-    const char* query = 
-        "SELECT COUNT(*) FROM high_scores "
-        "WHERE difficulty = ? AND score >= ?;";
+    // Qualifies if fewer than the kept number of scores are at least as high
+    return CountScoresAtLeast(cache, score) < DB_HIGH_SCORES_PER_DIFFICULTY;
+}
+
+// Record a finished run (queued; written with its detail rows in one transaction)
+bool DB_RecordRun(const DBRunRecord* run) {
+    if (!db || !run) {
+        return false;
+    }
     
-    sqlite3_stmt* stmt = NULL;
+    DBRunRecord record = *run;
+    record.id = 0;
+    record.timestamp = (long)time(NULL);
     
-    int rc = sqlite3_prepare_v2(db, query, -1, &stmt, NULL);
-    if (rc != SQLITE_OK) {
-        fprintf(stderr, "Failed to prepare statement: %s\n", sqlite3_errmsg(db));
+    if (!writerRunning) {
+        pthread_mutex_lock(&writeConnectionLock);
+        bool ok = WriteRun(&record);
+        pthread_mutex_unlock(&writeConnectionLock);
+        return ok;
+    }
+    
+    pthread_mutex_lock(&writerLock);
+    bool queued = runQueueCount < DB_RUN_QUEUE_SIZE;
+    if (queued) {
+        runQueue[runQueueCount++] = record;
+        pthread_cond_signal(&writerWake);
+    }
+    pthread_mutex_unlock(&writerLock);
+    
+    if (!queued) {
+        fprintf(stderr, "Failed to record run: write queue is full\n");
+        return false;
+    }
+    
+    return true;
+}
+
+// Copy a text column into a fixed-size buffer
+static void CopyColumnText(char* dest, size_t size, sqlite3_stmt* stmt, int column) {
+    const char* text = (const char*)sqlite3_column_text(stmt, column);
+    strncpy(dest, text ? text : "", size - 1);
+    dest[size - 1] = '\0';
+}
+
+// Finish a read query: reset it and report errors
+static bool FinishQuery(sqlite3_stmt* stmt, int rc, const char* description) {
+    ReleaseStatement(stmt);
+    if (rc != SQLITE_DONE) {
+        fprintf(stderr, "Failed to %s: %s\n", description, sqlite3_errmsg(db));
+    }
+    return rc == SQLITE_DONE;
+}
+
+// Totals over every stored run
+bool DB_GetRunTotals(DBRunTotals* totals) {
+    if (!db || !totals) {
+        return false;
+    }
+    
+    memset(totals, 0, sizeof(DBRunTotals));
+    
+    sqlite3_stmt* stmt = GetStatement(STMT_RUN_TOTALS);
+    
+    int rc = sqlite3_step(stmt);
+    if (rc == SQLITE_ROW) {
+        totals->runCount = sqlite3_column_int(stmt, 0);
+        totals->victories = sqlite3_column_int(stmt, 1);
+        totals->deaths = sqlite3_column_int(stmt, 2);
+        totals->abandoned = sqlite3_column_int(stmt, 3);
+        totals->bestScore = sqlite3_column_int(stmt, 4);
+        totals->averageScore = (float)sqlite3_column_double(stmt, 5);
+        totals->totalPlayTime = (float)sqlite3_column_double(stmt, 6);
+        totals->longestRun = (float)sqlite3_column_double(stmt, 7);
+        totals->averageFrameTimeP99 = (float)sqlite3_column_double(stmt, 8);
+        rc = SQLITE_DONE;
+    }
+    
+    return FinishQuery(stmt, rc, "load run totals");
+}
+
+// Kills and damage per enemy type over every stored run, most kills first
+bool DB_GetEnemyTypeStats(DBRunEnemyStats* entries, int maxEntries, int* outCount) {
+    if (!db || !entries || !outCount) {
+        return false;
+    }
+    
+    *outCount = 0;
+    
+    sqlite3_stmt* stmt = GetStatement(STMT_RUN_ENEMY_TOTALS);
+    
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW && *outCount < maxEntries) {
+        DBRunEnemyStats* entry = &entries[(*outCount)++];
+        CopyColumnText(entry->name, sizeof(entry->name), stmt, 0);
+        entry->kills = sqlite3_column_int(stmt, 1);
+        entry->damage = sqlite3_column_int(stmt, 2);
+    }
+    if (rc == SQLITE_ROW) {
+        rc = SQLITE_DONE;  // More types than requested
+    }
+    
+    return FinishQuery(stmt, rc, "load enemy statistics");
+}
+
+// Powerups collected per type over every stored run, most collected first
+bool DB_GetPowerupStats(DBRunPowerupStats* entries, int maxEntries, int* outCount) {
+    if (!db || !entries || !outCount) {
+        return false;
+    }
+    
+    *outCount = 0;
+    
+    sqlite3_stmt* stmt = GetStatement(STMT_RUN_POWERUP_TOTALS);
+    
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW && *outCount < maxEntries) {
+        DBRunPowerupStats* entry = &entries[(*outCount)++];
+        CopyColumnText(entry->name, sizeof(entry->name), stmt, 0);
+        entry->collected = sqlite3_column_int(stmt, 1);
+    }
+    if (rc == SQLITE_ROW) {
+        rc = SQLITE_DONE;
+    }
+    
+    return FinishQuery(stmt, rc, "load powerup statistics");
+}
+
+// Average time, score and kills per level over the runs that reached it
+bool DB_GetPhaseStats(DBRunPhaseStats* entries, int maxEntries, int* outCount) {
+    if (!db || !entries || !outCount) {
+        return false;
+    }
+    
+    *outCount = 0;
+    
+    sqlite3_stmt* stmt = GetStatement(STMT_RUN_PHASE_TOTALS);
+    
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW && *outCount < maxEntries) {
+        DBRunPhaseStats* entry = &entries[(*outCount)++];
+        entry->level = sqlite3_column_int(stmt, 0);
+        entry->runs = sqlite3_column_int(stmt, 1);
+        entry->averageDuration = (float)sqlite3_column_double(stmt, 2);
+        entry->averageScore = (float)sqlite3_column_double(stmt, 3);
+        entry->averageKills = (float)sqlite3_column_double(stmt, 4);
+    }
+    if (rc == SQLITE_ROW) {
+        rc = SQLITE_DONE;
+    }
+    
+    return FinishQuery(stmt, rc, "load phase statistics");
+}
+
+// Most recent runs (run rows only; phases and per-type counts are left empty)
+bool DB_GetRecentRuns(DBRunRecord* runs, int maxRuns, int* outCount) {
+    if (!db || !runs || !outCount) {
+        return false;
+    }
+    
+    *outCount = 0;
+    if (maxRuns <= 0) {
+        return true;
+    }
+    
+    sqlite3_stmt* stmt = GetStatement(STMT_RECENT_RUNS);
+    sqlite3_bind_int(stmt, 1, maxRuns);
+    
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        DBRunRecord* run = &runs[(*outCount)++];
+        memset(run, 0, sizeof(DBRunRecord));
+        run->id = sqlite3_column_int(stmt, 0);
+        run->timestamp = (long)sqlite3_column_int64(stmt, 1);
+        run->difficulty = (DifficultyLevel)sqlite3_column_int(stmt, 2);
+        run->score = sqlite3_column_int(stmt, 3);
+        run->duration = (float)sqlite3_column_double(stmt, 4);
+        run->levelReached = sqlite3_column_int(stmt, 5);
+        run->outcome = (DBRunOutcome)sqlite3_column_int(stmt, 6);
+        CopyColumnText(run->deathCause, sizeof(run->deathCause), stmt, 7);
+        run->frameCount = sqlite3_column_int(stmt, 8);
+        run->frameTimeP50 = (float)sqlite3_column_double(stmt, 9);
+        run->frameTimeP90 = (float)sqlite3_column_double(stmt, 10);
+        run->frameTimeP99 = (float)sqlite3_column_double(stmt, 11);
+        run->frameTimeMax = (float)sqlite3_column_double(stmt, 12);
+    }
+    
+    return FinishQuery(stmt, rc, "load recent runs");
+}
+
+// Read an id, player_name, score, difficulty, timestamp row
+static void ReadHighScoreRow(sqlite3_stmt* stmt, HighScoreEntry* entry) {
+    entry->id = sqlite3_column_int(stmt, 0);
+    CopyColumnText(entry->playerName, sizeof(entry->playerName), stmt, 1);
+    entry->score = sqlite3_column_int(stmt, 2);
+    entry->difficulty = (DifficultyLevel)sqlite3_column_int(stmt, 3);
+    entry->timestamp = (long)sqlite3_column_int64(stmt, 4);
+}
+
+// Highest score in a bucket (score / DB_RANK_BUCKET_SIZE truncates toward zero, like SQLite)
+static int BucketUpperScore(int bucket) {
+    return bucket >= 0 ? bucket * DB_RANK_BUCKET_SIZE + DB_RANK_BUCKET_SIZE - 1 : bucket * DB_RANK_BUCKET_SIZE;
+}
+
+// Run a single-value count query; -1 on error
+static long long StepCount(sqlite3_stmt* stmt) {
+    long long count = -1;
+    if (sqlite3_step(stmt) == SQLITE_ROW) {
+        count = sqlite3_column_int64(stmt, 0);
+    }
+    ReleaseStatement(stmt);
+    return count;
+}
+
+// Number of scores above a score; -1 on error
+static long long CountScoresAbove(int score, DifficultyLevel difficulty) {
+    int bucket = score / DB_RANK_BUCKET_SIZE;
+    
+    sqlite3_stmt* stmt = GetStatement(STMT_COUNT_BUCKETS_ABOVE);
+    sqlite3_bind_int(stmt, 1, (int)difficulty);
+    sqlite3_bind_int(stmt, 2, bucket);
+    long long higherBuckets = StepCount(stmt);
+    
+    stmt = GetStatement(STMT_COUNT_SCORES_ABOVE);
+    sqlite3_bind_int(stmt, 1, (int)difficulty);
+    sqlite3_bind_int(stmt, 2, score);
+    sqlite3_bind_int(stmt, 3, BucketUpperScore(bucket));
+    long long sameBucket = StepCount(stmt);
+    
+    if (higherBuckets < 0 || sameBucket < 0) {
+        fprintf(stderr, "Failed to count high scores: %s\n", sqlite3_errmsg(db));
+        return -1;
+    }
+    return higherBuckets + sameBucket;
+}
+
+// Number of stored scores for a difficulty
+int DB_GetHighScoreCount(DifficultyLevel difficulty) {
+    if (!db || difficulty < 0 || difficulty >= DIFFICULTY_COUNT) {
+        return 0;
+    }
+    
+    sqlite3_stmt* stmt = GetStatement(STMT_COUNT_DIFFICULTY_SCORES);
+    sqlite3_bind_int(stmt, 1, (int)difficulty);
+    long long count = StepCount(stmt);
+    
+    return count > 0 ? (int)count : 0;
+}
+
+// Leaderboard position a score has or would get (1 + number of higher scores)
+int DB_GetScoreRank(int score, DifficultyLevel difficulty) {
+    if (!db || difficulty < 0 || difficulty >= DIFFICULTY_COUNT) {
+        return 0;
+    }
+    
+    long long above = CountScoresAbove(score, difficulty);
+    return above >= 0 ? (int)above + 1 : 0;
+}
+
+// One page of the full leaderboard; the bucket counts locate the page's first score
+bool DB_GetHighScorePage(DifficultyLevel difficulty, int page, int pageSize,
+                         HighScoreEntry* entries, int* outCount, int* outTotal) {
+    if (!db || !entries || !outCount || page < 0 || pageSize <= 0 ||
+        difficulty < 0 || difficulty >= DIFFICULTY_COUNT) {
+        return false;
+    }
+    
+    *outCount = 0;
+    long long offset = (long long)page * pageSize;
+    
+    // Walk the buckets from the top until the one holding the page's first position
+    sqlite3_stmt* stmt = GetStatement(STMT_SCAN_BUCKETS);
+    sqlite3_bind_int(stmt, 1, (int)difficulty);
+    
+    long long skipped = 0;
+    long long total = 0;
+    bool found = false;
+    int startBucket = 0;
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        long long count = sqlite3_column_int64(stmt, 1);
+        if (!found && skipped + count > offset) {
+            found = true;
+            startBucket = sqlite3_column_int(stmt, 0);
+        } else if (!found) {
+            skipped += count;
+        }
+        total += count;
+    }
+    ReleaseStatement(stmt);
+    
+    if (rc != SQLITE_DONE) {
+        fprintf(stderr, "Failed to locate leaderboard page: %s\n", sqlite3_errmsg(db));
+        return false;
+    }
+    if (outTotal) {
+        *outTotal = (int)total;
+    }
+    if (!found) {
+        return true;
+    }
+    
+    stmt = GetStatement(STMT_SELECT_SCORES_FROM);
+    sqlite3_bind_int(stmt, 1, (int)difficulty);
+    sqlite3_bind_int(stmt, 2, BucketUpperScore(startBucket));
+    sqlite3_bind_int(stmt, 3, pageSize);
+    sqlite3_bind_int64(stmt, 4, offset - skipped);
+    
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        ReadHighScoreRow(stmt, &entries[(*outCount)++]);
+    }
+    
+    return FinishQuery(stmt, rc, "load leaderboard page");
+}
+
+// Entries around a score: up to radius above it, then the score's own position and below
+bool DB_GetHighScoreNeighbors(int score, DifficultyLevel difficulty, int radius,
+                              HighScoreEntry* entries, int maxEntries, int* outCount, int* outFirstPosition) {
+    if (!db || !entries || !outCount || radius < 0 || difficulty < 0 || difficulty >= DIFFICULTY_COUNT) {
+        return false;
+    }
+    
+    *outCount = 0;
+    if (outFirstPosition) {
+        *outFirstPosition = 0;
+    }
+    if (maxEntries <= 0) {
+        return true;
+    }
+    
+    long long above = CountScoresAbove(score, difficulty);
+    if (above < 0) {
         return false;
     }
     
+    // Nearest higher scores come back first; reverse them into leaderboard order
+    sqlite3_stmt* stmt = GetStatement(STMT_SELECT_SCORES_ABOVE);
     sqlite3_bind_int(stmt, 1, (int)difficulty);
     sqlite3_bind_int(stmt, 2, score);
+    sqlite3_bind_int(stmt, 3, radius < maxEntries ? radius : maxEntries);
     
-    bool isHighScore = false;
-    if (sqlite3_step(stmt) == SQLITE_ROW) {
-        int count = sqlite3_column_int(stmt, 0);
-        isHighScore = (count < 10); // Top 10
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        ReadHighScoreRow(stmt, &entries[(*outCount)++]);
     }
+    ReleaseStatement(stmt);
     
-    sqlite3_finalize(stmt);
-    return isHighScore;
+    if (rc != SQLITE_DONE) {
+        fprintf(stderr, "Failed to load scores above %d: %s\n", score, sqlite3_errmsg(db));
+        return false;
+    }
+    
+    int aboveCount = *outCount;
+    for (int i = 0; i < aboveCount / 2; i++) {
+        HighScoreEntry swap = entries[i];
+        entries[i] = entries[aboveCount - 1 - i];
+        entries[aboveCount - 1 - i] = swap;
+    }
+    
+    int belowLimit = maxEntries - aboveCount < radius + 1 ? maxEntries - aboveCount : radius + 1;
+    if (outFirstPosition) {
+        *outFirstPosition = (int)above + 1 - aboveCount;
+    }
+    if (belowLimit <= 0) {
+        return true;
+    }
+    
+    stmt = GetStatement(STMT_SELECT_SCORES_FROM);
+    sqlite3_bind_int(stmt, 1, (int)difficulty);
+    sqlite3_bind_int(stmt, 2, score);
+    sqlite3_bind_int(stmt, 3, belowLimit);
+    sqlite3_bind_int(stmt, 4, 0);
+    
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        ReadHighScoreRow(stmt, &entries[(*outCount)++]);
+    }
+    
+    return FinishQuery(stmt, rc, "load scores around a score");
+}
+
+// Reload every cached leaderboard after a bulk change
+static void ReloadHighScoreCaches(void) {
+    for (int i = 0; i < DIFFICULTY_COUNT; i++) {
+        InvalidateHighScoreCache((DifficultyLevel)i);
+        GetHighScoreCache((DifficultyLevel)i);
+    }
+}
+
+// Insert many scores in one transaction (synchronous; entries without a timestamp get now)
+bool DB_ImportHighScores(const HighScoreEntry* entries, int count) {
+    if (!writeDb || !entries || count < 0) {
+        return false;
+    }
+    
+    long now = (long)time(NULL);
+    bool ok = true;
+    
+    pthread_mutex_lock(&writeConnectionLock);
+    if (!ExecSQLOn(writeDb, "BEGIN;", "begin high score import")) {
+        pthread_mutex_unlock(&writeConnectionLock);
+        return false;
+    }
+    
+    for (int i = 0; i < count && ok; i++) {
+        HighScoreEntry entry = entries[i];
+        if (entry.difficulty < 0 || entry.difficulty >= DIFFICULTY_COUNT) {
+            fprintf(stderr, "Failed to import high score: invalid difficulty %d\n", (int)entry.difficulty);
+            ok = false;
+            break;
+        }
+        if (entry.timestamp == 0) {
+            entry.timestamp = now;
+        }
+        ok = WriteHighScore(&entry);
+    }
+    
+    if (ok) {
+        ok = ExecSQLOn(writeDb, "COMMIT;", "commit high score import");
+    }
+    if (!ok) {
+        ExecSQLOn(writeDb, "ROLLBACK;", "roll back high score import");
+    }
+    pthread_mutex_unlock(&writeConnectionLock);
+    
+    ReloadHighScoreCaches();
+    return ok;
+}
+
+// Delete every stored high score (synchronous)
+bool DB_ClearHighScores(void) {
+    if (!writeDb) {
+        return false;
+    }
+    
+    // Buckets and replays first, so the delete triggers find nothing left to update
+    pthread_mutex_lock(&writeConnectionLock);
+    bool ok = ExecSQLOn(writeDb, "BEGIN;", "begin clearing high scores") &&
+              ExecSQLOn(writeDb, "DELETE FROM high_score_buckets;", "clear high score buckets") &&
+              ExecSQLOn(writeDb, "DELETE FROM replays;", "clear replays") &&
+              ExecSQLOn(writeDb, "DELETE FROM high_scores;", "clear high scores") &&
+              ExecSQLOn(writeDb, "COMMIT;", "commit clearing high scores");
+    if (!ok) {
+        ExecSQLOn(writeDb, "ROLLBACK;", "roll back clearing high scores");
+    }
+    pthread_mutex_unlock(&writeConnectionLock);
+    
+    ReloadHighScoreCaches();
+    return ok;
+}
+
+// Read a replay's metadata row
+static bool ReadReplayInfo(sqlite3_stmt* stmt, int key, DBReplayInfo* info) {
+    memset(info, 0, sizeof(DBReplayInfo));
+    sqlite3_bind_int(stmt, 1, key);
+    
+    int rc = sqlite3_step(stmt);
+    if (rc == SQLITE_ROW) {
+        info->id = sqlite3_column_int(stmt, 0);
+        info->highScoreId = sqlite3_column_int(stmt, 1);
+        info->formatVersion = sqlite3_column_int(stmt, 2);
+        info->seed = (unsigned int)sqlite3_column_int64(stmt, 3);
+        info->startLevel = sqlite3_column_int(stmt, 4);
+        info->finalLevel = sqlite3_column_int(stmt, 5);
+        info->tickRate = sqlite3_column_int(stmt, 6);
+        info->tickCount = sqlite3_column_int(stmt, 7);
+        info->score = sqlite3_column_int(stmt, 8);
+        info->dataSize = sqlite3_column_int(stmt, 9);
+        rc = SQLITE_DONE;
+    } else if (rc == SQLITE_DONE) {
+        rc = SQLITE_NOTFOUND;
+    }
+    ReleaseStatement(stmt);
+    
+    if (rc != SQLITE_DONE && rc != SQLITE_NOTFOUND) {
+        fprintf(stderr, "Failed to load replay: %s\n", sqlite3_errmsg(db));
+    }
+    return rc == SQLITE_DONE;
+}
+
+// Metadata of a stored replay (false if there is none)
+bool DB_GetReplayInfo(int replayId, DBReplayInfo* info) {
+    if (!db || !info) {
+        return false;
+    }
+    
+    return ReadReplayInfo(GetStatement(STMT_SELECT_REPLAY), replayId, info);
+}
+
+// Metadata of the replay recorded with a high score (false if it has none)
+bool DB_GetHighScoreReplay(int highScoreId, DBReplayInfo* info) {
+    if (!db || !info) {
+        return false;
+    }
+    
+    return ReadReplayInfo(GetStatement(STMT_SELECT_HIGH_SCORE_REPLAY), highScoreId, info);
 }
 
+// Read part of a replay's input data with incremental blob I/O (the blob is never loaded whole)
+bool DB_ReadReplayData(int replayId, int offset, void* buffer, int size, int* outRead) {
+    if (!db || !buffer || !outRead || offset < 0 || size < 0) {
+        return false;
+    }
+    
+    *outRead = 0;
+    
+    sqlite3_blob* blob = NULL;
+    int rc = sqlite3_blob_open(db, "main", "replays", "data", replayId, 0, &blob);
+    if (rc == SQLITE_OK) {
+        int available = sqlite3_blob_bytes(blob) - offset;
+        int count = available < size ? available : size;
+        if (count > 0) {
+            rc = sqlite3_blob_read(blob, buffer, count, offset);
+            if (rc == SQLITE_OK) {
+                *outRead = count;
+            }
+        }
+    }
+    if (rc != SQLITE_OK) {
+        fprintf(stderr, "Failed to read replay %d: %s\n", replayId, sqlite3_errmsg(db));
+    }
+    sqlite3_blob_close(blob);
+    
+    return rc == SQLITE_OK;
+}
@@ -0,0 +1,50 @@
+#include "game_random.h"
+
+// PCG32 (XSH RR) with a fixed stream
+#define PCG_MULTIPLIER 6364136223846793005ULL
+#define PCG_INCREMENT 1442695040888963407ULL
+
+static uint64_t state = 0x853c49e6748fea9bULL;   // Used until the first seed
+
+static uint32_t NextValue(void) {
+    uint64_t old = state;
+    state = old * PCG_MULTIPLIER + PCG_INCREMENT;
+
+    uint32_t xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+    uint32_t rotation = (uint32_t)(old >> 59);
+    return (xorshifted >> rotation) | (xorshifted << ((32 - rotation) & 31));
+}
+
+void GameRandom_Seed(unsigned int seed) {
+    state = 0;
+    NextValue();
+    state += seed;
+    NextValue();
+}
+
+int GameRandom_Int(int min, int max) {
+    if (min > max) {
+        int swap = min;
+        min = max;
+        max = swap;
+    }
+
+    // Modulo bias is below 2^-20 for the ranges the game uses
+    uint32_t range = (uint32_t)((int64_t)max - min) + 1;
+    if (range == 0) {
+        return (int)NextValue();
+    }
+    return (int)((int64_t)min + NextValue() % range);
+}
+
+float GameRandom_Float(void) {
+    return (NextValue() >> 8) * (1.0f / 16777216.0f);
+}
+
+uint64_t GameRandom_GetState(void) {
+    return state;
+}
+
+void GameRandom_SetState(uint64_t saved) {
+    state = saved;
+}
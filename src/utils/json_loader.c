@@ -6,29 +6,14 @@
 #include <stdlib.h>
 #include <string.h>
 
-// Helper function to read file contents
+// Helper function to read file contents (through raylib, so a mounted asset pack can serve it)
 static char* ReadFileContents(const char* filepath) {
-    FILE* file = fopen(filepath, "rb");
-    if (!file) {
-        printf("[JSON LOADER] ERROR: Could not open file: %s\n", filepath);
-        return NULL;
-    }
-    
-    fseek(file, 0, SEEK_END);
-    long fileSize = ftell(file);
-    fseek(file, 0, SEEK_SET);
-    
-    char* content = (char*)malloc(fileSize + 1);
+    char* content = LoadFileText(filepath);
     if (!content) {
-        printf("[JSON LOADER] ERROR: Memory allocation failed\n");
-        fclose(file);
+        printf("[JSON LOADER] ERROR: Could not open file: %s\n", filepath);
         return NULL;
     }
     
-    size_t bytesRead = fread(content, 1, fileSize, file);
-    content[bytesRead] = '\0';
-    fclose(file);
-    
     return content;
 }
 
@@ -74,7 +59,7 @@ MetaOrchestration* LoadMetaOrchestration(const char* filepath) {
     if (!content) return NULL;
     
     cJSON* root = cJSON_Parse(content);
-    free(content);
+    UnloadFileText(content);
     
     if (!root) {
         printf("[JSON LOADER] ERROR: Failed to parse JSON: %s\n", filepath);
@@ -147,7 +132,7 @@ LevelConfig* LoadLevelConfig(const char* filepath, int* success) {
     if (!content) return NULL;
     
     cJSON* root = cJSON_Parse(content);
-    free(content);
+    UnloadFileText(content);
     
     if (!root) {
         printf("[JSON LOADER] ERROR: Failed to parse level JSON: %s\n", filepath);
@@ -169,15 +154,40 @@ LevelConfig* LoadLevelConfig(const char* filepath, int* success) {
     cJSON* audioPath = cJSON_GetObjectItem(root, "audioPath");
     cJSON* duration = cJSON_GetObjectItem(root, "duration");
     cJSON* targetScore = cJSON_GetObjectItem(root, "targetScore");
+    cJSON* bassEnvelopePath = cJSON_GetObjectItem(root, "bassEnvelopePath");
+    cJSON* capacity = cJSON_GetObjectItem(root, "capacity");
     
     config->levelNumber = levelNumber && cJSON_IsNumber(levelNumber) ? levelNumber->valueint : 1;
     config->name = name && cJSON_IsString(name) ? strdup(name->valuestring) : strdup("Unknown");
     config->description = description && cJSON_IsString(description) ? strdup(description->valuestring) : strdup("");
     config->audioPath = audioPath && cJSON_IsString(audioPath) ? strdup(audioPath->valuestring) : strdup("");
-    config->bassLogPath = NULL;  // Not used from JSON
+    if (bassEnvelopePath && cJSON_IsString(bassEnvelopePath)) {
+        config->bassEnvelopePath = strdup(bassEnvelopePath->valuestring);
+    } else {
+        char envelopePath[256];
+        BassEnvelope_GetPath(config->audioPath, envelopePath, sizeof(envelopePath));
+        config->bassEnvelopePath = strdup(envelopePath);
+    }
+    config->bassEnvelope = NULL;  // Loaded by the level manager
     config->duration = duration && cJSON_IsNumber(duration) ? (float)duration->valuedouble : 0.0f;
     config->targetScore = targetScore && cJSON_IsNumber(targetScore) ? targetScore->valueint : 0;
     
+    // Optional pool sizes for dense levels: { "enemies": 120, "projectiles": 2000, ... }
+    memset(&config->capacity, 0, sizeof(PoolCapacity));
+    if (capacity && cJSON_IsObject(capacity)) {
+        cJSON* bullets = cJSON_GetObjectItem(capacity, "bullets");
+        cJSON* enemies = cJSON_GetObjectItem(capacity, "enemies");
+        cJSON* projectiles = cJSON_GetObjectItem(capacity, "projectiles");
+        cJSON* powerups = cJSON_GetObjectItem(capacity, "powerups");
+        cJSON* explosions = cJSON_GetObjectItem(capacity, "explosions");
+        
+        config->capacity.bullets = bullets && cJSON_IsNumber(bullets) ? bullets->valueint : 0;
+        config->capacity.enemies = enemies && cJSON_IsNumber(enemies) ? enemies->valueint : 0;
+        config->capacity.projectiles = projectiles && cJSON_IsNumber(projectiles) ? projectiles->valueint : 0;
+        config->capacity.powerups = powerups && cJSON_IsNumber(powerups) ? powerups->valueint : 0;
+        config->capacity.explosions = explosions && cJSON_IsNumber(explosions) ? explosions->valueint : 0;
+    }
+    
     cJSON_Delete(root);
     
     *success = 1;
@@ -193,7 +203,8 @@ void FreeLevelConfig(LevelConfig* config) {
     if (config->name) free((void*)config->name);
     if (config->description) free((void*)config->description);
     if (config->audioPath) free((void*)config->audioPath);
-    if (config->bassLogPath) free((void*)config->bassLogPath);
+    if (config->bassEnvelopePath) free((void*)config->bassEnvelopePath);
+    BassEnvelope_Unload(config->bassEnvelope);
     
     free(config);
 }
@@ -206,7 +217,7 @@ SpawnEvent* ParseSpawnEvents(const char* filepath, int* eventCount) {
     if (!content) return NULL;
     
     cJSON* root = cJSON_Parse(content);
-    free(content);
+    UnloadFileText(content);
     
     if (!root) {
         printf("[JSON LOADER] ERROR: Failed to parse spawn events JSON: %s\n", filepath);
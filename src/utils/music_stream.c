@@ -0,0 +1,299 @@
+#ifndef _WIN32
+#define _POSIX_C_SOURCE 200809L   // nanosleep/sched under -std=c99
+#endif
+
+#include "music_stream.h"
+#include "asset_pack.h"
+#include "raylib.h"
+#include <pthread.h>
+#include <sched.h>                // sched_param for the audio thread priority (winpthreads on Windows)
+#include <stdio.h>
+#include <string.h>
+
+#ifndef _WIN32
+    #include <time.h>
+#endif
+
+typedef enum {
+    MUSIC_CMD_PLAY,
+    MUSIC_CMD_PAUSE,
+    MUSIC_CMD_RESUME,
+    MUSIC_CMD_STOP,
+    MUSIC_CMD_VOLUME,
+    MUSIC_CMD_SEEK,
+    MUSIC_CMD_DETACH             // Stop touching the music so the game thread can unload it
+} MusicCommandType;
+
+typedef struct MusicCommand {
+    MusicCommandType type;
+    float value;
+} MusicCommand;
+
+// Command queue: the game thread writes queueHead, the audio thread writes queueTail
+static MusicCommand queue[MUSIC_STREAM_QUEUE_SIZE];
+static unsigned int queueHead = 0;
+static unsigned int queueTail = 0;
+
+// Music handed to the audio thread (only touched there while attached != 0)
+static Music music;
+static int attached = 0;
+static int playing = 0;
+
+// Game thread state
+static bool loaded = false;
+static float volume = 1.0f;
+static bool threaded = false;
+static int updateIntervalMs = MUSIC_STREAM_UPDATE_MS;
+static int running = 0;
+static pthread_t audioThread;
+
+// Playback clock written by the streaming side (seqlock: odd = write in progress)
+static unsigned int clockSequence = 0;
+static double clockPosition = 0.0;
+static double clockStamp = 0.0;
+static int clockPlaying = 0;
+
+#define MUSIC_CLOCK_MAX_EXTRAPOLATION 0.1   // Seconds a stale clock may be run forward
+
+static void SleepMs(int milliseconds) {
+#ifndef _WIN32
+    struct timespec duration = { milliseconds / 1000, (long)(milliseconds % 1000) * 1000000L };
+    nanosleep(&duration, NULL);
+#else
+    WaitTime(milliseconds / 1000.0);
+#endif
+}
+
+static void PublishClock(double position, int isPlaying) {
+    unsigned int sequence = __atomic_load_n(&clockSequence, __ATOMIC_RELAXED);
+    __atomic_store_n(&clockSequence, sequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    double stamp = GetTime();
+    __atomic_store(&clockPosition, &position, __ATOMIC_RELAXED);
+    __atomic_store(&clockStamp, &stamp, __ATOMIC_RELAXED);
+    __atomic_store_n(&clockPlaying, isPlaying, __ATOMIC_RELAXED);
+
+    __atomic_store_n(&clockSequence, sequence + 2, __ATOMIC_RELEASE);
+}
+
+static void ApplyCommand(const MusicCommand* command) {
+    switch (command->type) {
+        case MUSIC_CMD_PLAY:   PlayMusicStream(music); break;
+        case MUSIC_CMD_PAUSE:  PauseMusicStream(music); break;
+        case MUSIC_CMD_RESUME: ResumeMusicStream(music); break;
+        case MUSIC_CMD_STOP:   StopMusicStream(music); break;
+        case MUSIC_CMD_VOLUME: SetMusicVolume(music, command->value); break;
+        case MUSIC_CMD_SEEK:
+            SeekMusicStream(music, command->value);
+            PublishClock(command->value, IsMusicStreamPlaying(music));
+            break;
+        case MUSIC_CMD_DETACH:
+            StopMusicStream(music);
+            PublishClock(0.0, 0);
+            __atomic_store_n(&playing, 0, __ATOMIC_RELAXED);
+            __atomic_store_n(&attached, 0, __ATOMIC_RELEASE);
+            break;
+    }
+}
+
+// Streaming side: drain commands, refill the stream buffer, publish the clock
+static void StreamTick(void) {
+    unsigned int tail = queueTail;
+    unsigned int head = __atomic_load_n(&queueHead, __ATOMIC_ACQUIRE);
+
+    while (tail != head) {
+        MusicCommand command = queue[tail & (MUSIC_STREAM_QUEUE_SIZE - 1)];
+        tail++;
+        if (__atomic_load_n(&attached, __ATOMIC_ACQUIRE)) {
+            ApplyCommand(&command);
+        }
+    }
+    __atomic_store_n(&queueTail, tail, __ATOMIC_RELEASE);
+
+    if (__atomic_load_n(&attached, __ATOMIC_ACQUIRE)) {
+        UpdateMusicStream(music);
+        int isPlaying = IsMusicStreamPlaying(music) ? 1 : 0;
+        __atomic_store_n(&playing, isPlaying, __ATOMIC_RELAXED);
+        PublishClock(GetMusicTimePlayed(music), isPlaying);
+    }
+}
+
+static void* AudioThreadMain(void* arg) {
+    (void)arg;
+    while (__atomic_load_n(&running, __ATOMIC_ACQUIRE)) {
+        StreamTick();
+        SleepMs(updateIntervalMs);
+    }
+    return NULL;
+}
+
+static void PushCommand(MusicCommandType type, float value) {
+    unsigned int head = queueHead;
+
+    // Full queue: wait for the audio thread (or drain it ourselves when not threaded)
+    while (head - __atomic_load_n(&queueTail, __ATOMIC_ACQUIRE) >= MUSIC_STREAM_QUEUE_SIZE) {
+        if (threaded) {
+            SleepMs(1);
+        } else {
+            StreamTick();
+        }
+    }
+
+    queue[head & (MUSIC_STREAM_QUEUE_SIZE - 1)] = (MusicCommand){ type, value };
+    __atomic_store_n(&queueHead, head + 1, __ATOMIC_RELEASE);
+}
+
+MusicStreamConfig MusicStream_DefaultConfig(void) {
+    MusicStreamConfig config = {
+        .threaded = MUSIC_STREAM_THREADED,
+        .bufferFrames = MUSIC_STREAM_BUFFER_FRAMES,
+        .updateIntervalMs = MUSIC_STREAM_UPDATE_MS,
+        .highPriority = MUSIC_STREAM_HIGH_PRIORITY
+    };
+    return config;
+}
+
+bool MusicStream_Init(const MusicStreamConfig* config) {
+    MusicStreamConfig settings = config ? *config : MusicStream_DefaultConfig();
+
+    // Applies to every stream loaded from now on
+    if (settings.bufferFrames > 0) {
+        SetAudioStreamBufferSizeDefault(settings.bufferFrames);
+    }
+    updateIntervalMs = settings.updateIntervalMs > 0 ? settings.updateIntervalMs : MUSIC_STREAM_UPDATE_MS;
+    threaded = false;
+
+    if (!settings.threaded) {
+        printf("[MUSIC STREAM] Streaming from the game loop (buffer: %d frames)\n", settings.bufferFrames);
+        return true;
+    }
+
+    __atomic_store_n(&running, 1, __ATOMIC_RELEASE);
+    if (pthread_create(&audioThread, NULL, AudioThreadMain, NULL) != 0) {
+        __atomic_store_n(&running, 0, __ATOMIC_RELEASE);
+        printf("[MUSIC STREAM] WARNING: Could not start audio thread, streaming from the game loop\n");
+        return true;
+    }
+    threaded = true;
+
+    bool raised = false;
+    if (settings.highPriority) {
+        struct sched_param param;
+        memset(&param, 0, sizeof(param));
+        param.sched_priority = sched_get_priority_min(SCHED_RR);
+        raised = (pthread_setschedparam(audioThread, SCHED_RR, &param) == 0);
+        if (!raised) {
+            printf("[MUSIC STREAM] Real-time priority not permitted, using normal priority\n");
+        }
+    }
+
+    printf("[MUSIC STREAM] Audio thread started (buffer: %d frames, update: %d ms%s)\n",
+           settings.bufferFrames, updateIntervalMs, raised ? ", real-time" : "");
+    return true;
+}
+
+void MusicStream_Shutdown(void) {
+    MusicStream_Unload();
+
+    if (threaded) {
+        __atomic_store_n(&running, 0, __ATOMIC_RELEASE);
+        pthread_join(audioThread, NULL);
+        threaded = false;
+    }
+}
+
+bool MusicStream_Load(const char* path) {
+    MusicStream_Unload();
+
+    Music stream = AssetPack_LoadMusicStream(path);
+    if (stream.ctxType <= 0) {
+        return false;
+    }
+
+    // Not attached yet, so the audio thread cannot see it
+    music = stream;
+    SetMusicVolume(music, volume);
+    loaded = true;
+    __atomic_store_n(&attached, 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+void MusicStream_Unload(void) {
+    if (!loaded) return;
+
+    PushCommand(MUSIC_CMD_DETACH, 0.0f);
+    while (__atomic_load_n(&attached, __ATOMIC_ACQUIRE)) {
+        if (threaded) {
+            SleepMs(1);
+        } else {
+            StreamTick();
+        }
+    }
+
+    UnloadMusicStream(music);
+    memset(&music, 0, sizeof(music));
+    loaded = false;
+}
+
+bool MusicStream_IsLoaded(void) {
+    return loaded;
+}
+
+void MusicStream_Play(void) {
+    if (loaded) PushCommand(MUSIC_CMD_PLAY, 0.0f);
+}
+
+void MusicStream_Pause(void) {
+    if (loaded) PushCommand(MUSIC_CMD_PAUSE, 0.0f);
+}
+
+void MusicStream_Resume(void) {
+    if (loaded) PushCommand(MUSIC_CMD_RESUME, 0.0f);
+}
+
+void MusicStream_Stop(void) {
+    if (loaded) PushCommand(MUSIC_CMD_STOP, 0.0f);
+}
+
+void MusicStream_SetVolume(float newVolume) {
+    volume = newVolume;
+    if (loaded) PushCommand(MUSIC_CMD_VOLUME, newVolume);
+}
+
+void MusicStream_Seek(float position) {
+    if (loaded) PushCommand(MUSIC_CMD_SEEK, position);
+}
+
+void MusicStream_Update(void) {
+    if (!threaded) {
+        StreamTick();
+    }
+}
+
+bool MusicStream_IsPlaying(void) {
+    return loaded && __atomic_load_n(&playing, __ATOMIC_RELAXED);
+}
+
+float MusicStream_GetTime(void) {
+    double position, stamp;
+    int isPlaying;
+    unsigned int before, after;
+
+    do {
+        before = __atomic_load_n(&clockSequence, __ATOMIC_ACQUIRE);
+        __atomic_load(&clockPosition, &position, __ATOMIC_RELAXED);
+        __atomic_load(&clockStamp, &stamp, __ATOMIC_RELAXED);
+        isPlaying = __atomic_load_n(&clockPlaying, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        after = __atomic_load_n(&clockSequence, __ATOMIC_RELAXED);
+    } while ((before & 1) || before != after);
+
+    // Run the clock forward between audio thread updates
+    if (isPlaying) {
+        double elapsed = GetTime() - stamp;
+        if (elapsed > MUSIC_CLOCK_MAX_EXTRAPOLATION) elapsed = MUSIC_CLOCK_MAX_EXTRAPOLATION;
+        if (elapsed > 0.0) position += elapsed;
+    }
+    return (float)position;
+}